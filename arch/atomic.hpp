@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////
+//
+//	Atomic memory operations
+//
+//	File:	atomic.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch i386
+#include <arch/i386/atomic.hpp>
+// IgrOS-Kernel arch x86_64
+#include <arch/x86_64/atomic.hpp>
+// IgrOS-Kernel library
+#include <klib/kSingleton.hpp>
+
+
+// Arch namespace
+namespace igros::arch {
+
+
+	// Atomic operations description type
+	template<class T>
+	class atomic_t final : public klib::kSingleton<atomic_t<T>> {
+
+		// No copy construction
+		atomic_t(const atomic_t &other) noexcept = delete;
+		// No copy assignment
+		atomic_t& operator=(const atomic_t &other) noexcept = delete;
+
+		// No move construction
+		atomic_t(atomic_t &&other) noexcept = delete;
+		// No move assignment
+		atomic_t& operator=(atomic_t &&other) noexcept = delete;
+
+
+	public:
+
+		// Default c-tor
+		atomic_t() noexcept = default;
+
+		// Atomically load value
+		template<typename V>
+		[[nodiscard]]
+		auto	load(const V* const addr) const noexcept -> V;
+		// Atomically store value
+		template<typename V>
+		void	store(V* const addr, const V value) const noexcept;
+		// Atomically store value (release, no full barrier)
+		template<typename V>
+		void	storeRelease(V* const addr, const V value) const noexcept;
+
+		// Atomically exchange value
+		template<typename V>
+		auto	exchange(V* const addr, const V value) const noexcept -> V;
+		// Atomically compare and exchange value (returns old value)
+		template<typename V>
+		auto	compareExchange(V* const addr, const V expected, const V desired) const noexcept -> V;
+
+		// Atomically add to value (returns old value)
+		template<typename V>
+		auto	fetchAdd(V* const addr, const V value) const noexcept -> V;
+
+		// Atomically set bits
+		template<typename V>
+		void	bitOr(V* const addr, const V value) const noexcept;
+		// Atomically clear bits
+		template<typename V>
+		void	bitAnd(V* const addr, const V value) const noexcept;
+
+
+	};
+
+
+	// Atomically load value
+	template<class T>
+	template<typename V>
+	[[nodiscard]]
+	inline auto atomic_t<T>::load(const V* const addr) const noexcept -> V {
+		return T::load(addr);
+	}
+
+	// Atomically store value
+	template<class T>
+	template<typename V>
+	inline void atomic_t<T>::store(V* const addr, const V value) const noexcept {
+		T::store(addr, value);
+	}
+
+	// Atomically store value (release, no full barrier)
+	template<class T>
+	template<typename V>
+	inline void atomic_t<T>::storeRelease(V* const addr, const V value) const noexcept {
+		T::storeRelease(addr, value);
+	}
+
+
+	// Atomically exchange value
+	template<class T>
+	template<typename V>
+	inline auto atomic_t<T>::exchange(V* const addr, const V value) const noexcept -> V {
+		return T::exchange(addr, value);
+	}
+
+	// Atomically compare and exchange value (returns old value)
+	template<class T>
+	template<typename V>
+	inline auto atomic_t<T>::compareExchange(V* const addr, const V expected, const V desired) const noexcept -> V {
+		return T::compareExchange(addr, expected, desired);
+	}
+
+
+	// Atomically add to value (returns old value)
+	template<class T>
+	template<typename V>
+	inline auto atomic_t<T>::fetchAdd(V* const addr, const V value) const noexcept -> V {
+		return T::fetchAdd(addr, value);
+	}
+
+
+	// Atomically set bits
+	template<class T>
+	template<typename V>
+	inline void atomic_t<T>::bitOr(V* const addr, const V value) const noexcept {
+		T::bitOr(addr, value);
+	}
+
+	// Atomically clear bits
+	template<class T>
+	template<typename V>
+	inline void atomic_t<T>::bitAnd(V* const addr, const V value) const noexcept {
+		T::bitAnd(addr, value);
+	}
+
+
+#if	defined (IGROS_ARCH_i386)
+
+	// Atomic operations type
+	using atomic	= atomic_t<i386::atomic>;
+
+#elif	defined (IGROS_ARCH_x86_64)
+
+	// Atomic operations type
+	using atomic	= atomic_t<x86_64::atomic>;
+
+#else
+
+	static_assert(
+		false,
+		"Unknown architecture!"
+	);
+
+	// Atomic operations type
+	using atomic	= atomic_t<void>;
+
+#endif
+
+
+}	// namespace igros::arch
+
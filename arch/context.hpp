@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////
+//
+//	Execution context
+//
+//	File:	context.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch i386
+#include <arch/i386/context.hpp>
+// IgrOS-Kernel arch x86_64
+#include <arch/x86_64/context.hpp>
+// IgrOS-Kernel library
+#include <klib/kSingleton.hpp>
+
+
+// Arch namespace
+namespace igros::arch {
+
+
+	// Execution context description type
+	template<class T>
+	class context_t final : public klib::kSingleton<context_t<T>> {
+
+		// No copy construction
+		context_t(const context_t &other) noexcept = delete;
+		// No copy assignment
+		context_t& operator=(const context_t &other) noexcept = delete;
+
+		// No move construction
+		context_t(context_t &&other) noexcept = delete;
+		// No move assignment
+		context_t& operator=(context_t &&other) noexcept = delete;
+
+
+	public:
+
+		// Context entry type
+		using entry_t = typename T::entry_t;
+
+		// Default c-tor
+		context_t() noexcept = default;
+
+		// Build new context on stack (returns its stack pointer)
+		[[nodiscard]]
+		auto	init(const igros_usize_t stackTop, const entry_t entry, const igros_pointer_t arg) const noexcept -> igros_usize_t;
+		// Switch execution context
+		void	switchTo(igros_usize_t* const from, const igros_usize_t to) const noexcept;
+
+
+	};
+
+
+	// Build new context on stack (returns its stack pointer)
+	template<class T>
+	[[nodiscard]]
+	inline auto context_t<T>::init(const igros_usize_t stackTop, const entry_t entry, const igros_pointer_t arg) const noexcept -> igros_usize_t {
+		return T::init(stackTop, entry, arg);
+	}
+
+	// Switch execution context
+	template<class T>
+	inline void context_t<T>::switchTo(igros_usize_t* const from, const igros_usize_t to) const noexcept {
+		T::switchTo(from, to);
+	}
+
+
+#if	defined (IGROS_ARCH_i386)
+
+	// Execution context type
+	using context	= context_t<i386::context>;
+
+#elif	defined (IGROS_ARCH_x86_64)
+
+	// Execution context type
+	using context	= context_t<x86_64::context>;
+
+#else
+
+	static_assert(
+		false,
+		"Unknown architecture!"
+	);
+
+	// Execution context type
+	using context	= context_t<void>;
+
+#endif
+
+
+}	// namespace igros::arch
+
@@ -49,6 +49,16 @@ namespace igros::arch {
 		// Halt CPU
 		[[noreturn]]
 		void	halt() const noexcept;
+		// Wait for interrupt
+		void	idle() const noexcept;
+		// Spin-wait hint
+		void	pause() const noexcept;
+		// Read time-stamp counter
+		[[nodiscard]]
+		auto	timestamp() const noexcept -> igros_quad_t;
+		// Time-stamp counter runs at constant rate in all states
+		[[nodiscard]]
+		auto	timestampInvariant() const noexcept -> bool;
 
 		// Dump CPU registers
 		void	dumpRegisters(const register_t* const regs) const noexcept;
@@ -64,6 +74,32 @@ namespace igros::arch {
 		T::halt();
 	}
 
+	// Wait for interrupt
+	template<class T>
+	inline void cpu_t<T>::idle() const noexcept {
+		T::idle();
+	}
+
+	// Spin-wait hint
+	template<class T>
+	inline void cpu_t<T>::pause() const noexcept {
+		T::pause();
+	}
+
+	// Read time-stamp counter
+	template<class T>
+	[[nodiscard]]
+	inline auto cpu_t<T>::timestamp() const noexcept -> igros_quad_t {
+		return T::timestamp();
+	}
+
+	// Time-stamp counter runs at constant rate in all states
+	template<class T>
+	[[nodiscard]]
+	inline auto cpu_t<T>::timestampInvariant() const noexcept -> bool {
+		return T::timestampInvariant();
+	}
+
 
 	// Dump CPU registers
 	template<class T>
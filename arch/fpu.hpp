@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////
+//
+//	FPU state management
+//
+//	File:	fpu.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch i386
+#include <arch/i386/fpu.hpp>
+// IgrOS-Kernel arch x86_64
+#include <arch/x86_64/fpu.hpp>
+// IgrOS-Kernel library
+#include <klib/kSingleton.hpp>
+
+
+// Arch namespace
+namespace igros::arch {
+
+
+	// FPU description type
+	template<class T>
+	class fpu_t final : public klib::kSingleton<fpu_t<T>> {
+
+		// No copy construction
+		fpu_t(const fpu_t &other) noexcept = delete;
+		// No copy assignment
+		fpu_t& operator=(const fpu_t &other) noexcept = delete;
+
+		// No move construction
+		fpu_t(fpu_t &&other) noexcept = delete;
+		// No move assignment
+		fpu_t& operator=(fpu_t &&other) noexcept = delete;
+
+
+	public:
+
+		// Default c-tor
+		fpu_t() noexcept = default;
+
+		// Init FPU of current CPU (first use traps)
+		[[nodiscard]]
+		auto	init() const noexcept -> bool;
+
+		// Get state area size
+		[[nodiscard]]
+		auto	size() const noexcept -> igros_usize_t;
+
+		// Save state to area
+		void	save(const igros_pointer_t area) const noexcept;
+		// Restore state from area
+		void	restore(const igros_pointer_t area) const noexcept;
+		// Fill area with default state
+		void	prepare(const igros_pointer_t area) const noexcept;
+		// Load default state to registers
+		void	reset() const noexcept;
+
+		// Allow FPU use
+		void	enable() const noexcept;
+		// Trap next FPU use
+		void	disable() const noexcept;
+
+
+	};
+
+
+	// Init FPU of current CPU (first use traps)
+	template<class T>
+	[[nodiscard]]
+	inline auto fpu_t<T>::init() const noexcept -> bool {
+		return T::init();
+	}
+
+
+	// Get state area size
+	template<class T>
+	[[nodiscard]]
+	inline auto fpu_t<T>::size() const noexcept -> igros_usize_t {
+		return T::size();
+	}
+
+
+	// Save state to area
+	template<class T>
+	inline void fpu_t<T>::save(const igros_pointer_t area) const noexcept {
+		T::save(area);
+	}
+
+	// Restore state from area
+	template<class T>
+	inline void fpu_t<T>::restore(const igros_pointer_t area) const noexcept {
+		T::restore(area);
+	}
+
+	// Fill area with default state
+	template<class T>
+	inline void fpu_t<T>::prepare(const igros_pointer_t area) const noexcept {
+		T::prepare(area);
+	}
+
+	// Load default state to registers
+	template<class T>
+	inline void fpu_t<T>::reset() const noexcept {
+		T::reset();
+	}
+
+
+	// Allow FPU use
+	template<class T>
+	inline void fpu_t<T>::enable() const noexcept {
+		T::enable();
+	}
+
+	// Trap next FPU use
+	template<class T>
+	inline void fpu_t<T>::disable() const noexcept {
+		T::disable();
+	}
+
+
+#if	defined (IGROS_ARCH_i386)
+
+	// FPU type
+	using fpu	= fpu_t<i386::fpu>;
+
+#elif	defined (IGROS_ARCH_x86_64)
+
+	// FPU type
+	using fpu	= fpu_t<x86_64::fpu>;
+
+#else
+
+	static_assert(
+		false,
+		"Unknown architecture!"
+	);
+
+	// FPU type
+	using fpu	= fpu_t<void>;
+
+#endif
+
+
+}	// namespace igros::arch
+
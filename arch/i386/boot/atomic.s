@@ -0,0 +1,123 @@
+################################################################
+#
+#	Atomic memory operations
+#
+#	File:	atomic.s
+#	Date:	19 Oct 2026
+#
+#	Copyright (c) 2017 - 2022, Igor Baklykov
+#	All rights reserved.
+#
+#
+
+
+.code32
+
+.section .text
+.balign 4
+
+.global	atomicLoad32			# Atomically load long
+.global	atomicStore32			# Atomically store long
+.global	atomicStoreRelease32		# Atomically store long (release)
+.global	atomicExchange32		# Atomically exchange long
+.global	atomicCompareExchange32		# Atomically compare and exchange long
+.global	atomicFetchAdd32		# Atomically add to long
+.global	atomicOr32			# Atomically OR long
+.global	atomicAnd32			# Atomically AND long
+
+
+# Atomically load long
+.type atomicLoad32, %function
+atomicLoad32:
+
+	movl	4(%esp), %edx		# Memory address
+	movl	(%edx), %eax		# Aligned load is atomic
+	retl				# Return loaded value
+
+.size atomicLoad32, . - atomicLoad32
+
+
+# Atomically store long
+.type atomicStore32, %function
+atomicStore32:
+
+	movl	4(%esp), %edx		# Memory address
+	movl	8(%esp), %eax		# New value
+	xchgl	%eax, (%edx)		# Store with full barrier
+	retl				# Return
+
+.size atomicStore32, . - atomicStore32
+
+
+# Atomically store long (release)
+.type atomicStoreRelease32, %function
+atomicStoreRelease32:
+
+	movl	4(%esp), %edx		# Memory address
+	movl	8(%esp), %eax		# New value
+	movl	%eax, (%edx)		# Stores are not reordered with older stores
+	retl				# Return
+
+.size atomicStoreRelease32, . - atomicStoreRelease32
+
+
+# Atomically exchange long
+.type atomicExchange32, %function
+atomicExchange32:
+
+	movl	4(%esp), %edx		# Memory address
+	movl	8(%esp), %eax		# New value
+	xchgl	%eax, (%edx)		# Exchange (implicitly locked)
+	retl				# Return old value
+
+.size atomicExchange32, . - atomicExchange32
+
+
+# Atomically compare and exchange long
+.type atomicCompareExchange32, %function
+atomicCompareExchange32:
+
+	movl	4(%esp), %edx		# Memory address
+	movl	8(%esp), %eax		# Expected value
+	movl	12(%esp), %ecx		# Desired value
+	lock cmpxchgl	%ecx, (%edx)	# Store desired value if equals to expected
+	retl				# Return old value
+
+.size atomicCompareExchange32, . - atomicCompareExchange32
+
+
+# Atomically add to long
+.type atomicFetchAdd32, %function
+atomicFetchAdd32:
+
+	movl	4(%esp), %edx		# Memory address
+	movl	8(%esp), %eax		# Addend
+	lock xaddl	%eax, (%edx)	# Exchange and add
+	retl				# Return old value
+
+.size atomicFetchAdd32, . - atomicFetchAdd32
+
+
+# Atomically OR long
+.type atomicOr32, %function
+atomicOr32:
+
+	movl	4(%esp), %edx		# Memory address
+	movl	8(%esp), %eax		# Bits to set
+	lock orl	%eax, (%edx)	# Set bits
+	retl				# Return
+
+.size atomicOr32, . - atomicOr32
+
+
+# Atomically AND long
+.type atomicAnd32, %function
+atomicAnd32:
+
+	movl	4(%esp), %edx		# Memory address
+	movl	8(%esp), %eax		# Bits to keep
+	lock andl	%eax, (%edx)	# Clear bits
+	retl				# Return
+
+.size atomicAnd32, . - atomicAnd32
+
@@ -14,9 +14,13 @@
 .set	KERNEL_VMA,		0xC0000000		# Kernel virtual memory offset
 
 .set	PAGE_ENTRY_VALID,	0x00000083		# Valid page entry
+.set	PAGE_ENTRY_UNCACHED,	0x00000018		# Uncached page entry (PCD + PWT)
 .set	PAGE_ENTRY_INVALID,	0x00000000		# Invalid page entry
 
 .set	PAGE_TEMP_KERNEL,	KERNEL_VMA>>22		# Kernel PD index
+.set	PAGE_TEMP_MMIO,		0xFE000000>>22		# Memory-mapped devices PD index
+
+.set	PAGE_SIZE_4MB,		0x00400000		# Size of 4Mb page
 
 .set	PAGE_BIT_PSE,		0x00000010		# Page Size Extension bit
 .set	PAGE_BIT_PE,		0x80000000		# Paging Enable bit
@@ -137,14 +141,24 @@ gdt32End:
 
 # Temporary boot page directory
 bootPageDirectory:
-	# Entry 0 = 1Mb offset (identity) mapped
-	.int	PAGE_ENTRY_VALID
-	# Zeroes
-	.fill	(PAGE_TEMP_KERNEL - 1), 4, PAGE_ENTRY_INVALID
-	# Entry 227 = 3Gb + 1Mb offset (higher half) mapped
+	# Entries 0 - 767 = 0Gb - 3Gb (identity) mapped
+	# Needed to reach ACPI tables placed by firmware
+	.set	PAGE_ADDRESS, 0
+	.rept	PAGE_TEMP_KERNEL
+	.int	PAGE_ADDRESS + PAGE_ENTRY_VALID
+	.set	PAGE_ADDRESS, PAGE_ADDRESS + PAGE_SIZE_4MB
+	.endr
+	# Entry 768 = 3Gb + 1Mb offset (higher half) mapped
 	.int	PAGE_ENTRY_VALID
 	# Zeroes
-	.fill	(1024 - PAGE_TEMP_KERNEL - 1), 4, PAGE_ENTRY_INVALID
+	.fill	(PAGE_TEMP_MMIO - PAGE_TEMP_KERNEL - 1), 4, PAGE_ENTRY_INVALID
+	# Entries 1016 - 1023 = 4Gb - 32Mb (identity, uncached) mapped
+	# This is where LAPIC, IOAPIC and HPET live
+	.set	PAGE_ADDRESS, 0xFE000000
+	.rept	(1024 - PAGE_TEMP_MMIO)
+	.int	PAGE_ADDRESS + PAGE_ENTRY_VALID + PAGE_ENTRY_UNCACHED
+	.set	PAGE_ADDRESS, PAGE_ADDRESS + PAGE_SIZE_4MB
+	.endr
 
 
 # Stack section
@@ -0,0 +1,55 @@
+################################################################
+#
+#	Execution context switch
+#
+#	File:	context.s
+#	Date:	19 Oct 2026
+#
+#	Copyright (c) 2017 - 2022, Igor Baklykov
+#	All rights reserved.
+#
+#
+
+
+.code32
+
+.section .text
+.balign 4
+
+.global	contextSwitch			# Switch execution context
+.global	contextStart			# New execution context entry
+
+
+# Switch execution context
+.type contextSwitch, %function
+contextSwitch:
+
+	movl	4(%esp), %eax		# Current stack pointer save location
+	movl	8(%esp), %edx		# New stack pointer
+	pushl	%ebp			# Save callee-saved registers
+	pushl	%ebx			# ---//---
+	pushl	%esi			# ---//---
+	pushl	%edi			# ---//---
+	pushfl				# Save flags (interrupts state)
+	movl	%esp, (%eax)		# Save current stack pointer
+	movl	%edx, %esp		# Switch to new stack
+	popfl				# Restore flags (interrupts state)
+	popl	%edi			# Restore callee-saved registers
+	popl	%esi			# ---//---
+	popl	%ebx			# ---//---
+	popl	%ebp			# ---//---
+	retl				# Resume new context
+
+.size contextSwitch, . - contextSwitch
+
+
+# New execution context entry
+.type contextStart, %function
+contextStart:
+
+	pushl	%esi			# Entry argument
+	calll	*%ebx			# Call entry
+	ud2				# Entry must never return
+
+.size contextStart, . - contextStart
+
@@ -17,6 +17,9 @@
 .balign 4
 
 .global cpuHalt			# halt CPU
+.global cpuIdle			# wait for interrupt
+.global cpuPause		# spin-wait hint
+.global cpuTimestamp		# read time-stamp counter
 
 
 # Halt CPU
@@ -29,3 +32,34 @@ cpuHalt:
 
 .size cpuHalt, . - cpuHalt
 
+
+# Wait for interrupt
+.type cpuIdle, %function
+cpuIdle:
+
+	sti				# Enable interrupts (takes effect after next instruction)
+	hlt				# Sleep till interrupt
+	retl				# Return
+
+.size cpuIdle, . - cpuIdle
+
+
+# Spin-wait loop hint
+.type cpuPause, %function
+cpuPause:
+
+	pause				# Relax CPU in spin-wait loop
+	retl				# Return
+
+.size cpuPause, . - cpuPause
+
+
+# Read time-stamp counter
+.type cpuTimestamp, %function
+cpuTimestamp:
+
+	rdtsc				# Read TSC into EDX:EAX (64-bit return value)
+	retl				# Return
+
+.size cpuTimestamp, . - cpuTimestamp
+
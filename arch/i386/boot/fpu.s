@@ -13,6 +13,7 @@
 
 .set	FPU_CONTROL_WORD_MASK,	0x103F		# FPU control word mask
 .set	FPU_CONTROL_WORD,	0x003F		# FPU control word
+.set	FPU_CR0_TS,		0x0008		# CR0 task switched bit
 
 
 .code32
@@ -21,6 +22,11 @@
 .balign 4
 
 .global fpuCheck				# Check FPU
+.global fpuReset				# Load default FPU state
+.global fpuClearTS				# Allow FPU use (clear CR0.TS)
+.global fpuSetTS				# Trap next FPU use (set CR0.TS)
+.global fpuFsave				# Save FPU state
+.global fpuFrstor				# Restore FPU state
 
 
 # Check FPU
@@ -49,6 +55,62 @@ fpuCheck:
 .size fpuCheck, . - fpuCheck
 
 
+# Load default FPU state
+.type fpuReset, %function
+fpuReset:
+
+	fninit					# Initialize FPU
+	retl					# Exit
+
+.size fpuReset, . - fpuReset
+
+
+# Allow FPU use (clear CR0.TS)
+.type fpuClearTS, %function
+fpuClearTS:
+
+	clts					# Clear task switched bit
+	retl					# Exit
+
+.size fpuClearTS, . - fpuClearTS
+
+
+# Trap next FPU use (set CR0.TS)
+.type fpuSetTS, %function
+fpuSetTS:
+
+	movl %cr0, %eax				# Load CR0
+	orl $FPU_CR0_TS, %eax			# Set task switched bit
+	movl %eax, %cr0				# Store CR0
+	retl					# Exit
+
+.size fpuSetTS, . - fpuSetTS
+
+
+# Save FPU state
+# FNSAVE reinitializes FPU, so state is loaded back to stay valid
+.type fpuFsave, %function
+fpuFsave:
+
+	movl 4(%esp), %eax			# Area pointer
+	fnsave (%eax)				# Save state (resets FPU)
+	frstor (%eax)				# Keep state loaded
+	retl					# Exit
+
+.size fpuFsave, . - fpuFsave
+
+
+# Restore FPU state
+.type fpuFrstor, %function
+fpuFrstor:
+
+	movl 4(%esp), %eax			# Area pointer
+	frstor (%eax)				# Restore state
+	retl					# Exit
+
+.size fpuFrstor, . - fpuFrstor
+
+
 .section .rodata
 .balign	4096
 
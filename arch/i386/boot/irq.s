@@ -16,221 +16,55 @@
 .section .text
 .balign	4
 
-.extern	interruptServiceRoutine		# Extenral main interrupts handler
-
-.global irqHandler0			# 0
-.global irqHandler1			# 1
-.global irqHandler2			# 2
-.global irqHandler3			# 3
-.global irqHandler4			# 4
-.global irqHandler5			# 5
-.global irqHandler6			# 6
-.global irqHandler7			# 7
-.global irqHandler8			# 8
-.global irqHandler9			# 9
-.global irqHandlerA			# 10
-.global irqHandlerB			# 11
-.global irqHandlerC			# 12
-.global irqHandlerD			# 13
-.global irqHandlerE			# 14
-.global irqHandlerF			# 15
+.extern	irqServiceRoutine		# Extenral device interrupts handler
+
+.global irqStubTable			# IRQ entry stubs (vectors 32 - 255)
 
 .global irqEnable			# Interrupts
 .global irqDisable			# No interrupts
+.global irqSave				# Save flags and disable interrupts
+.global irqRestore			# Restore flags
 
 
-# IRQ 0
-.type irqHandler0, %function
-irqHandler0:
-
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x20			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandler0, . - irqHandler0
-
-
-# IRQ 1
-.type irqHandler1, %function
-irqHandler1:
-
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x21			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandler1, . - irqHandler1
-
-
-# IRQ 2
-.type irqHandler2, %function
-irqHandler2:
-
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x22			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandler2, . - irqHandler2
-
-
-# IRQ 3
-.type irqHandler3, %function
-irqHandler3:
-
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x23			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandler3, . - irqHandler3
-
-
-# IRQ 4
-.type irqHandler4, %function
-irqHandler4:
+# IRQ entry stub (interrupt gate already cleared IF)
+#	number	- interrupt vector
+.macro	IRQ number
 
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x24			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandler4, . - irqHandler4
-
-
-# IRQ 5
-.type irqHandler5, %function
-irqHandler5:
-
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x25			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandler5, . - irqHandler5
-
-
-# IRQ 6
-.type irqHandler6, %function
-irqHandler6:
-
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x26			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandler6, . - irqHandler6
-
-
-# IRQ 7
-.type irqHandler7, %function
-irqHandler7:
-
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x27			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandler7, . - irqHandler7
-
-
-# IRQ 8
-.type irqHandler8, %function
-irqHandler8:
-
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x28			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandler8, . - irqHandler8
-
-
-# IRQ 9
-irqHandler9:
-.type irqHandler9, %function
-
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x29			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandler9, . - irqHandler9
-
-
-# IRQ 10
-.type irqHandlerA, %function
-irqHandlerA:
-
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x2A			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandlerA, . - irqHandlerA
-
-
-# IRQ 11
-.type irqHandlerB, %function
-irqHandlerB:
-
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x2B			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandlerB, . - irqHandlerB
-
-
-# IRQ 12
-.type irqHandlerC, %function
-irqHandlerC:
-
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x2C			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandlerC, . - irqHandlerC
-
-
-# IRQ 13
-.type irqHandlerD, %function
-irqHandlerD:
+.section .text
+.type irqHandler\number, %function
+irqHandler\number:
 
-	cli				# Disable interrupts
 	pushl	$0x00			# Fake parameter
-	pushl	$0x2D			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandlerD, . - irqHandlerD
+	pushl	$\number			# IRQ number
+	jmp	irqServiceRoutine	# Handle IRQ
 
+.size irqHandler\number, . - irqHandler\number
 
-# IRQ 14
-.type irqHandlerE, %function
-irqHandlerE:
+.section .rodata
+	.long	irqHandler\number		# Stub table entry
 
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x2E			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
-
-.size irqHandlerE, . - irqHandlerE
+.endm
 
 
-# IRQ 15
-.type irqHandlerF, %function
-irqHandlerF:
+# IRQ entry stubs table (one per vector above exceptions)
+.section .rodata
+.balign	4
+.type irqStubTable, %object
+irqStubTable:
 
-	cli				# Disable interrupts
-	pushl	$0x00			# Fake parameter
-	pushl	$0x2F			# IRQ number
-	jmp	interruptServiceRoutine	# Handle IRQ
+.altmacro
+.set	vector, 0x20
+.rept	0xE0
+	IRQ	%vector
+	.set	vector, vector + 1
+.endr
+.noaltmacro
 
-.size irqHandlerF, . - irqHandlerF
+.section .rodata
+.size irqStubTable, . - irqStubTable
 
 
+.section .text
 
 # Enable interrupts
 .type irqEnable, %function
@@ -251,3 +85,26 @@ irqDisable:
 
 .size irqDisable, . - irqDisable
 
+
+# Save flags and disable interrupts
+.type irqSave, %function
+irqSave:
+
+	pushfl				# Get EFLAGS
+	popl	%eax			# Return previous EFLAGS
+	cli				# Disable interrupts
+	retl
+
+.size irqSave, . - irqSave
+
+
+# Restore flags (interrupts state)
+.type irqRestore, %function
+irqRestore:
+
+	pushl	4(%esp)			# Set EFLAGS from saved value
+	popfl				# --//--
+	retl
+
+.size irqRestore, . - irqRestore
+
@@ -19,6 +19,7 @@
 .extern	isrHandler			# Extenral main interrupt service routine handler
 
 .global interruptServiceRoutine		# ISR
+.global irqServiceRoutine		# Device IRQ ISR
 
 
 # Interrupt service routine
@@ -54,3 +55,45 @@ interruptServiceRoutine:
 
 .size interruptServiceRoutine, . - interruptServiceRoutine
 
+
+# Device IRQ service routine
+# Handlers are plain C++ calls, so callee-saved registers survive them
+# and only caller-clobbered ones are saved. Frame keeps register_t
+# layout, callee-saved slots are left unset.
+.type irqServiceRoutine, %function
+irqServiceRoutine:
+
+	subl	$0x20, %esp		# Reserve pushal frame
+	movl	%eax, 0x1C(%esp)	# Save caller-clobbered registers
+	movl	%ecx, 0x18(%esp)	# ---//---
+	movl	%edx, 0x14(%esp)	# ---//---
+	pushl	%ds			# Save segment registers
+	pushl	%es			# ---//---
+	pushl	%fs			# ---//---
+	pushl	%gs			# ---//---
+
+	movl	$0x10, %eax		# Load kernel data segment
+	movw	%ax, %ds		# To all segment registers
+	movw	%ax, %es		# ---//---
+	movw	%ax, %fs		# ---//---
+	movw	%ax, %gs		# ---//---
+
+	movl	%esp, %eax		# Take pointer to stack
+	pushl	%eax			# Pass it as a regs struct pointer
+	call	isrHandler		# Call interrupt service routine handler
+	popl	%eax			# Cleanup stack after us
+
+	popl	%gs			# Restore segment registers
+	popl	%fs			# ---//---
+	popl	%es			# ---//---
+	popl	%ds			# ---//---
+	movl	0x14(%esp), %edx	# Restore caller-clobbered registers
+	movl	0x18(%esp), %ecx	# ---//---
+	movl	0x1C(%esp), %eax	# ---//---
+
+	addl	$0x28, %esp		# Registers frame and stack cleanup
+
+	iretl				# Done here
+
+.size irqServiceRoutine, . - irqServiceRoutine
+
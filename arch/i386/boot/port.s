@@ -22,6 +22,12 @@
 .global	inPort8				# Write byte to port
 .global	inPort16			# Write word to port
 .global	inPort32			# Write long to port
+.global	outMemory8			# Read byte from memory
+.global	outMemory16			# Read word from memory
+.global	outMemory32			# Read long from memory
+.global	inMemory8			# Write byte to memory
+.global	inMemory16			# Write word to memory
+.global	inMemory32			# Write long to memory
 
 
 # Read byte from port
@@ -93,3 +99,72 @@ inPort32:
 
 .size inPort32, . - inPort32
 
+
+# Read byte from memory
+.type outMemory8, %function
+outMemory8:
+
+	movl	4(%esp), %edx		# Memory address
+	movb	(%edx), %al		# Read data
+	retl
+
+.size outMemory8, . - outMemory8
+
+
+# Read word from memory
+.type outMemory16, %function
+outMemory16:
+
+	movl	4(%esp), %edx		# Memory address
+	movw	(%edx), %ax		# Read data
+	retl
+
+.size outMemory16, . - outMemory16
+
+
+# Read long from memory
+.type outMemory32, %function
+outMemory32:
+
+	movl	4(%esp), %edx		# Memory address
+	movl	(%edx), %eax		# Read data
+	retl
+
+.size outMemory32, . - outMemory32
+
+
+# Write byte to memory
+.type inMemory8, %function
+inMemory8:
+
+	movl	4(%esp), %edx		# Memory address
+	movb	8(%esp), %al		# Data to write
+	movb	%al, (%edx)		# Write data
+	retl
+
+.size inMemory8, . - inMemory8
+
+
+# Write word to memory
+.type inMemory16, %function
+inMemory16:
+
+	movl	4(%esp), %edx		# Memory address
+	movw	8(%esp), %ax		# Data to write
+	movw	%ax, (%edx)		# Write data
+	retl
+
+.size inMemory16, . - inMemory16
+
+
+# Write long to memory
+.type inMemory32, %function
+inMemory32:
+
+	movl	4(%esp), %edx		# Memory address
+	movl	8(%esp), %eax		# Data to write
+	movl	%eax, (%edx)		# Write data
+	retl
+
+.size inMemory32, . - inMemory32
+
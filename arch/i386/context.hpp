@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////
+//
+//	Execution context for i386
+//
+//	File:	context.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <bit>
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+#ifdef	__cplusplus
+
+extern "C" {
+
+#endif	// __cplusplus
+
+
+	// Switch execution context (save current stack pointer and resume another one)
+	void	contextSwitch(igros::igros_usize_t* const from, const igros::igros_usize_t to) noexcept;
+	// New execution context entry
+	void	contextStart() noexcept;
+
+
+#ifdef	__cplusplus
+
+}	// extern "C"
+
+#endif	// __cplusplus
+
+
+// i386 namespace
+namespace igros::i386 {
+
+
+#pragma pack(push, 1)
+
+	// Initial context frame (see contextSwitch)
+	struct contextFrame_t {
+		igros_dword_t	eflags;
+		igros_dword_t	edi;
+		igros_dword_t	esi;		// Entry argument
+		igros_dword_t	ebx;		// Entry address
+		igros_dword_t	ebp;
+		igros_dword_t	eip;		// contextStart
+	};
+
+#pragma pack(pop)
+
+
+	// Initial flags (interrupts disabled, reserved bit set)
+	constexpr auto CONTEXT_FLAGS		{0x00000002_u32};
+	// Stack alignment required by ABI
+	constexpr auto CONTEXT_STACK_ALIGN	{16_usize};
+	// Stack offset so that stack is aligned after contextStart pushes argument
+	constexpr auto CONTEXT_STACK_OFFSET	{12_usize};
+
+
+	// Execution context structure
+	class context final {
+
+		// Copy c-tor
+		context(const context &other) = delete;
+		// Copy assignment
+		auto	operator=(const context &other) -> context& = delete;
+
+		// Move c-tor
+		context(context &&other) = delete;
+		// Move assignment
+		auto	operator=(context &&other) -> context& = delete;
+
+
+	public:
+
+		// Context entry type
+		using entry_t = std::add_pointer_t<void (igros_pointer_t)>;
+
+		// Default c-tor
+		context() noexcept = default;
+
+		// Build new context on stack (returns its stack pointer)
+		[[nodiscard]]
+		static auto	init(const igros_usize_t stackTop, const entry_t entry, const igros_pointer_t arg) noexcept -> igros_usize_t;
+		// Switch execution context
+		static void	switchTo(igros_usize_t* const from, const igros_usize_t to) noexcept;
+
+
+	};
+
+
+	// Build new context on stack (returns its stack pointer)
+	[[nodiscard]]
+	inline auto context::init(const igros_usize_t stackTop, const entry_t entry, const igros_pointer_t arg) noexcept -> igros_usize_t {
+		// Stack must be aligned when contextStart calls entry
+		const auto top		{(stackTop & ~(CONTEXT_STACK_ALIGN - 1_usize)) - CONTEXT_STACK_OFFSET};
+		const auto frame	{std::bit_cast<contextFrame_t*>(top - sizeof(contextFrame_t))};
+		// Fill frame
+		*frame = contextFrame_t {
+			.eflags	= CONTEXT_FLAGS,
+			.edi	= 0_u32,
+			.esi	= static_cast<igros_dword_t>(std::bit_cast<igros_usize_t>(arg)),
+			.ebx	= static_cast<igros_dword_t>(std::bit_cast<igros_usize_t>(entry)),
+			.ebp	= 0_u32,
+			.eip	= static_cast<igros_dword_t>(std::bit_cast<igros_usize_t>(&::contextStart))
+		};
+		return std::bit_cast<igros_usize_t>(frame);
+	}
+
+	// Switch execution context
+	inline void context::switchTo(igros_usize_t* const from, const igros_usize_t to) noexcept {
+		::contextSwitch(from, to);
+	}
+
+
+}	// namespace igros::i386
+
@@ -31,6 +31,13 @@ extern "C" {
 	// Halt CPU
 	[[noreturn]]
 	void	cpuHalt() noexcept;
+	// Wait for interrupt
+	void	cpuIdle() noexcept;
+	// Spin-wait hint
+	void	cpuPause() noexcept;
+	// Read time-stamp counter
+	[[nodiscard]]
+	auto	cpuTimestamp() noexcept -> igros::igros_quad_t;
 
 
 #ifdef	__cplusplus
@@ -66,6 +73,16 @@ namespace igros::i386 {
 		// Halt CPU
 		[[noreturn]]
 		static void	halt() noexcept;
+		// Wait for interrupt
+		static void	idle() noexcept;
+		// Spin-wait hint
+		static void	pause() noexcept;
+		// Read time-stamp counter
+		[[nodiscard]]
+		static auto	timestamp() noexcept -> igros_quad_t;
+		// Time-stamp counter runs at constant rate in all states
+		[[nodiscard]]
+		static auto	timestampInvariant() noexcept -> bool;
 
 		// Dump CPU registers
 		static void	dumpRegisters(const register_t* const regs) noexcept;
@@ -80,6 +97,29 @@ namespace igros::i386 {
 		::cpuHalt();
 	}
 
+	// Wait for interrupt
+	inline void cpu::idle() noexcept {
+		::cpuIdle();
+	}
+
+	// Spin-wait hint
+	inline void cpu::pause() noexcept {
+		::cpuPause();
+	}
+
+	// Read time-stamp counter
+	[[nodiscard]]
+	inline auto cpu::timestamp() noexcept -> igros_quad_t {
+		return ::cpuTimestamp();
+	}
+
+	// Time-stamp counter runs at constant rate in all states
+	[[nodiscard]]
+	inline auto cpu::timestampInvariant() noexcept -> bool {
+		// No CPUID support here, so TSC rate can't be trusted
+		return false;
+	}
+
 
 	// Dump CPU registers
 	inline void cpu::dumpRegisters(const register_t* const regs) noexcept {
@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////
+//
+//	FPU operations
+//
+//	File:	fpu.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// IgrOS-Kernel arch i386
+#include <arch/i386/cr.hpp>
+#include <arch/i386/exceptions.hpp>
+#include <arch/i386/fpu.hpp>
+// IgrOS-Kernel library
+#include <klib/kmemory.hpp>
+#include <klib/kprint.hpp>
+// IgrOS-Kernel system
+#include <sys/fpu.hpp>
+
+
+// i386 namespace
+namespace igros::i386 {
+
+
+	// CR0 monitor coprocessor bit
+	constexpr auto FPU_CR0_MP	{0x00000002_u32};
+	// CR0 emulation bit
+	constexpr auto FPU_CR0_EM	{0x00000004_u32};
+	// CR0 task switched bit
+	constexpr auto FPU_CR0_TS	{0x00000008_u32};
+	// CR0 native x87 errors bit
+	constexpr auto FPU_CR0_NE	{0x00000020_u32};
+
+
+	// Default state area (copied to new contexts)
+	igros_byte_t	fpu::mDefault[FPU_AREA_SIZE] {};
+
+
+	// Device not available (#NM) handler
+	void fpu::trap([[maybe_unused]] const register_t* regs) noexcept {
+		sys::fpuTrap();
+	}
+
+
+	// Init FPU (first use traps)
+	[[nodiscard]]
+	auto fpu::init() noexcept -> bool {
+		// FPU instructions must not trap while probing
+		::inCR0(::outCR0() & ~(FPU_CR0_EM | FPU_CR0_TS));
+		if (!fpu::check()) {
+			klib::kprintf("FPU:\t\tnot present\n");
+			return false;
+		}
+		// Native x87 errors
+		::inCR0(::outCR0() | FPU_CR0_MP | FPU_CR0_NE);
+		// Default state
+		::fpuReset();
+		fpu::save(fpu::mDefault);
+		// Lazy restore
+		except::install<except::NUMBER::NO_COPROCESSOR, fpu::trap>();
+		// First use traps
+		::fpuSetTS();
+		return true;
+	}
+
+
+	// Fill area with default state
+	void fpu::prepare(const igros_pointer_t area) noexcept {
+		klib::kmemcpy(area, fpu::mDefault, FPU_AREA_SIZE);
+	}
+
+
+}	// namespace igros::i386
+
@@ -16,6 +16,8 @@
 
 // IgrOS-Kernel arch
 #include <arch/types.hpp>
+// IgrOS-Kernel arch i386
+#include <arch/i386/register.hpp>
 // IgrOS-Kernel library
 #include <klib/kprint.hpp>
 
@@ -31,6 +33,18 @@ extern "C" {
 	[[nodiscard]]
 	auto	fpuCheck() noexcept -> bool;
 
+	// Load default FPU state
+	void	fpuReset() noexcept;
+	// Allow FPU use (clear CR0.TS)
+	void	fpuClearTS() noexcept;
+	// Trap next FPU use (set CR0.TS)
+	void	fpuSetTS() noexcept;
+
+	// Save FPU state
+	void	fpuFsave(const igros::igros_pointer_t area) noexcept;
+	// Restore FPU state
+	void	fpuFrstor(const igros::igros_pointer_t area) noexcept;
+
 
 #ifdef	__cplusplus
 
@@ -43,9 +57,25 @@ extern "C" {
 namespace igros::i386 {
 
 
+	// FNSAVE area size
+	constexpr auto FPU_AREA_SIZE	{108_usize};
+
+
+	// State save method
+	enum class fpuMethod_t : igros_dword_t {
+		FSAVE					// x87 only
+	};
+
+
 	// FPU representation
 	class fpu final {
 
+		// Default state area (copied to new contexts)
+		static igros_byte_t	mDefault[FPU_AREA_SIZE];
+
+		// Device not available (#NM) handler
+		static void	trap(const register_t* regs) noexcept;
+
 		// Copy c-tor
 		fpu(const fpu &other) = delete;
 		// Copy assignment
@@ -66,6 +96,31 @@ namespace igros::i386 {
 		[[nodiscard]]
 		static auto	check() noexcept -> bool;
 
+		// Init FPU (first use traps)
+		[[nodiscard]]
+		static auto	init() noexcept -> bool;
+
+		// Get state save method
+		[[nodiscard]]
+		static auto	method() noexcept -> fpuMethod_t;
+		// Get state area size
+		[[nodiscard]]
+		static auto	size() noexcept -> igros_usize_t;
+
+		// Save state to area
+		static void	save(const igros_pointer_t area) noexcept;
+		// Restore state from area
+		static void	restore(const igros_pointer_t area) noexcept;
+		// Fill area with default state
+		static void	prepare(const igros_pointer_t area) noexcept;
+		// Load default state to registers
+		static void	reset() noexcept;
+
+		// Allow FPU use
+		static void	enable() noexcept;
+		// Trap next FPU use
+		static void	disable() noexcept;
+
 
 	};
 
@@ -77,5 +132,46 @@ namespace igros::i386 {
 	}
 
 
+	// Get state save method
+	[[nodiscard]]
+	inline auto fpu::method() noexcept -> fpuMethod_t {
+		return fpuMethod_t::FSAVE;
+	}
+
+	// Get state area size
+	[[nodiscard]]
+	inline auto fpu::size() noexcept -> igros_usize_t {
+		return FPU_AREA_SIZE;
+	}
+
+
+	// Save state to area
+	inline void fpu::save(const igros_pointer_t area) noexcept {
+		::fpuFsave(area);
+	}
+
+	// Restore state from area
+	inline void fpu::restore(const igros_pointer_t area) noexcept {
+		::fpuFrstor(area);
+	}
+
+
+	// Load default state to registers
+	inline void fpu::reset() noexcept {
+		::fpuReset();
+	}
+
+
+	// Allow FPU use
+	inline void fpu::enable() noexcept {
+		::fpuClearTS();
+	}
+
+	// Trap next FPU use
+	inline void fpu::disable() noexcept {
+		::fpuSetTS();
+	}
+
+
 }	// namespace igros::i386
 
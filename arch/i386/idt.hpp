@@ -82,6 +82,9 @@ namespace igros::i386 {
 		template<offset_t HANDLE, igros_word_t SELECTOR, igros_byte_t TYPE>
 		[[nodiscard]]
 		constexpr static auto	setEntry() noexcept -> entry_t;
+		// Set IDT entry (handler known at run time)
+		[[nodiscard]]
+		static auto		setEntry(const offset_t handle, const igros_word_t selector, const igros_byte_t type) noexcept -> entry_t;
 		// Calc IDT size
 		[[nodiscard]]
 		constexpr static auto	calcSize(const table_t &table) noexcept -> igros_word_t;
@@ -109,6 +112,18 @@ namespace igros::i386 {
 		};
 	}
 
+	// Set IDT entry (handler known at run time)
+	[[nodiscard]]
+	inline auto idt::setEntry(const offset_t handle, const igros_word_t selector, const igros_byte_t type) noexcept -> entry_t {
+		return entry_t {
+			.offsetLow	= static_cast<igros_word_t>(std::bit_cast<igros_usize_t>(handle) & 0xFFFF_usize),
+			.selector	= selector,
+			.reserved	= 0_u8,
+			.type		= type,
+			.offsetHigh	= static_cast<igros_word_t>((std::bit_cast<igros_usize_t>(handle) >> std::numeric_limits<igros_word_t>::digits) & 0xFFFF_usize)
+		};
+	}
+
 	// Calculate IDT size
 	[[nodiscard]]
 	constexpr auto idt::calcSize(const table_t &table) noexcept -> igros_word_t {
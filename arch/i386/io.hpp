@@ -53,6 +53,23 @@ extern "C" {
 	// Write long to port
 	void	inPort32(const igros::i386::port_t addr, const igros::igros_dword_t value) noexcept;
 
+	// Read byte from memory (never cached in registers)
+	[[nodiscard]]
+	auto	outMemory8(const igros::igros_byte_t* const addr) noexcept -> igros::igros_byte_t;
+	// Read word from memory (never cached in registers)
+	[[nodiscard]]
+	auto	outMemory16(const igros::igros_word_t* const addr) noexcept -> igros::igros_word_t;
+	// Read long from memory (never cached in registers)
+	[[nodiscard]]
+	auto	outMemory32(const igros::igros_dword_t* const addr) noexcept -> igros::igros_dword_t;
+
+	// Write byte to memory (never cached in registers)
+	void	inMemory8(igros::igros_byte_t* const addr, const igros::igros_byte_t value) noexcept;
+	// Write word to memory (never cached in registers)
+	void	inMemory16(igros::igros_word_t* const addr, const igros::igros_word_t value) noexcept;
+	// Write long to memory (never cached in registers)
+	void	inMemory32(igros::igros_dword_t* const addr, const igros::igros_dword_t value) noexcept;
+
 
 #ifdef	__cplusplus
 
@@ -160,35 +177,35 @@ namespace igros::i386 {
 	// Read byte from memory
 	[[nodiscard]]
 	inline auto io::readMemory8(const igros_byte_t* const addr) noexcept -> igros_byte_t {
-		return *addr;
+		return ::outMemory8(addr);
 	}
 
 	// Read word from memory
 	[[nodiscard]]
 	inline auto io::readMemory16(const igros_word_t* const addr) noexcept -> igros_word_t {
-		return *addr;
+		return ::outMemory16(addr);
 	}
 
 	// Read long from memory
 	[[nodiscard]]
 	inline auto io::readMemory32(const igros_dword_t* const addr) noexcept -> igros_dword_t {
-		return *addr;
+		return ::outMemory32(addr);
 	}
 
 
 	// Write byte to memory
 	inline void io::writeMemory8(igros_byte_t* const addr, const igros_byte_t value) noexcept {
-		*addr = value;
+		::inMemory8(addr, value);
 	}
 
 	// Write word to memory
 	inline void io::writeMemory16(igros_word_t* const addr, const igros_word_t value) noexcept {
-		*addr = value;
+		::inMemory16(addr, value);
 	}
 
 	// Write long to memory
 	inline void io::writeMemory32(igros_dword_t* const addr, const igros_dword_t value) noexcept {
-		*addr = value;
+		::inMemory32(addr, value);
 	}
 
 
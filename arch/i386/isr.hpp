@@ -29,18 +29,47 @@ namespace igros::i386 {
 
 	// IRQ offset in ISR list
 	constexpr auto IRQ_OFFSET	{32_usize};
+	// Legacy PIC IRQs count
+	constexpr auto IRQ_PIC_SIZE	{16_usize};
 	// ISR list size
 	constexpr auto ISR_SIZE		{256_usize};
 
 	// Interrupt service routine handler type
 	using isr_t			= std::add_pointer_t<void (const register_t* const)>;
 
-	// Install interrupt service routine handler
-	void	isrHandlerInstall(const igros_usize_t number, const isr_t handle) noexcept;
+	// Interrupt service routine result
+	enum class isrReturn_t : igros_dword_t {
+		NONE,					// Not our device
+		HANDLED					// Interrupt handled
+	};
 
-	// Uninstall interrupt service routine handler
+	// Shared interrupt service routine handler type (with device cookie)
+	using isrHandler_t		= std::add_pointer_t<isrReturn_t (const register_t* const, const igros_pointer_t)>;
+
+
+	// Plain handler adapter
+	template<isr_t HANDLE>
+	auto	isrWrap(const register_t* const regs, const igros_pointer_t cookie) noexcept -> isrReturn_t;
+
+	// Install interrupt service routine handler (replaces all others)
+	void	isrHandlerInstall(const igros_usize_t number, const isrHandler_t handle, const igros_pointer_t cookie = nullptr) noexcept;
+	// Uninstall all interrupt service routine handlers
 	void	isrHandlerUninstall(const igros_usize_t number) noexcept;
 
+	// Add shared interrupt service routine handler
+	[[nodiscard]]
+	auto	isrHandlerAdd(const igros_usize_t number, const isrHandler_t handle, const igros_pointer_t cookie) noexcept -> bool;
+	// Remove shared interrupt service routine handler
+	void	isrHandlerRemove(const igros_usize_t number, const isrHandler_t handle, const igros_pointer_t cookie) noexcept;
+
+
+	// Plain handler adapter
+	template<isr_t HANDLE>
+	inline auto isrWrap(const register_t* const regs, [[maybe_unused]] const igros_pointer_t cookie) noexcept -> isrReturn_t {
+		HANDLE(regs);
+		return isrReturn_t::HANDLED;
+	}
+
 
 }	// namespace igros::i386
 
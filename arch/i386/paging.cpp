@@ -23,6 +23,7 @@
 #include <arch/i386/register.hpp>
 // IgrOS-Kernel library
 #include <klib/kAlign.hpp>
+#include <klib/kLock.hpp>
 #include <klib/kmemory.hpp>
 #include <klib/kprint.hpp>
 // IgrOS-Kernel platform
@@ -35,6 +36,28 @@ namespace igros::i386 {
 
 	// Free pages list
 	paging::page_t* paging::mFreePages	{std::bit_cast<page_t*>(&paging::mFreePages)};
+	// Free pages list lock
+	static klib::kSpinlock<>	pagingLock {};
+
+	// Kernel image and heap virtual offset (3Gb -> 0)
+	constexpr auto PAGE_KERNEL_VMA		{0xC0000000_usize};
+	// Kernel stacks area (directory entry 1015, right below devices window)
+	constexpr auto PAGE_STACK_PDE		{1015_usize};
+	constexpr auto PAGE_STACK_AREA		{PAGE_STACK_PDE << paging::PAGE_DIRECTORY_SHIFT};
+	// Present and writable table or page entry
+	constexpr auto PAGE_STACK_ENTRY		{0x00000003_u32};
+	// Stack slot (guard page, then stack pages)
+	constexpr auto PAGE_STACK_SLOT		{paging::STACK_PAGES + 1_usize};
+
+	static_assert(paging::STACK_SLOTS * PAGE_STACK_SLOT <= paging::PAGE_ENTRY_SIZE, "Kernel stacks do not fit single page table!");
+
+
+	// Kernel stacks area table (kernel image, so physical address is known)
+	alignas(paging::PAGE_SIZE) static std::array<igros_dword_t, paging::PAGE_ENTRY_SIZE>	pagingStackPT		{};
+	// Kernel stacks area is linked into page directory
+	static bool				pagingStackReady	{false};
+	// Kernel stacks area link lock
+	static klib::kSpinlock<>		pagingStackLock		{};
 
 
 	// Kernel memory map structure
@@ -159,6 +182,8 @@ namespace igros::i386 {
 	// Allocate page
 	[[nodiscard]]
 	igros_pointer_t paging::allocate() noexcept {
+		// Free pages list is shared by all CPUs
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {pagingLock};
 		// Check if pages exist
 		if (paging::mFreePages->next != paging::mFreePages) {
 			// Get free page
@@ -178,12 +203,46 @@ namespace igros::i386 {
 		if (!klib::kAlign::check(page, PAGE_SHIFT)) {
 			return;
 		}
+		// Free pages list is shared by all CPUs
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {pagingLock};
 		// Deallocate page back to heap free list
 		static_cast<page_t*>(page)->next = paging::mFreePages;
 		paging::mFreePages = static_cast<page_t*>(page);
 	}
 
 
+	// Get kernel stack of slot (mapped on first use, guard page below stays unmapped)
+	[[nodiscard]]
+	auto paging::stack(const igros_usize_t slot) noexcept -> igros_pointer_t {
+		if (slot >= STACK_SLOTS) [[unlikely]] {
+			return nullptr;
+		}
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {pagingStackLock};
+			if (!pagingStackReady) {
+				// Page directory is identity mapped
+				const auto dir			{std::bit_cast<igros_dword_t*>(static_cast<igros_usize_t>(::outCR3() & ~PAGE_MASK))};
+				dir[PAGE_STACK_PDE]		= static_cast<igros_dword_t>(std::bit_cast<igros_usize_t>(pagingStackPT.data()) - PAGE_KERNEL_VMA) | PAGE_STACK_ENTRY;
+				pagingStackReady		= true;
+			}
+		}
+		// Slot belongs to single thread, its first page is guard and never mapped
+		const auto first {slot * PAGE_STACK_SLOT + 1_usize};
+		for (auto i {first}; i < (first + STACK_PAGES); i++) {
+			// Pages stay mapped after thread exit, so slot is never remapped (no TLB shootdown)
+			if (0_u32 == (pagingStackPT[i] & PAGE_STACK_ENTRY)) {
+				const auto page {paging::allocate()};
+				if (nullptr == page) [[unlikely]] {
+					return nullptr;
+				}
+				// Not present entries are never cached, no flush needed
+				pagingStackPT[i] = static_cast<igros_dword_t>(std::bit_cast<igros_usize_t>(page) - PAGE_KERNEL_VMA) | PAGE_STACK_ENTRY;
+			}
+		}
+		return std::bit_cast<igros_pointer_t>(PAGE_STACK_AREA + (first << PAGE_SHIFT));
+	}
+
+
 	// Make page directory
 	[[nodiscard]]
 	paging::directory_t* paging::makeDirectory() noexcept {
@@ -45,6 +45,12 @@ namespace igros::i386 {
 		constexpr static auto	PAGE_SIZE		{1_usize << PAGE_SHIFT};
 		// Page mask
 		constexpr static auto	PAGE_MASK		{PAGE_SIZE - 1_usize};
+		// Kernel stack pages
+		constexpr static auto	STACK_PAGES		{4_usize};
+		// Kernel stack size
+		constexpr static auto	STACK_SIZE		{STACK_PAGES << PAGE_SHIFT};
+		// Kernel stack slots
+		constexpr static auto	STACK_SLOTS		{64_usize};
 
 		// Page directory ID shift
 		constexpr static auto	PAGE_DIRECTORY_SHIFT	{PAGE_SHIFT + PAGE_ENTRY_SHIFT};
@@ -109,7 +115,7 @@ namespace igros::i386 {
 			GLOBAL			= 0x00000100_u32,
 			USER_DEFINED		= 0x00000E00_u32,
 			FLAGS_MASK		= PAGE_MASK,
-			PHYS_ADDR_MASK		= ~PAGE_MASK
+			PHYS_ADDR_MASK		= static_cast<igros_dword_t>(~PAGE_MASK)
 		};
 
 		// Default c-tor
@@ -142,6 +148,10 @@ namespace igros::i386 {
 		// Deallocate page
 		static void	deallocate(const igros_pointer_t page) noexcept;
 
+		// Get kernel stack of slot (mapped on first use, guard page below stays unmapped)
+		[[nodiscard]]
+		static auto	stack(const igros_usize_t slot) noexcept -> igros_pointer_t;
+
 		// Make page directory
 		[[nodiscard]]
 		static auto	makeDirectory() noexcept -> directory_t*;
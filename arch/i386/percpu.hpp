@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////
+//
+//	Per-CPU data area for i386
+//
+//	File:	percpu.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+// i386 namespace
+namespace igros::i386 {
+
+
+	// Per-CPU data block (single CPU, plain memory)
+	struct alignas(64) percpu_t {
+		percpu_t*		self;		// Block linear address (must be first)
+		igros_usize_t		id;		// CPU index
+		igros_dword_t		apicID;		// Local APIC ID
+		igros_dword_t		preemptCount;	// Preemption disable depth
+		igros_dword_t		needResched;	// Reschedule requested
+		igros_dword_t		reserved;	// Reserved
+		igros_usize_t		irqNesting;	// Interrupt nesting depth
+		igros_pointer_t		current;	// Current thread
+	};
+
+
+	// Bootstrap processor data block
+	inline percpu_t	percpuBlock	{&percpuBlock, 0_usize, 0_u32, 0_u32, 0_u32, 0_u32, 0_usize, nullptr};
+
+
+	// Per-CPU variable accessor
+	template<typename T, igros_usize_t OFFSET>
+	class percpu final {
+
+		// Keep same constraints as on SMP capable architectures
+		static_assert(std::is_trivially_copyable_v<T>, "Per-CPU value must be trivially copyable!");
+		static_assert(
+			(1_usize == sizeof(T)) || (2_usize == sizeof(T)) || (4_usize == sizeof(T)) || (8_usize == sizeof(T)),
+			"Per-CPU value must be 1, 2, 4 or 8 bytes long!"
+		);
+		static_assert(0_usize == (OFFSET % sizeof(T)), "Per-CPU value must be naturally aligned!");
+		static_assert((OFFSET + sizeof(T)) <= sizeof(percpu_t), "Per-CPU value is out of block bounds!");
+
+		// Copy c-tor
+		percpu(const percpu &other) = delete;
+		// Copy assignment
+		auto	operator=(const percpu &other) -> percpu& = delete;
+
+		// Move c-tor
+		percpu(percpu &&other) = delete;
+		// Move assignment
+		auto	operator=(percpu &&other) -> percpu& = delete;
+
+
+	public:
+
+		// Default c-tor
+		percpu() noexcept = default;
+
+		// Read value of current CPU
+		[[nodiscard]]
+		static auto	read() noexcept -> T;
+		// Write value of current CPU
+		static void	write(const T value) noexcept;
+		// Add to value of current CPU
+		static void	add(const T value) noexcept requires std::is_integral_v<T>;
+
+		// Get pointer to value of current CPU
+		[[nodiscard]]
+		static auto	ptr() noexcept -> T*;
+
+
+	};
+
+
+	// Init per-CPU data block of current CPU
+	inline void percpuInit(const igros_usize_t id, const igros_dword_t apicID) noexcept {
+		percpuBlock.self	= &percpuBlock;
+		percpuBlock.id		= id;
+		percpuBlock.apicID	= apicID;
+	}
+
+	// Get per-CPU data block of current CPU
+	[[nodiscard]]
+	inline auto percpuSelf() noexcept -> percpu_t* {
+		return &percpuBlock;
+	}
+
+	// Get per-CPU data block of CPU by index
+	[[nodiscard]]
+	inline auto percpuOf([[maybe_unused]] const igros_usize_t id) noexcept -> percpu_t* {
+		return &percpuBlock;
+	}
+
+
+	// Read value of current CPU
+	template<typename T, igros_usize_t OFFSET>
+	[[nodiscard]]
+	inline auto percpu<T, OFFSET>::read() noexcept -> T {
+		return *percpu<T, OFFSET>::ptr();
+	}
+
+	// Write value of current CPU
+	template<typename T, igros_usize_t OFFSET>
+	inline void percpu<T, OFFSET>::write(const T value) noexcept {
+		*percpu<T, OFFSET>::ptr() = value;
+	}
+
+	// Add to value of current CPU
+	template<typename T, igros_usize_t OFFSET>
+	inline void percpu<T, OFFSET>::add(const T value) noexcept requires std::is_integral_v<T> {
+		*percpu<T, OFFSET>::ptr() += value;
+	}
+
+	// Get pointer to value of current CPU
+	template<typename T, igros_usize_t OFFSET>
+	[[nodiscard]]
+	inline auto percpu<T, OFFSET>::ptr() noexcept -> T* {
+		return std::bit_cast<T*>(std::bit_cast<igros_usize_t>(&percpuBlock) + OFFSET);
+	}
+
+
+}	// namespace igros::i386
+
@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////////
+//
+//	Symmetric multiprocessing for i386
+//
+//	File:	smp.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+// IgrOS-Kernel arch i386
+#include <arch/i386/cpu.hpp>
+#include <arch/i386/irq.hpp>
+// IgrOS-Kernel library
+#include <klib/kRCU.hpp>
+// IgrOS-Kernel system
+#include <sys/clockevent.hpp>
+#include <sys/sched.hpp>
+#include <sys/softirq.hpp>
+
+
+// i386 namespace
+namespace igros::i386 {
+
+
+	// Max number of supported CPUs (no application processors bring-up on i386)
+	constexpr auto SMP_MAX_CPUS		{1_usize};
+
+
+	// SMP structure
+	class smp final {
+
+		// Copy c-tor
+		smp(const smp &other) = delete;
+		// Copy assignment
+		auto	operator=(const smp &other) -> smp& = delete;
+
+		// Move c-tor
+		smp(smp &&other) = delete;
+		// Move assignment
+		auto	operator=(smp &&other) -> smp& = delete;
+
+
+	public:
+
+		// Max number of supported CPUs
+		constexpr static auto MAX_CPUS {SMP_MAX_CPUS};
+
+		// Default c-tor
+		smp() noexcept = default;
+
+		// Init SMP
+		static void	init() noexcept;
+
+		// CPU idle loop
+		[[noreturn]]
+		static void	idle() noexcept;
+
+		// Get current CPU index
+		[[nodiscard]]
+		static auto	id() noexcept -> igros_usize_t;
+		// Get number of online CPUs
+		[[nodiscard]]
+		static auto	count() noexcept -> igros_usize_t;
+		// Get online CPUs mask
+		[[nodiscard]]
+		static auto	online() noexcept -> igros_quad_t;
+		// Check if CPU is online
+		[[nodiscard]]
+		static bool	isOnline(const igros_usize_t id) noexcept;
+
+		// Wake up idle CPU
+		static void	kick(const igros_usize_t id) noexcept;
+
+
+	};
+
+
+	// Init SMP
+	inline void smp::init() noexcept {
+		// Only bootstrap processor is used
+	}
+
+
+	// CPU idle loop
+	[[noreturn]]
+	inline void smp::idle() noexcept {
+		// Sleep till interrupt
+		while (true) {
+			irq::disable();
+			// Softirqs raised outside interrupts (or left over) run before sleep
+			if (sys::softirqPending()) {
+				sys::softirqRun();
+				sys::sched::schedule();
+				continue;
+			}
+			// Idle CPU is in extended quiescent state
+			klib::kRCU::idleEnter();
+			// No tick while asleep
+			sys::tickIdleEnter();
+			cpu::idle();
+			irq::disable();
+			sys::tickIdleExit();
+			klib::kRCU::idleExit();
+			// Run ready threads (also reports RCU quiescent state)
+			sys::sched::schedule();
+		}
+	}
+
+
+	// Get current CPU index
+	[[nodiscard]]
+	inline auto smp::id() noexcept -> igros_usize_t {
+		return 0_usize;
+	}
+
+	// Get number of online CPUs
+	[[nodiscard]]
+	inline auto smp::count() noexcept -> igros_usize_t {
+		return 1_usize;
+	}
+
+	// Get online CPUs mask
+	[[nodiscard]]
+	inline auto smp::online() noexcept -> igros_quad_t {
+		return 1_u64;
+	}
+
+	// Check if CPU is online
+	[[nodiscard]]
+	inline bool smp::isOnline(const igros_usize_t id) noexcept {
+		return 0_usize == id;
+	}
+
+	// Wake up idle CPU
+	inline void smp::kick([[maybe_unused]] const igros_usize_t id) noexcept {
+		// No other CPUs to wake up
+	}
+
+
+}	// namespace igros::i386
+
@@ -22,6 +22,8 @@
 #include <arch/x86_64/irq.hpp>
 // IgrOS-Kernel library
 #include <klib/kSingleton.hpp>
+// IgrOS-Kernel system
+#include <sys/irqtrace.hpp>
 
 
 // Arch namespace
@@ -49,6 +51,10 @@ namespace igros::arch {
 		using irq_t = T2;
 		// IRQ ISR type
 		using isr_t = std::add_pointer_t<void(const register_t*)>;
+		// Shared IRQ handler result
+		using return_t = typename T::return_t;
+		// Shared IRQ handler type (with device cookie)
+		using handler_t = typename T::handler_t;
 
 		// Default c-tor
 		interrupts_t() noexcept = default;
@@ -57,6 +63,11 @@ namespace igros::arch {
 		void	enable() const noexcept;
 		// Disable interrupts
 		void	disable() const noexcept;
+		// Save interrupts state and disable interrupts
+		[[nodiscard]]
+		auto	save() const noexcept -> igros_usize_t;
+		// Restore interrupts state
+		void	restore(const igros_usize_t flags) const noexcept;
 
 		// Mask interrupt
 		void	mask(const irq_t number) const noexcept;
@@ -76,6 +87,12 @@ namespace igros::arch {
 		template<irq_t N>
 		void	uninstall() const noexcept;
 
+		// Add shared IRQ handler
+		[[nodiscard]]
+		auto	add(const irq_t number, const handler_t handler, const igros_pointer_t cookie = nullptr) const noexcept -> bool;
+		// Remove shared IRQ handler
+		void	remove(const irq_t number, const handler_t handler, const igros_pointer_t cookie = nullptr) const noexcept;
+
 		// IRQ done (EOI)
 		void	eoi(const irq_t number) const noexcept;
 
@@ -86,6 +103,7 @@ namespace igros::arch {
 	// Enable interrupts
 	template<class T, class T2>
 	inline void interrupts_t<T, T2>::enable() const noexcept {
+		sys::irqTraceOn();
 		T::enable();
 	}
 
@@ -93,6 +111,23 @@ namespace igros::arch {
 	template<class T, class T2>
 	inline void interrupts_t<T, T2>::disable() const noexcept {
 		T::disable();
+		sys::irqTraceOff();
+	}
+
+	// Save interrupts state and disable interrupts
+	template<class T, class T2>
+	[[nodiscard]]
+	inline auto interrupts_t<T, T2>::save() const noexcept -> igros_usize_t {
+		const auto flags {T::save()};
+		sys::irqTraceSave(flags);
+		return flags;
+	}
+
+	// Restore interrupts state
+	template<class T, class T2>
+	inline void interrupts_t<T, T2>::restore(const igros_usize_t flags) const noexcept {
+		sys::irqTraceRestore(flags);
+		T::restore(flags);
 	}
 
 
@@ -138,6 +173,20 @@ namespace igros::arch {
 	}
 
 
+	// Add shared IRQ handler
+	template<class T, class T2>
+	[[nodiscard]]
+	inline auto interrupts_t<T, T2>::add(const irq_t number, const handler_t handler, const igros_pointer_t cookie) const noexcept -> bool {
+		return T::add(number, handler, cookie);
+	}
+
+	// Remove shared IRQ handler
+	template<class T, class T2>
+	inline void interrupts_t<T, T2>::remove(const irq_t number, const handler_t handler, const igros_pointer_t cookie) const noexcept {
+		T::remove(number, handler, cookie);
+	}
+
+
 	// IRQ done (EOI)
 	template<class T, class T2>
 	inline void interrupts_t<T, T2>::eoi(const irq_t number) const noexcept {
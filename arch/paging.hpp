@@ -47,6 +47,15 @@ namespace igros::arch {
 		using virt_t = igros_pointer_t;
 		// Physical address pointer
 		using phys_t = igros_pointer_t;
+		// Page flags
+		using flags_t = typename T::FLAGS;
+
+		// Page size
+		constexpr static auto PAGE_SIZE {T::PAGE_SIZE};
+		// Kernel stack size
+		constexpr static auto STACK_SIZE {T::STACK_SIZE};
+		// Kernel stack slots
+		constexpr static auto STACK_SLOTS {T::STACK_SLOTS};
 
 		// Default c-tor
 		paging_t() noexcept = default;
@@ -69,6 +78,17 @@ namespace igros::arch {
 		// Flush paging data
 		void	flush(const phys_t addr) noexcept;
 
+		// Add memory to pages heap
+		void	heap(const phys_t phys, const igros_usize_t size) const noexcept;
+		// Allocate page
+		[[nodiscard]]
+		auto	allocate() const noexcept -> virt_t;
+		// Deallocate page
+		void	deallocate(const virt_t page) const noexcept;
+		// Get kernel stack of slot (mapped on first use, guard page below stays unmapped)
+		[[nodiscard]]
+		auto	stack(const igros_usize_t slot) const noexcept -> virt_t;
+
 
 	};
 
@@ -115,6 +135,33 @@ namespace igros::arch {
 	}
 
 
+	// Add memory to pages heap
+	template<class T>
+	void paging_t<T>::heap(const phys_t phys, const igros_usize_t size) const noexcept {
+		T::heap(phys, size);
+	}
+
+	// Allocate page
+	template<class T>
+	[[nodiscard]]
+	auto paging_t<T>::allocate() const noexcept -> paging_t<T>::virt_t {
+		return T::allocate();
+	}
+
+	// Deallocate page
+	template<class T>
+	void paging_t<T>::deallocate(const virt_t page) const noexcept {
+		T::deallocate(page);
+	}
+
+	// Get kernel stack of slot (mapped on first use, guard page below stays unmapped)
+	template<class T>
+	[[nodiscard]]
+	auto paging_t<T>::stack(const igros_usize_t slot) const noexcept -> paging_t<T>::virt_t {
+		return T::stack(slot);
+	}
+
+
 #if	defined (IGROS_ARCH_i386)
 
 	// Paging type
@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////////
+//
+//	Per-CPU data area
+//
+//	File:	percpu.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <cstddef>
+// IgrOS-Kernel arch i386
+#include <arch/i386/percpu.hpp>
+// IgrOS-Kernel arch x86_64
+#include <arch/x86_64/percpu.hpp>
+
+
+// Arch namespace
+namespace igros::arch {
+
+
+#if	defined (IGROS_ARCH_i386)
+
+	// Per-CPU data block type
+	using percpu_t	= i386::percpu_t;
+
+	// Per-CPU variable accessor type
+	template<typename T, igros_usize_t OFFSET>
+	using percpu	= i386::percpu<T, OFFSET>;
+
+	// Get per-CPU data block of current CPU
+	using i386::percpuSelf;
+	// Get per-CPU data block of CPU by index
+	using i386::percpuOf;
+
+#elif	defined (IGROS_ARCH_x86_64)
+
+	// Per-CPU data block type
+	using percpu_t	= x86_64::percpu_t;
+
+	// Per-CPU variable accessor type
+	template<typename T, igros_usize_t OFFSET>
+	using percpu	= x86_64::percpu<T, OFFSET>;
+
+	// Get per-CPU data block of current CPU
+	using x86_64::percpuSelf;
+	// Get per-CPU data block of CPU by index
+	using x86_64::percpuOf;
+
+#else
+
+	static_assert(
+		false,
+		"Unknown architecture!"
+	);
+
+	// Per-CPU data block type
+	using percpu_t	= void;
+
+#endif
+
+
+	// Current CPU index
+	using percpuID		= percpu<igros_usize_t, offsetof(percpu_t, id)>;
+	// Current CPU preemption disable depth
+	using percpuPreempt	= percpu<igros_dword_t, offsetof(percpu_t, preemptCount)>;
+	// Current CPU reschedule request
+	using percpuNeedResched	= percpu<igros_dword_t, offsetof(percpu_t, needResched)>;
+	// Current CPU interrupt nesting depth
+	using percpuIRQNesting	= percpu<igros_usize_t, offsetof(percpu_t, irqNesting)>;
+	// Current CPU running thread
+	using percpuCurrent	= percpu<igros_pointer_t, offsetof(percpu_t, current)>;
+
+
+}	// namespace igros::arch
+
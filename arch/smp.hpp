@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////
+//
+//	Symmetric multiprocessing
+//
+//	File:	smp.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch i386
+#include <arch/i386/smp.hpp>
+// IgrOS-Kernel arch x86_64
+#include <arch/x86_64/smp.hpp>
+// IgrOS-Kernel library
+#include <klib/kSingleton.hpp>
+
+
+// Arch namespace
+namespace igros::arch {
+
+
+	// SMP description type
+	template<class T>
+	class smp_t final : public klib::kSingleton<smp_t<T>> {
+
+		// No copy construction
+		smp_t(const smp_t &other) noexcept = delete;
+		// No copy assignment
+		smp_t& operator=(const smp_t &other) noexcept = delete;
+
+		// No move construction
+		smp_t(smp_t &&other) noexcept = delete;
+		// No move assignment
+		smp_t& operator=(smp_t &&other) noexcept = delete;
+
+
+	public:
+
+		// Max number of supported CPUs
+		constexpr static auto MAX_CPUS {T::MAX_CPUS};
+
+		// Default c-tor
+		smp_t() noexcept = default;
+
+		// Init SMP
+		void	init() const noexcept;
+
+		// CPU idle loop
+		[[noreturn]]
+		void	idle() const noexcept;
+
+		// Get current CPU index
+		[[nodiscard]]
+		auto	id() const noexcept -> igros_usize_t;
+		// Get number of online CPUs
+		[[nodiscard]]
+		auto	count() const noexcept -> igros_usize_t;
+		// Get online CPUs mask
+		[[nodiscard]]
+		auto	online() const noexcept -> igros_quad_t;
+		// Check if CPU is online
+		[[nodiscard]]
+		bool	isOnline(const igros_usize_t id) const noexcept;
+
+		// Wake up idle CPU
+		void	kick(const igros_usize_t id) const noexcept;
+
+
+	};
+
+
+	// Init SMP
+	template<class T>
+	inline void smp_t<T>::init() const noexcept {
+		T::init();
+	}
+
+
+	// CPU idle loop
+	template<class T>
+	[[noreturn]]
+	inline void smp_t<T>::idle() const noexcept {
+		T::idle();
+	}
+
+
+	// Get current CPU index
+	template<class T>
+	[[nodiscard]]
+	inline auto smp_t<T>::id() const noexcept -> igros_usize_t {
+		return T::id();
+	}
+
+	// Get number of online CPUs
+	template<class T>
+	[[nodiscard]]
+	inline auto smp_t<T>::count() const noexcept -> igros_usize_t {
+		return T::count();
+	}
+
+	// Get online CPUs mask
+	template<class T>
+	[[nodiscard]]
+	inline auto smp_t<T>::online() const noexcept -> igros_quad_t {
+		return T::online();
+	}
+
+	// Check if CPU is online
+	template<class T>
+	[[nodiscard]]
+	inline bool smp_t<T>::isOnline(const igros_usize_t id) const noexcept {
+		return T::isOnline(id);
+	}
+
+	// Wake up idle CPU
+	template<class T>
+	inline void smp_t<T>::kick(const igros_usize_t id) const noexcept {
+		T::kick(id);
+	}
+
+
+#if	defined (IGROS_ARCH_i386)
+
+	// SMP type
+	using smp	= smp_t<i386::smp>;
+
+#elif	defined (IGROS_ARCH_x86_64)
+
+	// SMP type
+	using smp	= smp_t<x86_64::smp>;
+
+#else
+
+	static_assert(
+		false,
+		"Unknown architecture!"
+	);
+
+	// SMP type
+	using smp	= smp_t<void>;
+
+#endif
+
+
+}	// namespace igros::arch
+
@@ -0,0 +1,285 @@
+////////////////////////////////////////////////////////////////
+//
+//	Local APIC for x86_64
+//
+//	File:	apic.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <bit>
+// IgrOS-Kernel arch x86_64
+#include <arch/x86_64/apic.hpp>
+#include <arch/x86_64/cpu.hpp>
+#include <arch/x86_64/cpuid.hpp>
+#include <arch/x86_64/io.hpp>
+#include <arch/x86_64/irq.hpp>
+#include <arch/x86_64/isr.hpp>
+#include <arch/x86_64/msr.hpp>
+// IgrOS-Kernel drivers
+#include <drivers/clock/pit.hpp>
+#include <drivers/clock/tsc.hpp>
+// IgrOS-Kernel library
+#include <klib/kprint.hpp>
+// IgrOS-Kernel system
+#include <sys/clockevent.hpp>
+
+
+// x86_64 namespace
+namespace igros::x86_64 {
+
+
+	// IA32_APIC_BASE MSR
+	constexpr auto APIC_BASE_MSR		{0x0000001B_u32};
+	// Local APIC global enable bit
+	constexpr auto APIC_BASE_ENABLE		{0x0000000000000800_u64};
+	// Local APIC base address mask
+	constexpr auto APIC_BASE_MASK		{0x0000000FFFFFF000_u64};
+
+	// Spurious vector register APIC software enable bit
+	constexpr auto APIC_SVR_ENABLE		{0x00000100_u32};
+
+	// ICR delivery status bit
+	constexpr auto APIC_ICR_PENDING		{0x00001000_u32};
+	// ICR INIT (level assert) command
+	constexpr auto APIC_ICR_INIT		{0x00004500_u32};
+	// ICR STARTUP command
+	constexpr auto APIC_ICR_STARTUP		{0x00004600_u32};
+	// ICR fixed delivery (level assert) command
+	constexpr auto APIC_ICR_FIXED		{0x00004000_u32};
+
+	// LVT timer TSC-deadline mode
+	constexpr auto APIC_TIMER_DEADLINE	{0x00040000_u32};
+	// IA32_TSC_DEADLINE MSR
+	constexpr auto APIC_DEADLINE_MSR	{0x000006E0_u32};
+	// TSC-deadline timer support (CPUID.01h:ECX[24])
+	constexpr auto APIC_CPUID_DEADLINE	{0x01000000_u32};
+
+	// LVT timer masked bit
+	constexpr auto APIC_TIMER_MASKED	{0x00010000_u32};
+	// Timer divide configuration (bus clock / 16)
+	constexpr auto APIC_TIMER_DIVIDE_16	{0x00000003_u32};
+	// Timer max initial count
+	constexpr auto APIC_TIMER_COUNT_MAX	{0xFFFFFFFF_u32};
+	// Timer calibration window (PIT ticks, ~10 ms)
+	constexpr auto APIC_TIMER_CALIBRATE	{11932_u16};
+
+
+	// Local APIC registers base
+	igros_byte_t*	apic::mBase	{nullptr};
+
+
+	// Init local APIC of current CPU
+	void apic::init() noexcept {
+		// Get local APIC base
+		const auto base {::outMSR(APIC_BASE_MSR)};
+		// Make sure local APIC is globally enabled
+		if (0_u64 == (base & APIC_BASE_ENABLE)) {
+			::inMSR(APIC_BASE_MSR, base | APIC_BASE_ENABLE);
+		}
+		// Save registers base (identity mapped)
+		apic::mBase = std::bit_cast<igros_byte_t*>(static_cast<igros_usize_t>(base & APIC_BASE_MASK));
+		// Accept all interrupts
+		apic::write(apicRegister_t::TPR, 0_u32);
+		// Software enable local APIC
+		apic::write(apicRegister_t::SVR, APIC_SVR_ENABLE | static_cast<igros_dword_t>(APIC_SPURIOUS_VECTOR));
+	}
+
+
+	// Check if local APIC is available
+	[[nodiscard]]
+	bool apic::isAvailable() noexcept {
+		return nullptr != apic::mBase;
+	}
+
+
+	// Read local APIC register
+	[[nodiscard]]
+	auto apic::read(const apicRegister_t reg) noexcept -> igros_dword_t {
+		return io::readMemory32(std::bit_cast<const igros_dword_t*>(apic::mBase + static_cast<igros_usize_t>(reg)));
+	}
+
+	// Write local APIC register
+	void apic::write(const apicRegister_t reg, const igros_dword_t value) noexcept {
+		io::writeMemory32(std::bit_cast<igros_dword_t*>(apic::mBase + static_cast<igros_usize_t>(reg)), value);
+	}
+
+
+	// Get local APIC ID of current CPU
+	[[nodiscard]]
+	auto apic::id() noexcept -> igros_dword_t {
+		return apic::read(apicRegister_t::ID) >> 24;
+	}
+
+
+	// Send EOI
+	void apic::eoi() noexcept {
+		apic::write(apicRegister_t::EOI, 0_u32);
+	}
+
+
+	// Send inter-processor interrupt
+	void apic::sendIPI(const igros_dword_t apicID, const igros_dword_t command) noexcept {
+		// Set destination
+		apic::write(apicRegister_t::ICR_HIGH, apicID << 24);
+		// Send command
+		apic::write(apicRegister_t::ICR_LOW, command);
+		// Wait for delivery
+		while (0_u32 != (apic::read(apicRegister_t::ICR_LOW) & APIC_ICR_PENDING)) {
+			cpu::pause();
+		}
+	}
+
+	// Send INIT IPI
+	void apic::sendInit(const igros_dword_t apicID) noexcept {
+		apic::sendIPI(apicID, APIC_ICR_INIT);
+	}
+
+	// Send STARTUP IPI
+	void apic::sendStartup(const igros_dword_t apicID, const igros_byte_t page) noexcept {
+		apic::sendIPI(apicID, APIC_ICR_STARTUP | page);
+	}
+
+	// Send fixed vector IPI
+	void apic::sendFixed(const igros_dword_t apicID, const igros_byte_t vector) noexcept {
+		apic::sendIPI(apicID, APIC_ICR_FIXED | vector);
+	}
+
+
+
+	// Local APIC timer to TSC-deadline mode (current CPU)
+	static void apicTimerInit() noexcept {
+		apic::write(apicRegister_t::LVT_TIMER, APIC_TIMER_DEADLINE | static_cast<igros_dword_t>(APIC_TIMER_VECTOR));
+	}
+
+	// Fire local APIC timer once after given nanoseconds (current CPU)
+	static void apicTimerProgram(const igros_quad_t ns) noexcept {
+		// Delay is at most a second, so product fits quad
+		::inMSR(APIC_DEADLINE_MSR, cpu::timestamp() + (ns * arch::tscFrequency()) / sys::NSEC_PER_SEC);
+	}
+
+	// Disarm local APIC timer (current CPU)
+	static void apicTimerStop() noexcept {
+		::inMSR(APIC_DEADLINE_MSR, 0_u64);
+	}
+
+	// Local APIC timer interrupt handler
+	[[nodiscard]]
+	static auto apicTimerHandler([[maybe_unused]] const register_t* const regs, [[maybe_unused]] const igros_pointer_t cookie) noexcept -> isrReturn_t {
+		sys::tickHandler();
+		return isrReturn_t::HANDLED;
+	}
+
+	// TSC-deadline clock event (every CPU has own local APIC timer)
+	static sys::clockevent_t	apicClockevent	{"TSC-deadline", apicTimerInit, apicTimerProgram, apicTimerStop, sys::NSEC_PER_SEC, 300_u32, true};
+
+
+	// Local APIC timer count frequency (Hz, same on all CPUs)
+	static igros_quad_t	apicTimerFrequency	{0_u64};
+
+
+	// Local APIC timer to one-shot mode (current CPU)
+	static void apicOneshotInit() noexcept {
+		apic::write(apicRegister_t::TIMER_DIVIDE, APIC_TIMER_DIVIDE_16);
+		apic::write(apicRegister_t::LVT_TIMER, static_cast<igros_dword_t>(APIC_TIMER_VECTOR));
+	}
+
+	// Fire local APIC timer once after given nanoseconds (current CPU)
+	static void apicOneshotProgram(const igros_quad_t ns) noexcept {
+		// Delay is at most max delta, so count fits dword
+		const auto count {(ns * apicTimerFrequency) / sys::NSEC_PER_SEC};
+		// Zero count disarms timer
+		apic::write(apicRegister_t::TIMER_INITIAL, (0_u64 != count) ? static_cast<igros_dword_t>(count) : 1_u32);
+	}
+
+	// Disarm local APIC timer (current CPU)
+	static void apicOneshotStop() noexcept {
+		apic::write(apicRegister_t::TIMER_INITIAL, 0_u32);
+	}
+
+	// Local APIC one-shot clock event (no TSC-deadline, max delta set by calibration)
+	static sys::clockevent_t	apicOneshotClockevent	{"LAPIC", apicOneshotInit, apicOneshotProgram, apicOneshotStop, 0_u64, 200_u32, true};
+
+
+	// Measure local APIC timer frequency over one PIT window (current CPU)
+	[[nodiscard]]
+	static auto apicTimerCalibrate() noexcept -> igros_quad_t {
+		apic::write(apicRegister_t::TIMER_DIVIDE, APIC_TIMER_DIVIDE_16);
+		apic::write(apicRegister_t::LVT_TIMER, APIC_TIMER_MASKED | static_cast<igros_dword_t>(APIC_TIMER_VECTOR));
+		// Nothing may stretch window
+		const auto flags	{irq::save()};
+		apic::write(apicRegister_t::TIMER_INITIAL, APIC_TIMER_COUNT_MAX);
+		arch::pitDelayTicks(APIC_TIMER_CALIBRATE);
+		const auto left		{apic::read(apicRegister_t::TIMER_CURRENT)};
+		apic::write(apicRegister_t::TIMER_INITIAL, 0_u32);
+		irq::restore(flags);
+		// Hz = counts * PIT Hz / PIT ticks
+		return ((APIC_TIMER_COUNT_MAX - left) * static_cast<igros_quad_t>(arch::PIT_MAIN_FREQUENCY)) / APIC_TIMER_CALIBRATE;
+	}
+
+	// Setup local APIC one-shot timer tick when there is no TSC-deadline (all CPUs)
+	static void apicOneshotSetup() noexcept {
+		apicTimerFrequency = apicTimerCalibrate();
+		if (0_u64 == apicTimerFrequency) {
+			klib::kprintf("APIC:\t\tlocal timer calibration failed\n");
+			return;
+		}
+		// Longest delay full count lasts
+		apicOneshotClockevent.maxDelta = (static_cast<igros_quad_t>(APIC_TIMER_COUNT_MAX) * sys::NSEC_PER_SEC) / apicTimerFrequency;
+		klib::kprintf("APIC:\t\tlocal timer %llu Hz\n", apicTimerFrequency);
+		isrHandlerInstall(APIC_TIMER_VECTOR, apicTimerHandler);
+		sys::clockeventRegister(apicOneshotClockevent);
+	}
+
+
+	// Setup local APIC timer tick (all CPUs)
+	void apic::timerSetup() noexcept {
+		if (!apic::isAvailable()) {
+			return;
+		}
+		// Without TSC-deadline application processors still need own timer
+		if (0_u32 == (cpuid(cpuidFlags_t::INFO_PROC_VERSION).ecx & APIC_CPUID_DEADLINE)) {
+			klib::kprintf("APIC:\t\tno TSC-deadline timer, using one-shot mode\n");
+			apicOneshotSetup();
+			return;
+		}
+		// Deadline is in TSC cycles, so it must be calibrated
+		if (0_u64 == arch::tscFrequency()) {
+			klib::kprintf("APIC:\t\tTSC not calibrated, using one-shot mode\n");
+			apicOneshotSetup();
+			return;
+		}
+		isrHandlerInstall(APIC_TIMER_VECTOR, apicTimerHandler);
+		sys::clockeventRegister(apicClockevent);
+	}
+
+
+}	// namespace igros::x86_64
+
+
+#ifdef	__cplusplus
+
+extern "C" {
+
+#endif	// __cplusplus
+
+
+	// Local APIC wake up interrupt acknowledge
+	void apicWakeupInterrupt() noexcept {
+		// Per-CPU clock event registered by other CPU (busy CPU never idles)
+		igros::sys::tickKick();
+		igros::x86_64::apic::eoi();
+	}
+
+
+#ifdef	__cplusplus
+
+}	// extern "C"
+
+#endif	// __cplusplus
+
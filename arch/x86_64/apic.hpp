@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////
+//
+//	Local APIC for x86_64
+//
+//	File:	apic.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+#ifdef	__cplusplus
+
+extern "C" {
+
+#endif	// __cplusplus
+
+
+	// Local APIC spurious interrupt handler
+	void	apicSpuriousHandler() noexcept;
+	// Local APIC wake up interrupt handler
+	void	apicWakeupHandler() noexcept;
+	// Local APIC wake up interrupt acknowledge
+	void	apicWakeupInterrupt() noexcept;
+
+
+#ifdef	__cplusplus
+
+}	// extern "C"
+
+#endif	// __cplusplus
+
+
+// x86_64 namespace
+namespace igros::x86_64 {
+
+
+	// Local APIC spurious interrupt vector
+	constexpr auto APIC_SPURIOUS_VECTOR	{0xFF_usize};
+	// Local APIC wake up (idle CPU kick) vector
+	constexpr auto APIC_WAKEUP_VECTOR	{0xF0_usize};
+	// Local APIC timer (TSC-deadline tick) vector
+	constexpr auto APIC_TIMER_VECTOR	{0xEF_usize};
+
+
+	// Local APIC registers enumeration
+	enum class apicRegister_t : igros_dword_t {
+		ID		= 0x0020_u32,
+		VERSION		= 0x0030_u32,
+		TPR		= 0x0080_u32,
+		EOI		= 0x00B0_u32,
+		SVR		= 0x00F0_u32,
+		ESR		= 0x0280_u32,
+		ICR_LOW		= 0x0300_u32,
+		ICR_HIGH	= 0x0310_u32,
+		LVT_TIMER	= 0x0320_u32,
+		LVT_LINT0	= 0x0350_u32,
+		LVT_LINT1	= 0x0360_u32,
+		LVT_ERROR	= 0x0370_u32,
+		TIMER_INITIAL	= 0x0380_u32,
+		TIMER_CURRENT	= 0x0390_u32,
+		TIMER_DIVIDE	= 0x03E0_u32
+	};
+
+
+	// Local APIC structure
+	class apic final {
+
+		// Local APIC registers base
+		static igros_byte_t*	mBase;
+
+		// Copy c-tor
+		apic(const apic &other) = delete;
+		// Copy assignment
+		auto	operator=(const apic &other) -> apic& = delete;
+
+		// Move c-tor
+		apic(apic &&other) = delete;
+		// Move assignment
+		auto	operator=(apic &&other) -> apic& = delete;
+
+
+	public:
+
+		// Default c-tor
+		apic() noexcept = default;
+
+		// Init local APIC of current CPU
+		static void	init() noexcept;
+
+		// Check if local APIC is available
+		[[nodiscard]]
+		static bool	isAvailable() noexcept;
+
+		// Read local APIC register
+		[[nodiscard]]
+		static auto	read(const apicRegister_t reg) noexcept -> igros_dword_t;
+		// Write local APIC register
+		static void	write(const apicRegister_t reg, const igros_dword_t value) noexcept;
+
+		// Get local APIC ID of current CPU
+		[[nodiscard]]
+		static auto	id() noexcept -> igros_dword_t;
+
+		// Send EOI
+		static void	eoi() noexcept;
+
+		// Send inter-processor interrupt
+		static void	sendIPI(const igros_dword_t apicID, const igros_dword_t command) noexcept;
+		// Send INIT IPI
+		static void	sendInit(const igros_dword_t apicID) noexcept;
+		// Send STARTUP IPI
+		static void	sendStartup(const igros_dword_t apicID, const igros_byte_t page) noexcept;
+		// Send fixed vector IPI
+		static void	sendFixed(const igros_dword_t apicID, const igros_byte_t vector) noexcept;
+
+		// Setup local APIC timer tick (all CPUs)
+		static void	timerSetup() noexcept;
+
+
+	};
+
+
+}	// namespace igros::x86_64
+
@@ -0,0 +1,236 @@
+////////////////////////////////////////////////////////////////
+//
+//	Atomic memory operations
+//
+//	File:	atomic.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+#ifdef	__cplusplus
+
+extern "C" {
+
+#endif	// __cplusplus
+
+
+	// Atomically load long
+	[[nodiscard]]
+	auto	atomicLoad32(const igros::igros_dword_t* const addr) noexcept -> igros::igros_dword_t;
+	// Atomically load quad
+	[[nodiscard]]
+	auto	atomicLoad64(const igros::igros_quad_t* const addr) noexcept -> igros::igros_quad_t;
+
+	// Atomically store long
+	void	atomicStore32(igros::igros_dword_t* const addr, const igros::igros_dword_t value) noexcept;
+	// Atomically store quad
+	void	atomicStore64(igros::igros_quad_t* const addr, const igros::igros_quad_t value) noexcept;
+	// Atomically store long (release)
+	void	atomicStoreRelease32(igros::igros_dword_t* const addr, const igros::igros_dword_t value) noexcept;
+	// Atomically store quad (release)
+	void	atomicStoreRelease64(igros::igros_quad_t* const addr, const igros::igros_quad_t value) noexcept;
+
+	// Atomically exchange long
+	auto	atomicExchange32(igros::igros_dword_t* const addr, const igros::igros_dword_t value) noexcept -> igros::igros_dword_t;
+	// Atomically exchange quad
+	auto	atomicExchange64(igros::igros_quad_t* const addr, const igros::igros_quad_t value) noexcept -> igros::igros_quad_t;
+
+	// Atomically compare and exchange long
+	auto	atomicCompareExchange32(igros::igros_dword_t* const addr, const igros::igros_dword_t expected, const igros::igros_dword_t desired) noexcept -> igros::igros_dword_t;
+	// Atomically compare and exchange quad
+	auto	atomicCompareExchange64(igros::igros_quad_t* const addr, const igros::igros_quad_t expected, const igros::igros_quad_t desired) noexcept -> igros::igros_quad_t;
+
+	// Atomically add to long
+	auto	atomicFetchAdd32(igros::igros_dword_t* const addr, const igros::igros_dword_t value) noexcept -> igros::igros_dword_t;
+	// Atomically add to quad
+	auto	atomicFetchAdd64(igros::igros_quad_t* const addr, const igros::igros_quad_t value) noexcept -> igros::igros_quad_t;
+
+	// Atomically OR long
+	void	atomicOr32(igros::igros_dword_t* const addr, const igros::igros_dword_t value) noexcept;
+	// Atomically OR quad
+	void	atomicOr64(igros::igros_quad_t* const addr, const igros::igros_quad_t value) noexcept;
+
+	// Atomically AND long
+	void	atomicAnd32(igros::igros_dword_t* const addr, const igros::igros_dword_t value) noexcept;
+	// Atomically AND quad
+	void	atomicAnd64(igros::igros_quad_t* const addr, const igros::igros_quad_t value) noexcept;
+
+
+#ifdef	__cplusplus
+
+}	// extern "C"
+
+#endif	// __cplusplus
+
+
+// x86_64 namespace
+namespace igros::x86_64 {
+
+
+	// Atomic operations structure
+	class atomic final {
+
+		// Copy c-tor
+		atomic(const atomic &other) = delete;
+		// Copy assignment
+		atomic& operator=(const atomic &other) = delete;
+
+		// Move c-tor
+		atomic(atomic &&other) = delete;
+		// Move assignment
+		atomic& operator=(atomic &&other) = delete;
+
+
+	public:
+
+		// Default c-tor
+		atomic() noexcept = default;
+
+		// Atomically load long
+		[[nodiscard]]
+		static auto	load(const igros_dword_t* const addr) noexcept -> igros_dword_t;
+		// Atomically load quad
+		[[nodiscard]]
+		static auto	load(const igros_quad_t* const addr) noexcept -> igros_quad_t;
+
+		// Atomically store long
+		static void	store(igros_dword_t* const addr, const igros_dword_t value) noexcept;
+		// Atomically store quad
+		static void	store(igros_quad_t* const addr, const igros_quad_t value) noexcept;
+		// Atomically store long (release)
+		static void	storeRelease(igros_dword_t* const addr, const igros_dword_t value) noexcept;
+		// Atomically store quad (release)
+		static void	storeRelease(igros_quad_t* const addr, const igros_quad_t value) noexcept;
+
+		// Atomically exchange long
+		static auto	exchange(igros_dword_t* const addr, const igros_dword_t value) noexcept -> igros_dword_t;
+		// Atomically exchange quad
+		static auto	exchange(igros_quad_t* const addr, const igros_quad_t value) noexcept -> igros_quad_t;
+
+		// Atomically compare and exchange long
+		static auto	compareExchange(igros_dword_t* const addr, const igros_dword_t expected, const igros_dword_t desired) noexcept -> igros_dword_t;
+		// Atomically compare and exchange quad
+		static auto	compareExchange(igros_quad_t* const addr, const igros_quad_t expected, const igros_quad_t desired) noexcept -> igros_quad_t;
+
+		// Atomically add to long
+		static auto	fetchAdd(igros_dword_t* const addr, const igros_dword_t value) noexcept -> igros_dword_t;
+		// Atomically add to quad
+		static auto	fetchAdd(igros_quad_t* const addr, const igros_quad_t value) noexcept -> igros_quad_t;
+
+		// Atomically OR long
+		static void	bitOr(igros_dword_t* const addr, const igros_dword_t value) noexcept;
+		// Atomically OR quad
+		static void	bitOr(igros_quad_t* const addr, const igros_quad_t value) noexcept;
+
+		// Atomically AND long
+		static void	bitAnd(igros_dword_t* const addr, const igros_dword_t value) noexcept;
+		// Atomically AND quad
+		static void	bitAnd(igros_quad_t* const addr, const igros_quad_t value) noexcept;
+
+
+	};
+
+
+	// Atomically load long
+	[[nodiscard]]
+	inline auto atomic::load(const igros_dword_t* const addr) noexcept -> igros_dword_t {
+		return ::atomicLoad32(addr);
+	}
+
+	// Atomically load quad
+	[[nodiscard]]
+	inline auto atomic::load(const igros_quad_t* const addr) noexcept -> igros_quad_t {
+		return ::atomicLoad64(addr);
+	}
+
+
+	// Atomically store long
+	inline void atomic::store(igros_dword_t* const addr, const igros_dword_t value) noexcept {
+		::atomicStore32(addr, value);
+	}
+
+	// Atomically store quad
+	inline void atomic::store(igros_quad_t* const addr, const igros_quad_t value) noexcept {
+		::atomicStore64(addr, value);
+	}
+
+
+	// Atomically store long (release)
+	inline void atomic::storeRelease(igros_dword_t* const addr, const igros_dword_t value) noexcept {
+		::atomicStoreRelease32(addr, value);
+	}
+
+	// Atomically store quad (release)
+	inline void atomic::storeRelease(igros_quad_t* const addr, const igros_quad_t value) noexcept {
+		::atomicStoreRelease64(addr, value);
+	}
+
+
+	// Atomically exchange long
+	inline auto atomic::exchange(igros_dword_t* const addr, const igros_dword_t value) noexcept -> igros_dword_t {
+		return ::atomicExchange32(addr, value);
+	}
+
+	// Atomically exchange quad
+	inline auto atomic::exchange(igros_quad_t* const addr, const igros_quad_t value) noexcept -> igros_quad_t {
+		return ::atomicExchange64(addr, value);
+	}
+
+
+	// Atomically compare and exchange long
+	inline auto atomic::compareExchange(igros_dword_t* const addr, const igros_dword_t expected, const igros_dword_t desired) noexcept -> igros_dword_t {
+		return ::atomicCompareExchange32(addr, expected, desired);
+	}
+
+	// Atomically compare and exchange quad
+	inline auto atomic::compareExchange(igros_quad_t* const addr, const igros_quad_t expected, const igros_quad_t desired) noexcept -> igros_quad_t {
+		return ::atomicCompareExchange64(addr, expected, desired);
+	}
+
+
+	// Atomically add to long
+	inline auto atomic::fetchAdd(igros_dword_t* const addr, const igros_dword_t value) noexcept -> igros_dword_t {
+		return ::atomicFetchAdd32(addr, value);
+	}
+
+	// Atomically add to quad
+	inline auto atomic::fetchAdd(igros_quad_t* const addr, const igros_quad_t value) noexcept -> igros_quad_t {
+		return ::atomicFetchAdd64(addr, value);
+	}
+
+
+	// Atomically OR long
+	inline void atomic::bitOr(igros_dword_t* const addr, const igros_dword_t value) noexcept {
+		::atomicOr32(addr, value);
+	}
+
+	// Atomically OR quad
+	inline void atomic::bitOr(igros_quad_t* const addr, const igros_quad_t value) noexcept {
+		::atomicOr64(addr, value);
+	}
+
+
+	// Atomically AND long
+	inline void atomic::bitAnd(igros_dword_t* const addr, const igros_dword_t value) noexcept {
+		::atomicAnd32(addr, value);
+	}
+
+	// Atomically AND quad
+	inline void atomic::bitAnd(igros_quad_t* const addr, const igros_quad_t value) noexcept {
+		::atomicAnd64(addr, value);
+	}
+
+
+}	// namespace igros::x86_64
+
@@ -0,0 +1,63 @@
+################################################################
+#
+#	Local APIC low-level functions
+#
+#	File:	apic.s
+#	Date:	19 Oct 2026
+#
+#	Copyright (c) 2017 - 2022, Igor Baklykov
+#	All rights reserved.
+#
+#
+
+
+.code64
+
+.section .text
+.balign 8
+
+.global	apicSpuriousHandler			# Local APIC spurious interrupt handler
+.global	apicWakeupHandler			# Local APIC wake up interrupt handler
+
+.extern	apicWakeupInterrupt			# Wake up interrupt acknowledge
+
+
+# Local APIC spurious interrupt handler
+# Spurious interrupts must not be acknowledged with EOI
+.type apicSpuriousHandler, %function
+apicSpuriousHandler:
+
+	iretq					# Just return from interrupt
+
+.size apicSpuriousHandler, . - apicSpuriousHandler
+
+
+# Local APIC wake up interrupt handler
+# Only brings idle CPU out of halt, idle loop does the rest
+.type apicWakeupHandler, %function
+apicWakeupHandler:
+
+	pushq	%rax				# Save caller-saved registers
+	pushq	%rcx				# ---//---
+	pushq	%rdx				# ---//---
+	pushq	%rsi				# ---//---
+	pushq	%rdi				# ---//---
+	pushq	%r8				# ---//---
+	pushq	%r9				# ---//---
+	pushq	%r10				# ---//---
+	pushq	%r11				# ---//---
+	cld					# Clear direction flag
+	callq	apicWakeupInterrupt		# Acknowledge interrupt
+	popq	%r11				# Restore caller-saved registers
+	popq	%r10				# ---//---
+	popq	%r9				# ---//---
+	popq	%r8				# ---//---
+	popq	%rdi				# ---//---
+	popq	%rsi				# ---//---
+	popq	%rdx				# ---//---
+	popq	%rcx				# ---//---
+	popq	%rax				# ---//---
+	iretq					# Back to interrupted code (idle loop)
+
+.size apicWakeupHandler, . - apicWakeupHandler
+
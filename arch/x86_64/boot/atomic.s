@@ -0,0 +1,217 @@
+################################################################
+#
+#	Atomic memory operations
+#
+#	File:	atomic.s
+#	Date:	19 Oct 2026
+#
+#	Copyright (c) 2017 - 2022, Igor Baklykov
+#	All rights reserved.
+#
+#
+
+
+.code64
+
+.section .text
+.balign 8
+
+.global	atomicLoad32			# Atomically load long
+.global	atomicLoad64			# Atomically load quad
+.global	atomicStore32			# Atomically store long
+.global	atomicStore64			# Atomically store quad
+.global	atomicStoreRelease32		# Atomically store long (release)
+.global	atomicStoreRelease64		# Atomically store quad (release)
+.global	atomicExchange32		# Atomically exchange long
+.global	atomicExchange64		# Atomically exchange quad
+.global	atomicCompareExchange32		# Atomically compare and exchange long
+.global	atomicCompareExchange64		# Atomically compare and exchange quad
+.global	atomicFetchAdd32		# Atomically add to long
+.global	atomicFetchAdd64		# Atomically add to quad
+.global	atomicOr32			# Atomically OR long
+.global	atomicOr64			# Atomically OR quad
+.global	atomicAnd32			# Atomically AND long
+.global	atomicAnd64			# Atomically AND quad
+
+
+# Atomically load long
+.type atomicLoad32, %function
+atomicLoad32:
+
+	cld				# Clear direction flag
+	movl	(%rdi), %eax		# Aligned load is atomic
+	retq				# Return loaded value
+
+.size atomicLoad32, . - atomicLoad32
+
+
+# Atomically load quad
+.type atomicLoad64, %function
+atomicLoad64:
+
+	cld				# Clear direction flag
+	movq	(%rdi), %rax		# Aligned load is atomic
+	retq				# Return loaded value
+
+.size atomicLoad64, . - atomicLoad64
+
+
+# Atomically store long
+.type atomicStore32, %function
+atomicStore32:
+
+	cld				# Clear direction flag
+	xchgl	%esi, (%rdi)		# Store with full barrier
+	retq				# Return
+
+.size atomicStore32, . - atomicStore32
+
+
+# Atomically store quad
+.type atomicStore64, %function
+atomicStore64:
+
+	cld				# Clear direction flag
+	xchgq	%rsi, (%rdi)		# Store with full barrier
+	retq				# Return
+
+.size atomicStore64, . - atomicStore64
+
+
+# Atomically store long (release)
+.type atomicStoreRelease32, %function
+atomicStoreRelease32:
+
+	cld				# Clear direction flag
+	movl	%esi, (%rdi)		# Stores are not reordered with older stores
+	retq				# Return
+
+.size atomicStoreRelease32, . - atomicStoreRelease32
+
+
+# Atomically store quad (release)
+.type atomicStoreRelease64, %function
+atomicStoreRelease64:
+
+	cld				# Clear direction flag
+	movq	%rsi, (%rdi)		# Stores are not reordered with older stores
+	retq				# Return
+
+.size atomicStoreRelease64, . - atomicStoreRelease64
+
+
+# Atomically exchange long
+.type atomicExchange32, %function
+atomicExchange32:
+
+	cld				# Clear direction flag
+	movl	%esi, %eax		# New value
+	xchgl	%eax, (%rdi)		# Exchange (implicitly locked)
+	retq				# Return old value
+
+.size atomicExchange32, . - atomicExchange32
+
+
+# Atomically exchange quad
+.type atomicExchange64, %function
+atomicExchange64:
+
+	cld				# Clear direction flag
+	movq	%rsi, %rax		# New value
+	xchgq	%rax, (%rdi)		# Exchange (implicitly locked)
+	retq				# Return old value
+
+.size atomicExchange64, . - atomicExchange64
+
+
+# Atomically compare and exchange long
+.type atomicCompareExchange32, %function
+atomicCompareExchange32:
+
+	cld				# Clear direction flag
+	movl	%esi, %eax		# Expected value
+	lock cmpxchgl	%edx, (%rdi)	# Store desired value if equals to expected
+	retq				# Return old value
+
+.size atomicCompareExchange32, . - atomicCompareExchange32
+
+
+# Atomically compare and exchange quad
+.type atomicCompareExchange64, %function
+atomicCompareExchange64:
+
+	cld				# Clear direction flag
+	movq	%rsi, %rax		# Expected value
+	lock cmpxchgq	%rdx, (%rdi)	# Store desired value if equals to expected
+	retq				# Return old value
+
+.size atomicCompareExchange64, . - atomicCompareExchange64
+
+
+# Atomically add to long
+.type atomicFetchAdd32, %function
+atomicFetchAdd32:
+
+	cld				# Clear direction flag
+	movl	%esi, %eax		# Addend
+	lock xaddl	%eax, (%rdi)	# Exchange and add
+	retq				# Return old value
+
+.size atomicFetchAdd32, . - atomicFetchAdd32
+
+
+# Atomically add to quad
+.type atomicFetchAdd64, %function
+atomicFetchAdd64:
+
+	cld				# Clear direction flag
+	movq	%rsi, %rax		# Addend
+	lock xaddq	%rax, (%rdi)	# Exchange and add
+	retq				# Return old value
+
+.size atomicFetchAdd64, . - atomicFetchAdd64
+
+
+# Atomically OR long
+.type atomicOr32, %function
+atomicOr32:
+
+	cld				# Clear direction flag
+	lock orl	%esi, (%rdi)	# Set bits
+	retq				# Return
+
+.size atomicOr32, . - atomicOr32
+
+
+# Atomically OR quad
+.type atomicOr64, %function
+atomicOr64:
+
+	cld				# Clear direction flag
+	lock orq	%rsi, (%rdi)	# Set bits
+	retq				# Return
+
+.size atomicOr64, . - atomicOr64
+
+
+# Atomically AND long
+.type atomicAnd32, %function
+atomicAnd32:
+
+	cld				# Clear direction flag
+	lock andl	%esi, (%rdi)	# Clear bits
+	retq				# Return
+
+.size atomicAnd32, . - atomicAnd32
+
+
+# Atomically AND quad
+.type atomicAnd64, %function
+atomicAnd64:
+
+	cld				# Clear direction flag
+	lock andq	%rsi, (%rdi)	# Clear bits
+	retq				# Return
+
+.size atomicAnd64, . - atomicAnd64
+
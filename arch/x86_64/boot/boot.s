@@ -14,8 +14,13 @@
 .set	KERNEL_VMA,		0xFFFFFFFF80000000	# Kernel virtual memory offset
 
 .set	PAGE_ENTRY_VALID,	0x0000000000000083	# Valid page entry
+.set	PAGE_ENTRY_UNCACHED,	0x0000000000000018	# Uncached page entry (PCD + PWT)
 .set	PAGE_ENTRY_INVALID,	0x0000000000000000	# Invalid page entry
 
+.set	PAGE_SIZE_2MB,		0x0000000000200000	# Size of 2Mb page
+.set	PAGE_DIR_ENTRIES,	512			# Number of page directory entries
+.set	PAGE_DIR_CACHED,	3			# Number of cached (RAM) page directories
+
 .set	PAGE_TEMP_KERNEL,	510			# Kernel PD index
 
 .set	PAGE_BIT_PAE,		0x00000020		# Physical Address Extension bit
@@ -167,34 +172,42 @@ gdt64End:
 
 # Temporary boot page map level 4 table
 bootPageMapLevel4:
-	# Entry 0 = 8Mb (identity) mapped memory
+	# Entry 0 = 512Gb (identity) mapped memory
 	.quad	bootPageDirectoryPointer - KERNEL_VMA + 0x03
 	# Zero entries
 	.fill	PAGE_TEMP_KERNEL, 8, PAGE_ENTRY_INVALID
-	# Entry 511 = 4Gb + 8Mb (higher-half) mapped memory
+	# Entry 511 = 256Tb - 512Gb (higher-half) mapped memory
 	.quad	bootPageDirectoryPointer - KERNEL_VMA + 0x03
 
 # Temporary boot page directory pointer table
 bootPageDirectoryPointer:
-	# Entry 0 = 4Mb (identity) mapped memory
+	# Entries 0 - 3 = 4Gb (identity) mapped memory
+	# Needed to reach ACPI tables and memory-mapped devices
 	.quad	bootPageDirectory - KERNEL_VMA + 0x03
+	.quad	bootPageDirectory - KERNEL_VMA + 0x1003
+	.quad	bootPageDirectory - KERNEL_VMA + 0x2003
+	.quad	bootPageDirectory - KERNEL_VMA + 0x3003
 	# Zero entries
-	.fill	(PAGE_TEMP_KERNEL - 1), 8, PAGE_ENTRY_INVALID
-	# Entry 510 = 3Gb + 4Mb (higher-half) mapped memory
+	.fill	(PAGE_TEMP_KERNEL - 4), 8, PAGE_ENTRY_INVALID
+	# Entry 510 = 3Gb + 1Gb (higher-half) mapped memory
 	.quad	bootPageDirectory - KERNEL_VMA + 0x03
 	# Entry 511 = 4Gb - 4Mb (identity) mapped memory
 	.quad	bootPageMapLevel4 - KERNEL_VMA + 0x03
 
-# Temporary boot page directory table
+# Temporary boot page directory tables
 bootPageDirectory:
-	# Entry 0 = 2Mb (identity) mapped memory
-	.quad	PAGE_ENTRY_VALID
-	# Entry 1 = 2Mb + 2Mb (identity) mapped memory
-	.quad	PAGE_ENTRY_VALID + 0x200000
-	# Zero entries
-	.fill	(PAGE_TEMP_KERNEL - 1), 8, PAGE_ENTRY_INVALID
-	# Entry 511 = 1Gb - 2Mb (identity) mapped memory
-	.quad	bootPageMapLevel4 - KERNEL_VMA + PAGE_ENTRY_VALID
+	# Entries 0 - 1535 = 0Gb - 3Gb (identity) mapped memory
+	.set	PAGE_ADDRESS, 0
+	.rept	(PAGE_DIR_ENTRIES * PAGE_DIR_CACHED)
+	.quad	PAGE_ADDRESS + PAGE_ENTRY_VALID
+	.set	PAGE_ADDRESS, PAGE_ADDRESS + PAGE_SIZE_2MB
+	.endr
+	# Entries 1536 - 2047 = 3Gb - 4Gb (identity, uncached) mapped memory
+	# This is where PCI hole, LAPIC, IOAPIC and HPET live
+	.rept	PAGE_DIR_ENTRIES
+	.quad	PAGE_ADDRESS + PAGE_ENTRY_VALID + PAGE_ENTRY_UNCACHED
+	.set	PAGE_ADDRESS, PAGE_ADDRESS + PAGE_SIZE_2MB
+	.endr
 
 
 # Stack section
@@ -0,0 +1,59 @@
+################################################################
+#
+#	Execution context switch
+#
+#	File:	context.s
+#	Date:	19 Oct 2026
+#
+#	Copyright (c) 2017 - 2022, Igor Baklykov
+#	All rights reserved.
+#
+#
+
+
+.code64
+
+.section .text
+.balign 8
+
+.global	contextSwitch			# Switch execution context
+.global	contextStart			# New execution context entry
+
+
+# Switch execution context
+.type contextSwitch, %function
+contextSwitch:
+
+	cld				# Clear direction flag
+	pushq	%rbp			# Save callee-saved registers
+	pushq	%rbx			# ---//---
+	pushq	%r12			# ---//---
+	pushq	%r13			# ---//---
+	pushq	%r14			# ---//---
+	pushq	%r15			# ---//---
+	pushfq				# Save flags (interrupts state)
+	movq	%rsp, (%rdi)		# Save current stack pointer
+	movq	%rsi, %rsp		# Switch to new stack
+	popfq				# Restore flags (interrupts state)
+	popq	%r15			# Restore callee-saved registers
+	popq	%r14			# ---//---
+	popq	%r13			# ---//---
+	popq	%r12			# ---//---
+	popq	%rbx			# ---//---
+	popq	%rbp			# ---//---
+	retq				# Resume new context
+
+.size contextSwitch, . - contextSwitch
+
+
+# New execution context entry
+.type contextStart, %function
+contextStart:
+
+	cld				# Clear direction flag
+	movq	%r12, %rdi		# Entry argument
+	callq	*%rbx			# Call entry
+	ud2				# Entry must never return
+
+.size contextStart, . - contextStart
+
@@ -17,6 +17,9 @@
 .balign 8
 
 .global cpuHalt			# halt CPU
+.global cpuIdle			# wait for interrupt
+.global cpuPause		# spin-wait hint
+.global cpuTimestamp		# read time-stamp counter
 
 
 # Halt CPU
@@ -29,3 +32,36 @@ cpuHalt:
 
 .size cpuHalt, . - cpuHalt
 
+
+# Wait for interrupt
+.type cpuIdle, %function
+cpuIdle:
+
+	sti				# Enable interrupts (takes effect after next instruction)
+	hlt				# Sleep till interrupt
+	retq				# Return
+
+.size cpuIdle, . - cpuIdle
+
+
+# Spin-wait loop hint
+.type cpuPause, %function
+cpuPause:
+
+	pause				# Relax CPU in spin-wait loop
+	retq				# Return
+
+.size cpuPause, . - cpuPause
+
+
+# Read time-stamp counter
+.type cpuTimestamp, %function
+cpuTimestamp:
+
+	rdtsc				# Read TSC into EDX:EAX
+	shlq	$32, %rdx		# Combine into RAX
+	orq	%rdx, %rax
+	retq				# Return 64-bit value
+
+.size cpuTimestamp, . - cpuTimestamp
+
@@ -11,10 +11,6 @@
 #
 
 
-
-.set	CPUID_STACK_SHIFT,	0x00000020	# CPUID stack 32-bit shift for 64-bit push
-
-
 .code64
 
 .section .text
@@ -23,20 +19,22 @@
 .global cpuCPUID				# Execute CPUID instruction with required params
 
 
-# Execute CPUID with reauired flags
+# Execute CPUID with required leaf/subleaf
 .type cpuCPUID, %function
 cpuCPUID:
 
 	cld					# Clear direction flag
-	movl	%edi, %eax			# Put flag to EAX register
+	pushq	%rbx				# Save RBX (callee-saved)
+	movq	%rdx, %r8			# Save result structure pointer
+	movl	%edi, %eax			# Put leaf to EAX register
+	movl	%esi, %ecx			# Put subleaf to ECX register
 	cpuid					# Execute CPUID
-	shlq	$CPUID_STACK_SHIFT, %rax
-	orq	%rbx, %rax
-	pushq	%rax
-	shlq	$CPUID_STACK_SHIFT, %rcx
-	orq	%rdx, %rcx
-	pushq	%rcx
-	retq					# Return structure of CPUID results
+	movl	%eax, 0x00(%r8)			# Store EAX
+	movl	%ebx, 0x04(%r8)			# Store EBX
+	movl	%ecx, 0x08(%r8)			# Store ECX
+	movl	%edx, 0x0C(%r8)			# Store EDX
+	popq	%rbx				# Restore RBX
+	retq					# Return
 
 .size cpuCPUID, . - cpuCPUID
 
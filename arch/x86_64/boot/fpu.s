@@ -0,0 +1,179 @@
+################################################################
+#
+#	FPU/SSE/AVX state management
+#
+#	File:	fpu.s
+#	Date:	19 Oct 2026
+#
+#	Copyright (c) 2017 - 2022, Igor Baklykov
+#	All rights reserved.
+#
+#
+
+
+.set	FPU_MXCSR_DEFAULT,	0x1F80		# Default MXCSR (all exceptions masked)
+.set	FPU_CR0_TS,		0x08		# CR0 task switched bit
+
+
+.code64
+
+.section .text
+.balign 8
+
+.global	fpuReset			# Load default x87/SSE state
+.global	fpuClearTS			# Allow FPU use (clear CR0.TS)
+.global	fpuSetTS			# Trap next FPU use (set CR0.TS)
+.global	fpuXsetbv			# Write extended control register
+.global	fpuFxsave			# Save x87/SSE state (legacy area)
+.global	fpuFxrstor			# Restore x87/SSE state (legacy area)
+.global	fpuXsave			# Save extended state
+.global	fpuXsaveopt			# Save modified extended state
+.global	fpuXsaves			# Save modified extended state (compacted)
+.global	fpuXrstor			# Restore extended state
+.global	fpuXrstors			# Restore extended state (compacted)
+
+
+# Load default x87/SSE state
+.type fpuReset, %function
+fpuReset:
+
+	cld				# Clear direction flag
+	fninit				# Reset x87 state
+	pushq	$FPU_MXCSR_DEFAULT	# Default MXCSR to stack
+	ldmxcsr	(%rsp)			# Load MXCSR
+	addq	$0x08, %rsp		# Stack cleanup
+	retq
+
+.size fpuReset, . - fpuReset
+
+
+# Allow FPU use (clear CR0.TS)
+.type fpuClearTS, %function
+fpuClearTS:
+
+	cld				# Clear direction flag
+	clts				# Clear task switched bit
+	retq
+
+.size fpuClearTS, . - fpuClearTS
+
+
+# Trap next FPU use (set CR0.TS)
+.type fpuSetTS, %function
+fpuSetTS:
+
+	cld				# Clear direction flag
+	movq	%cr0, %rax		# Load CR0
+	orq	$FPU_CR0_TS, %rax	# Set task switched bit
+	movq	%rax, %cr0		# Store CR0
+	retq
+
+.size fpuSetTS, . - fpuSetTS
+
+
+# Write extended control register
+.type fpuXsetbv, %function
+fpuXsetbv:
+
+	cld				# Clear direction flag
+	movl	%edi, %ecx		# Register index
+	movl	%esi, %eax		# Value low part
+	movq	%rsi, %rdx		# Value high part
+	shrq	$32, %rdx		# ---//---
+	xsetbv				# Write XCR
+	retq
+
+.size fpuXsetbv, . - fpuXsetbv
+
+
+# Save x87/SSE state (legacy area)
+.type fpuFxsave, %function
+fpuFxsave:
+
+	cld				# Clear direction flag
+	fxsave64	(%rdi)		# Save state
+	retq
+
+.size fpuFxsave, . - fpuFxsave
+
+
+# Restore x87/SSE state (legacy area)
+.type fpuFxrstor, %function
+fpuFxrstor:
+
+	cld				# Clear direction flag
+	fxrstor64	(%rdi)		# Restore state
+	retq
+
+.size fpuFxrstor, . - fpuFxrstor
+
+
+# Save extended state
+.type fpuXsave, %function
+fpuXsave:
+
+	cld				# Clear direction flag
+	movl	%esi, %eax		# Components mask low part
+	movq	%rsi, %rdx		# Components mask high part
+	shrq	$32, %rdx		# ---//---
+	xsave64	(%rdi)			# Save extended state
+	retq
+
+.size fpuXsave, . - fpuXsave
+
+
+# Save modified extended state
+.type fpuXsaveopt, %function
+fpuXsaveopt:
+
+	cld				# Clear direction flag
+	movl	%esi, %eax		# Components mask low part
+	movq	%rsi, %rdx		# Components mask high part
+	shrq	$32, %rdx		# ---//---
+	xsaveopt64	(%rdi)		# Save modified extended state
+	retq
+
+.size fpuXsaveopt, . - fpuXsaveopt
+
+
+# Save modified extended state (compacted)
+.type fpuXsaves, %function
+fpuXsaves:
+
+	cld				# Clear direction flag
+	movl	%esi, %eax		# Components mask low part
+	movq	%rsi, %rdx		# Components mask high part
+	shrq	$32, %rdx		# ---//---
+	xsaves64	(%rdi)		# Save modified extended state
+	retq
+
+.size fpuXsaves, . - fpuXsaves
+
+
+# Restore extended state
+.type fpuXrstor, %function
+fpuXrstor:
+
+	cld				# Clear direction flag
+	movl	%esi, %eax		# Components mask low part
+	movq	%rsi, %rdx		# Components mask high part
+	shrq	$32, %rdx		# ---//---
+	xrstor64	(%rdi)		# Restore extended state
+	retq
+
+.size fpuXrstor, . - fpuXrstor
+
+
+# Restore extended state (compacted)
+.type fpuXrstors, %function
+fpuXrstors:
+
+	cld				# Clear direction flag
+	movl	%esi, %eax		# Components mask low part
+	movq	%rsi, %rdx		# Components mask high part
+	shrq	$32, %rdx		# ---//---
+	xrstors64	(%rdi)		# Restore extended state
+	retq
+
+.size fpuXrstors, . - fpuXrstors
+
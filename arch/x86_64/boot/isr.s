@@ -19,12 +19,18 @@
 .extern	isrHandler			# Extenral main interrupt service routine handler
 
 .global interruptServiceRoutine		# ISR
+.global irqServiceRoutine		# Device IRQ ISR
 
 
 # Interrupt service routine
 .type interruptServiceRoutine, %function
 interruptServiceRoutine:
 
+	testb	$0x03, 0x18(%rsp)	# Check saved CS privilege level
+	jz	1f			# Already on kernel GS if came from kernel
+	swapgs				# Switch to kernel per-CPU data block
+
+1:
 	pushq	%rax			# Save "all" regisers
 	pushq	%rcx			# ---//---
 	pushq	%rdx			# ---//---
@@ -63,7 +69,61 @@ interruptServiceRoutine:
 
 	addq	$0x10, %rsp		# Stack cleanup
 
+	testb	$0x03, 0x08(%rsp)	# Check saved CS privilege level
+	jz	2f			# Stay on kernel GS if returning to kernel
+	swapgs				# Switch back to user GS
+
+2:
 	iretq				# Done here
 
 .size interruptServiceRoutine, . - interruptServiceRoutine
 
+
+# Device IRQ service routine
+# Handlers are plain C++ calls, so callee-saved registers survive them
+# and only caller-clobbered ones are saved. Frame keeps register_t
+# layout, callee-saved slots are left unset.
+.type irqServiceRoutine, %function
+irqServiceRoutine:
+
+	testb	$0x03, 0x18(%rsp)	# Check saved CS privilege level
+	jz	1f			# Already on kernel GS if came from kernel
+	swapgs				# Switch to kernel per-CPU data block
+
+1:
+	subq	$0x78, %rsp		# Reserve registers frame
+	movq	%rax, 0x70(%rsp)	# Save caller-clobbered registers
+	movq	%rcx, 0x68(%rsp)	# ---//---
+	movq	%rdx, 0x60(%rsp)	# ---//---
+	movq	%rsi, 0x48(%rsp)	# ---//---
+	movq	%rdi, 0x40(%rsp)	# ---//---
+	movq	%r8, 0x38(%rsp)		# ---//---
+	movq	%r9, 0x30(%rsp)		# ---//---
+	movq	%r10, 0x28(%rsp)	# ---//---
+	movq	%r11, 0x20(%rsp)	# ---//---
+
+	cld				# Clear direction flag
+	movq	%rsp, %rdi		# Take pointer to stack
+	callq	isrHandler		# Call external main interrupt service routine handler
+
+	movq	0x20(%rsp), %r11	# Restore caller-clobbered registers
+	movq	0x28(%rsp), %r10	# ---//---
+	movq	0x30(%rsp), %r9		# ---//---
+	movq	0x38(%rsp), %r8		# ---//---
+	movq	0x40(%rsp), %rdi	# ---//---
+	movq	0x48(%rsp), %rsi	# ---//---
+	movq	0x60(%rsp), %rdx	# ---//---
+	movq	0x68(%rsp), %rcx	# ---//---
+	movq	0x70(%rsp), %rax	# ---//---
+
+	addq	$0x88, %rsp		# Registers frame and stack cleanup
+
+	testb	$0x03, 0x08(%rsp)	# Check saved CS privilege level
+	jz	2f			# Stay on kernel GS if returning to kernel
+	swapgs				# Switch back to user GS
+
+2:
+	iretq				# Done here
+
+.size irqServiceRoutine, . - irqServiceRoutine
+
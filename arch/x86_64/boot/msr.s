@@ -25,10 +25,12 @@
 inMSR:
 
 	cld				# Clear direction flag
-	movq	%rdi, %rcx
-        movq    %rsi, %rax
-        wrmsr
-	retq
+	movl	%edi, %ecx		# MSR address
+	movq	%rsi, %rax		# Low 32 bits of value
+	movq	%rsi, %rdx		# High 32 bits of value
+	shrq	$32, %rdx
+	wrmsr				# Write MSR
+	retq				# Return
 
 .size inMSR, . - inMSR
 
@@ -38,9 +40,12 @@ inMSR:
 outMSR:
 
 	cld				# Clear direction flag
-	movq	%rdi, %rcx
-        rdmsr
-	retq
+	movl	%edi, %ecx		# MSR address
+	rdmsr				# Read MSR into EDX:EAX
+	shlq	$32, %rdx		# Combine into RAX
+	movl	%eax, %eax
+	orq	%rdx, %rax
+	retq				# Return 64-bit value
 
 .size outMSR, . - outMSR
 
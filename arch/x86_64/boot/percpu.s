@@ -0,0 +1,163 @@
+################################################################
+#
+#	Per-CPU data area accessors
+#
+#	File:	percpu.s
+#	Date:	19 Oct 2026
+#
+#	Copyright (c) 2017 - 2022, Igor Baklykov
+#	All rights reserved.
+#
+#
+
+
+.code64
+
+.section .text
+.balign 8
+
+.global	percpuRead8			# Read per-CPU byte
+.global	percpuRead16			# Read per-CPU word
+.global	percpuRead32			# Read per-CPU long
+.global	percpuRead64			# Read per-CPU quad
+.global	percpuWrite8			# Write per-CPU byte
+.global	percpuWrite16			# Write per-CPU word
+.global	percpuWrite32			# Write per-CPU long
+.global	percpuWrite64			# Write per-CPU quad
+.global	percpuAdd8			# Add to per-CPU byte
+.global	percpuAdd16			# Add to per-CPU word
+.global	percpuAdd32			# Add to per-CPU long
+.global	percpuAdd64			# Add to per-CPU quad
+
+
+# Read per-CPU byte
+.type percpuRead8, %function
+percpuRead8:
+
+	cld				# Clear direction flag
+	movb	%gs:(%rdi), %al		# Load from GS-relative offset
+	retq				# Return loaded value
+
+.size percpuRead8, . - percpuRead8
+
+
+# Read per-CPU word
+.type percpuRead16, %function
+percpuRead16:
+
+	cld				# Clear direction flag
+	movw	%gs:(%rdi), %ax		# Load from GS-relative offset
+	retq				# Return loaded value
+
+.size percpuRead16, . - percpuRead16
+
+
+# Read per-CPU long
+.type percpuRead32, %function
+percpuRead32:
+
+	cld				# Clear direction flag
+	movl	%gs:(%rdi), %eax	# Load from GS-relative offset
+	retq				# Return loaded value
+
+.size percpuRead32, . - percpuRead32
+
+
+# Read per-CPU quad
+.type percpuRead64, %function
+percpuRead64:
+
+	cld				# Clear direction flag
+	movq	%gs:(%rdi), %rax	# Load from GS-relative offset
+	retq				# Return loaded value
+
+.size percpuRead64, . - percpuRead64
+
+
+# Write per-CPU byte
+.type percpuWrite8, %function
+percpuWrite8:
+
+	cld				# Clear direction flag
+	movb	%sil, %gs:(%rdi)	# Store to GS-relative offset
+	retq				# Return
+
+.size percpuWrite8, . - percpuWrite8
+
+
+# Write per-CPU word
+.type percpuWrite16, %function
+percpuWrite16:
+
+	cld				# Clear direction flag
+	movw	%si, %gs:(%rdi)		# Store to GS-relative offset
+	retq				# Return
+
+.size percpuWrite16, . - percpuWrite16
+
+
+# Write per-CPU long
+.type percpuWrite32, %function
+percpuWrite32:
+
+	cld				# Clear direction flag
+	movl	%esi, %gs:(%rdi)	# Store to GS-relative offset
+	retq				# Return
+
+.size percpuWrite32, . - percpuWrite32
+
+
+# Write per-CPU quad
+.type percpuWrite64, %function
+percpuWrite64:
+
+	cld				# Clear direction flag
+	movq	%rsi, %gs:(%rdi)	# Store to GS-relative offset
+	retq				# Return
+
+.size percpuWrite64, . - percpuWrite64
+
+
+# Add to per-CPU byte
+.type percpuAdd8, %function
+percpuAdd8:
+
+	cld				# Clear direction flag
+	addb	%sil, %gs:(%rdi)	# Add to GS-relative offset (no lock needed)
+	retq				# Return
+
+.size percpuAdd8, . - percpuAdd8
+
+
+# Add to per-CPU word
+.type percpuAdd16, %function
+percpuAdd16:
+
+	cld				# Clear direction flag
+	addw	%si, %gs:(%rdi)		# Add to GS-relative offset (no lock needed)
+	retq				# Return
+
+.size percpuAdd16, . - percpuAdd16
+
+
+# Add to per-CPU long
+.type percpuAdd32, %function
+percpuAdd32:
+
+	cld				# Clear direction flag
+	addl	%esi, %gs:(%rdi)	# Add to GS-relative offset (no lock needed)
+	retq				# Return
+
+.size percpuAdd32, . - percpuAdd32
+
+
+# Add to per-CPU quad
+.type percpuAdd64, %function
+percpuAdd64:
+
+	cld				# Clear direction flag
+	addq	%rsi, %gs:(%rdi)	# Add to GS-relative offset (no lock needed)
+	retq				# Return
+
+.size percpuAdd64, . - percpuAdd64
+
@@ -22,6 +22,12 @@
 .global	inPort8				# Write byte to port
 .global	inPort16			# Write word to port
 .global	inPort32			# Write long to port
+.global	outMemory8			# Read byte from memory
+.global	outMemory16			# Read word from memory
+.global	outMemory32			# Read long from memory
+.global	inMemory8			# Write byte to memory
+.global	inMemory16			# Write word to memory
+.global	inMemory32			# Write long to memory
 
 
 # Read byte from port function
@@ -98,3 +104,69 @@ inPort32:
 
 .size inPort32, . - inPort32
 
+
+# Read byte from memory function
+.type outMemory8, %function
+outMemory8:
+
+	cld				# Clear direction flag
+	movb	(%rdi), %al		# Read data
+	retq				# Return
+
+.size outMemory8, . - outMemory8
+
+
+# Read word from memory function
+.type outMemory16, %function
+outMemory16:
+
+	cld				# Clear direction flag
+	movw	(%rdi), %ax		# Read data
+	retq				# Return
+
+.size outMemory16, . - outMemory16
+
+
+# Read long from memory function
+.type outMemory32, %function
+outMemory32:
+
+	cld				# Clear direction flag
+	movl	(%rdi), %eax		# Read data
+	retq				# Return
+
+.size outMemory32, . - outMemory32
+
+
+# Write byte to memory function
+.type inMemory8, %function
+inMemory8:
+
+	cld				# Clear direction flag
+	movb	%sil, (%rdi)		# Write data
+	retq				# Return
+
+.size inMemory8, . - inMemory8
+
+
+# Write word to memory function
+.type inMemory16, %function
+inMemory16:
+
+	cld				# Clear direction flag
+	movw	%si, (%rdi)		# Write data
+	retq				# Return
+
+.size inMemory16, . - inMemory16
+
+
+# Write long to memory function
+.type inMemory32, %function
+inMemory32:
+
+	cld				# Clear direction flag
+	movl	%esi, (%rdi)		# Write data
+	retq				# Return
+
+.size inMemory32, . - inMemory32
+
@@ -0,0 +1,139 @@
+################################################################
+#
+#	Application processors startup trampoline
+#
+#	File:	trampoline.s
+#	Date:	19 Oct 2026
+#
+#	Copyright (c) 2017 - 2022, Igor Baklykov
+#	All rights reserved.
+#
+#
+
+
+.set	TRAMPOLINE_BASE,	0x00008000		# Trampoline physical address (STARTUP IPI page 0x08)
+
+.set	PAGE_BIT_PAE,		0x00000020		# Physical Address Extension bit
+.set	PAGE_BIT_LME,		0x00000100		# Long Mode Enable bit
+.set	PAGE_BIT_PE,		0x80000000		# Paging Enable bit
+.set	PROTECTED_BIT_PE,	0x00000001		# Protected mode Enable bit
+
+.set	SEGMENT_CODE64,		0x08			# 64-bit code segment (same as kernel one)
+.set	SEGMENT_DATA,		0x10			# Data segment
+.set	SEGMENT_CODE32,		0x18			# 32-bit code segment
+
+
+# Trampoline is copied to TRAMPOLINE_BASE before use,
+# so all addresses are calculated relative to it
+.section .rodata
+.balign	16
+
+# Export trampoline boundaries and data
+.global	trampolineStart					# Trampoline start
+.global	trampolineData					# Trampoline data
+.global	trampolineEnd					# Trampoline end
+
+
+# 16-bit code
+.code16
+
+# Application processor starts here (CS = TRAMPOLINE_BASE >> 4, IP = 0)
+trampolineStart:
+
+	cli						# Turn off interrupts
+	cld						# Clear direction flag
+
+	# Address trampoline data relative to CS
+	movw	%cs, %ax				# Get code segment
+	movw	%ax, %ds				# Use it as data segment
+
+	# Load temporary GDT
+	lgdtl	(trampolineGDTPtr - trampolineStart)	# Load GDT pointer (DS-relative)
+
+	# Enable protected mode
+	movl	%cr0, %eax				# Load CR0 value
+	orl	$PROTECTED_BIT_PE, %eax			# Set PE bit
+	movl	%eax, %cr0				# Set new CR0 value
+
+	# Jump to protected mode
+	ljmpl	$SEGMENT_CODE32, $(1f - trampolineStart + TRAMPOLINE_BASE)
+
+
+# 32-bit code
+.code32
+
+1:
+	# Setup data segments
+	movw	$SEGMENT_DATA, %ax			# Data segment selector
+	movw	%ax, %ds				# --//--
+	movw	%ax, %es				# --//--
+	movw	%ax, %ss				# --//--
+
+	# PAE
+	movl	%cr4, %eax				# Load CR4 value
+	orl	$PAGE_BIT_PAE, %eax			# Set Physical Address Extension bit
+	movl	%eax, %cr4				# Set new CR4 value
+
+	# Load bootstrap processor Page Map Level 4 table
+	movl	(trampolineData - trampolineStart + TRAMPOLINE_BASE), %eax
+	movl	%eax, %cr3				# Load page table
+
+	# Enable Long Mode
+	movl	$0xC0000080, %ecx			# Load EFER register address
+	rdmsr						# Read EFER value
+	orl	$PAGE_BIT_LME, %eax			# Set Long Mode Enable bit
+	wrmsr						# Write new EFER value
+
+	# Enable paging
+	movl	%cr0, %eax				# Load CR0 value
+	orl	$PAGE_BIT_PE, %eax			# Set PE bit
+	movl	%eax, %cr0				# Set new CR0 value
+
+	# Jump to Long Mode
+	ljmpl	$SEGMENT_CODE64, $(2f - trampolineStart + TRAMPOLINE_BASE)
+
+
+# 64-bit code
+.code64
+
+2:
+	# Setup stack from trampoline data
+	movq	(trampolineData - trampolineStart + TRAMPOLINE_BASE + 0x08), %rsp
+	# Pass CPU index to entry
+	movq	(trampolineData - trampolineStart + TRAMPOLINE_BASE + 0x18), %rdi
+	# Jump to higher half C++ entry
+	movq	(trampolineData - trampolineStart + TRAMPOLINE_BASE + 0x10), %rax
+	callq	*%rax
+
+# Hang on fail
+3:
+	hlt						# Stop CPU
+	jmp	3b					# Hang CPU
+
+
+# Temporary GDT
+.balign	8
+trampolineGDT:
+	.quad	0x0000000000000000			# Empty
+	.quad	0x00AF9A000000FFFF			# 64-bit code descriptor
+	.quad	0x00CF92000000FFFF			# Data descriptor
+	.quad	0x00CF9A000000FFFF			# 32-bit code descriptor
+
+# Temporary GDT pointer
+trampolineGDTPtr:
+	.word	trampolineGDTPtr - trampolineGDT - 1	# GDT size
+	.long	trampolineGDT - trampolineStart + TRAMPOLINE_BASE
+
+
+# Trampoline data (filled by bootstrap processor)
+.balign	8
+trampolineData:
+	.long	0x00000000				# Page Map Level 4 table physical address
+	.long	0x00000000				# Padding
+	.quad	0x0000000000000000			# Stack top
+	.quad	0x0000000000000000			# Entry function
+	.quad	0x0000000000000000			# CPU index
+
+# Trampoline end
+trampolineEnd:
+
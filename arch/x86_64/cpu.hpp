@@ -17,6 +17,8 @@
 // IgrOS-Kernel arch
 #include <arch/register.hpp>
 #include <arch/types.hpp>
+// IgrOS-Kernel arch x86_64
+#include <arch/x86_64/cpuid.hpp>
 // IgrOS-Kernel library
 #include <klib/kprint.hpp>
 
@@ -31,6 +33,13 @@ extern "C" {
 	// Halt CPU
 	[[noreturn]]
 	void	cpuHalt() noexcept;
+	// Wait for interrupt
+	void	cpuIdle() noexcept;
+	// Spin-wait hint
+	void	cpuPause() noexcept;
+	// Read time-stamp counter
+	[[nodiscard]]
+	auto	cpuTimestamp() noexcept -> igros::igros_quad_t;
 
 
 #ifdef	__cplusplus
@@ -66,6 +75,16 @@ namespace igros::x86_64 {
 		// Halt CPU
 		[[noreturn]]
 		static void	halt() noexcept;
+		// Wait for interrupt
+		static void	idle() noexcept;
+		// Spin-wait hint
+		static void	pause() noexcept;
+		// Read time-stamp counter
+		[[nodiscard]]
+		static auto	timestamp() noexcept -> igros_quad_t;
+		// Time-stamp counter runs at constant rate in all states
+		[[nodiscard]]
+		static auto	timestampInvariant() noexcept -> bool;
 
 		// Dump CPU registers
 		static void	dumpRegisters(const register_t* const regs) noexcept;
@@ -80,6 +99,37 @@ namespace igros::x86_64 {
 		::cpuHalt();
 	}
 
+	// Wait for interrupt
+	inline void cpu::idle() noexcept {
+		::cpuIdle();
+	}
+
+	// Spin-wait hint
+	inline void cpu::pause() noexcept {
+		::cpuPause();
+	}
+
+	// Read time-stamp counter
+	[[nodiscard]]
+	inline auto cpu::timestamp() noexcept -> igros_quad_t {
+		return ::cpuTimestamp();
+	}
+
+	// Time-stamp counter runs at constant rate in all states
+	[[nodiscard]]
+	inline auto cpu::timestampInvariant() noexcept -> bool {
+		// TSC present (CPUID.01h:EDX[4])
+		if (0_u32 == (cpuid(cpuidFlags_t::INFO_PROC_VERSION).edx & 0x00000010_u32)) {
+			return false;
+		}
+		// Power management leaf present
+		if (cpuid(cpuidFlags_t::FEATURES_AMD).eax < static_cast<igros_dword_t>(cpuidFlags_t::INFO_POWER_MANAGEMENT)) {
+			return false;
+		}
+		// Invariant TSC (CPUID.80000007h:EDX[8])
+		return 0_u32 != (cpuid(cpuidFlags_t::INFO_POWER_MANAGEMENT).edx & 0x00000100_u32);
+	}
+
 
 	// Dump registers
 	inline void cpu::dumpRegisters(const register_t* const regs) noexcept {
@@ -18,6 +18,35 @@
 #include <arch/types.hpp>
 
 
+// x86_64 namespace
+namespace igros::x86_64 {
+
+
+	// CPUID registers values holder
+	struct cpuidRegs_t;
+
+
+}	// namespace igros::x86_64
+
+
+#ifdef	__cplusplus
+
+extern "C" {
+
+#endif	// __cplusplus
+
+
+	// Execute CPUID instruction
+	void	cpuCPUID(const igros::igros_dword_t leaf, const igros::igros_dword_t subleaf, igros::x86_64::cpuidRegs_t* const regs) noexcept;
+
+
+#ifdef	__cplusplus
+
+}	// extern "C"
+
+#endif	// __cplusplus
+
+
 // x86_64 namespace
 namespace igros::x86_64 {
 
@@ -30,9 +59,11 @@ namespace igros::x86_64 {
 		INFO_PROC_VERSION	= 0x00000001_u32,		//
 		INFO_CACHE_TLB		= 0x00000002_u32,		//
 		INFO_PENTIUM_III_SERIAL	= 0x00000003_u32,		//
+		INFO_EXTENDED_STATE	= 0x0000000D_u32,		// XSAVE features and state sizes
 
 		// "AMD" features list
-		FEATURES_AMD		= 0x80000000_u32		//
+		FEATURES_AMD		= 0x80000000_u32,		//
+		INFO_POWER_MANAGEMENT	= 0x80000007_u32		// Advanced power management (invariant TSC)
 
 	};
 
@@ -52,7 +83,19 @@ namespace igros::x86_64 {
 
 	// CPUID instruction call
 	[[nodiscard]]
-	auto	cpuid(const cpuidFlags_t flag) noexcept -> cpuidRegs_t;
+	auto	cpuid(const cpuidFlags_t flag, const igros_dword_t subleaf = 0_u32) noexcept -> cpuidRegs_t;
+
+
+	// CPUID instruction call
+	[[nodiscard]]
+	inline auto cpuid(const cpuidFlags_t flag, const igros_dword_t subleaf) noexcept -> cpuidRegs_t {
+		// CPUID results
+		auto regs {cpuidRegs_t {}};
+		// Execute CPUID
+		::cpuCPUID(static_cast<igros_dword_t>(flag), subleaf, &regs);
+		// Return results
+		return regs;
+	}
 
 
 }	// namespace igros::x86_64
@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////
+//
+//	FPU/SSE/AVX state management for x86_64
+//
+//	File:	fpu.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// IgrOS-Kernel arch x86_64
+#include <arch/x86_64/cpuid.hpp>
+#include <arch/x86_64/cr.hpp>
+#include <arch/x86_64/exceptions.hpp>
+#include <arch/x86_64/fpu.hpp>
+#include <arch/x86_64/msr.hpp>
+#include <arch/x86_64/paging.hpp>
+// IgrOS-Kernel library
+#include <klib/kmemory.hpp>
+#include <klib/kprint.hpp>
+// IgrOS-Kernel system
+#include <sys/fpu.hpp>
+
+
+// x86_64 namespace
+namespace igros::x86_64 {
+
+
+	// CR0 monitor coprocessor bit
+	constexpr auto FPU_CR0_MP		{0x0000000000000002_u64};
+	// CR0 emulation bit
+	constexpr auto FPU_CR0_EM		{0x0000000000000004_u64};
+	// CR0 task switched bit
+	constexpr auto FPU_CR0_TS		{0x0000000000000008_u64};
+	// CR0 native x87 errors bit
+	constexpr auto FPU_CR0_NE		{0x0000000000000020_u64};
+
+	// CR4 FXSAVE/FXRSTOR and SSE enable bit
+	constexpr auto FPU_CR4_OSFXSR		{0x0000000000000200_u64};
+	// CR4 SSE exceptions enable bit
+	constexpr auto FPU_CR4_OSXMMEXCPT	{0x0000000000000400_u64};
+	// CR4 XSAVE and XCR0 enable bit
+	constexpr auto FPU_CR4_OSXSAVE		{0x0000000000040000_u64};
+
+	// CPUID.1:ECX XSAVE support bit
+	constexpr auto FPU_CPUID_XSAVE		{0x04000000_u32};
+	// CPUID.(0xD, 1):EAX XSAVEOPT support bit
+	constexpr auto FPU_CPUID_XSAVEOPT	{0x00000001_u32};
+	// CPUID.(0xD, 1):EAX XSAVES support bit
+	constexpr auto FPU_CPUID_XSAVES		{0x00000008_u32};
+
+	// XCR0 x87 state component
+	constexpr auto FPU_XCR0_X87		{0x0000000000000001_u64};
+	// XCR0 SSE state component
+	constexpr auto FPU_XCR0_SSE		{0x0000000000000002_u64};
+	// XCR0 AVX state component
+	constexpr auto FPU_XCR0_AVX		{0x0000000000000004_u64};
+	// XCR0 AVX-512 state components (opmask, ZMM upper halves, ZMM16-31)
+	constexpr auto FPU_XCR0_AVX512		{0x00000000000000E0_u64};
+
+	// Supervisor state components MSR
+	constexpr auto FPU_XSS_MSR		{0x00000DA0_u32};
+	// Legacy (FXSAVE) area size
+	constexpr auto FPU_LEGACY_SIZE		{512_usize};
+
+
+	// State save method
+	fpuMethod_t	fpu::mMethod	{fpuMethod_t::FXSAVE};
+	// Enabled state components (XCR0)
+	igros_quad_t	fpu::mMask	{FPU_XCR0_X87 | FPU_XCR0_SSE};
+	// State area size
+	igros_usize_t	fpu::mSize	{FPU_LEGACY_SIZE};
+	// Default state area (copied to new contexts)
+	igros_pointer_t	fpu::mDefault	{nullptr};
+
+
+	// Device not available (#NM) handler
+	void fpu::trap([[maybe_unused]] const register_t* regs) noexcept {
+		sys::fpuTrap();
+	}
+
+
+	// Init FPU of current CPU (first use traps)
+	[[nodiscard]]
+	auto fpu::init() noexcept -> bool {
+
+		// Native x87 errors, no emulation
+		::inCR0((::outCR0() & ~(FPU_CR0_EM | FPU_CR0_TS)) | FPU_CR0_MP | FPU_CR0_NE);
+
+		// SSE is always there in long mode
+		auto cr4		{::outCR4() | FPU_CR4_OSFXSR | FPU_CR4_OSXMMEXCPT};
+		const auto features	{cpuid(cpuidFlags_t::INFO_PROC_VERSION)};
+
+		// Pick best save method
+		if (0_u32 == (features.ecx & FPU_CPUID_XSAVE)) {
+			::inCR4(cr4);
+		} else {
+			::inCR4(cr4 | FPU_CR4_OSXSAVE);
+			// Supported user state components
+			const auto state	{cpuid(cpuidFlags_t::INFO_EXTENDED_STATE, 0_u32)};
+			auto mask		{((static_cast<igros_quad_t>(state.edx) << 32) | state.eax) & (FPU_XCR0_X87 | FPU_XCR0_SSE | FPU_XCR0_AVX | FPU_XCR0_AVX512)};
+			// AVX-512 comes as a whole and only if area fits a page
+			if ((FPU_XCR0_AVX512 != (mask & FPU_XCR0_AVX512)) || (state.ecx > paging::PAGE_SIZE)) {
+				mask &= ~FPU_XCR0_AVX512;
+			}
+			::fpuXsetbv(0_u32, mask);
+			fpu::mMask = mask;
+			// Optimized variants
+			const auto ext {cpuid(cpuidFlags_t::INFO_EXTENDED_STATE, 1_u32)};
+			if (0_u32 != (ext.eax & FPU_CPUID_XSAVES)) {
+				// No supervisor components, compacted format only
+				::inMSR(FPU_XSS_MSR, 0_u64);
+				fpu::mMethod	= fpuMethod_t::XSAVES;
+				fpu::mSize	= ext.ebx;
+			} else {
+				fpu::mMethod	= (0_u32 != (ext.eax & FPU_CPUID_XSAVEOPT)) ? fpuMethod_t::XSAVEOPT : fpuMethod_t::XSAVE;
+				fpu::mSize	= cpuid(cpuidFlags_t::INFO_EXTENDED_STATE, 0_u32).ebx;
+			}
+		}
+
+		// Default state (once, on bootstrap processor)
+		if (nullptr == fpu::mDefault) {
+			fpu::mDefault = paging::allocate();
+			if (nullptr == fpu::mDefault) [[unlikely]] {
+				klib::kprintf("FPU:\t\tNo memory for default state\n");
+			} else {
+				// Header must be zeroed for XRSTOR
+				klib::kmemset(fpu::mDefault, paging::PAGE_SIZE, 0_u8);
+				::fpuReset();
+				fpu::save(fpu::mDefault);
+				// Lazy restore
+				except::install<except::NUMBER::NO_COPROCESSOR, fpu::trap>();
+				klib::kprintf("FPU:\t\tmethod %d, components 0x%x, area %z bytes\n", static_cast<igros_dword_t>(fpu::mMethod), static_cast<igros_dword_t>(fpu::mMask), fpu::mSize);
+			}
+		}
+
+		// First use traps
+		::fpuSetTS();
+		return nullptr != fpu::mDefault;
+
+	}
+
+
+	// Fill area with default state
+	void fpu::prepare(const igros_pointer_t area) noexcept {
+		klib::kmemcpy(area, fpu::mDefault, fpu::mSize);
+	}
+
+
+}	// namespace igros::x86_64
+
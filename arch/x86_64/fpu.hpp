@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////
+//
+//	FPU/SSE/AVX state management for x86_64
+//
+//	File:	fpu.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+// IgrOS-Kernel arch x86_64
+#include <arch/x86_64/register.hpp>
+
+
+#ifdef	__cplusplus
+
+extern "C" {
+
+#endif	// __cplusplus
+
+
+	// Load default x87/SSE state
+	void	fpuReset() noexcept;
+	// Allow FPU use (clear CR0.TS)
+	void	fpuClearTS() noexcept;
+	// Trap next FPU use (set CR0.TS)
+	void	fpuSetTS() noexcept;
+
+	// Write extended control register
+	void	fpuXsetbv(const igros::igros_dword_t index, const igros::igros_quad_t value) noexcept;
+
+	// Save x87/SSE state (legacy area)
+	void	fpuFxsave(const igros::igros_pointer_t area) noexcept;
+	// Restore x87/SSE state (legacy area)
+	void	fpuFxrstor(const igros::igros_pointer_t area) noexcept;
+	// Save extended state
+	void	fpuXsave(const igros::igros_pointer_t area, const igros::igros_quad_t mask) noexcept;
+	// Save modified extended state
+	void	fpuXsaveopt(const igros::igros_pointer_t area, const igros::igros_quad_t mask) noexcept;
+	// Save modified extended state (compacted)
+	void	fpuXsaves(const igros::igros_pointer_t area, const igros::igros_quad_t mask) noexcept;
+	// Restore extended state
+	void	fpuXrstor(const igros::igros_pointer_t area, const igros::igros_quad_t mask) noexcept;
+	// Restore extended state (compacted)
+	void	fpuXrstors(const igros::igros_pointer_t area, const igros::igros_quad_t mask) noexcept;
+
+
+#ifdef	__cplusplus
+
+}	// extern "C"
+
+#endif	// __cplusplus
+
+
+// x86_64 namespace
+namespace igros::x86_64 {
+
+
+	// State save method (best one is picked by CPUID)
+	enum class fpuMethod_t : igros_dword_t {
+		FXSAVE,					// x87/SSE only
+		XSAVE,					// Extended state
+		XSAVEOPT,				// Extended state, skips unmodified components
+		XSAVES					// Extended state, compacted, skips unmodified and init components
+	};
+
+
+	// FPU/SSE/AVX state management
+	class fpu final {
+
+		// State save method
+		static fpuMethod_t	mMethod;
+		// Enabled state components (XCR0)
+		static igros_quad_t	mMask;
+		// State area size
+		static igros_usize_t	mSize;
+		// Default state area (copied to new contexts)
+		static igros_pointer_t	mDefault;
+
+		// Device not available (#NM) handler
+		static void	trap(const register_t* regs) noexcept;
+
+		// Copy c-tor
+		fpu(const fpu &other) = delete;
+		// Copy assignment
+		auto	operator=(const fpu &other) -> fpu& = delete;
+
+		// Move c-tor
+		fpu(fpu &&other) = delete;
+		// Move assignment
+		auto	operator=(fpu &&other) -> fpu& = delete;
+
+
+	public:
+
+		// Default c-tor
+		fpu() noexcept = default;
+
+		// Init FPU of current CPU (first use traps)
+		[[nodiscard]]
+		static auto	init() noexcept -> bool;
+
+		// Get state save method
+		[[nodiscard]]
+		static auto	method() noexcept -> fpuMethod_t;
+		// Get state area size
+		[[nodiscard]]
+		static auto	size() noexcept -> igros_usize_t;
+
+		// Save state to area
+		static void	save(const igros_pointer_t area) noexcept;
+		// Restore state from area
+		static void	restore(const igros_pointer_t area) noexcept;
+		// Fill area with default state
+		static void	prepare(const igros_pointer_t area) noexcept;
+		// Load default state to registers
+		static void	reset() noexcept;
+
+		// Allow FPU use
+		static void	enable() noexcept;
+		// Trap next FPU use
+		static void	disable() noexcept;
+
+
+	};
+
+
+	// Get state save method
+	[[nodiscard]]
+	inline auto fpu::method() noexcept -> fpuMethod_t {
+		return fpu::mMethod;
+	}
+
+	// Get state area size
+	[[nodiscard]]
+	inline auto fpu::size() noexcept -> igros_usize_t {
+		return fpu::mSize;
+	}
+
+
+	// Save state to area
+	inline void fpu::save(const igros_pointer_t area) noexcept {
+		switch (fpu::mMethod) {
+			case fpuMethod_t::XSAVES:
+				::fpuXsaves(area, fpu::mMask);
+				break;
+			case fpuMethod_t::XSAVEOPT:
+				::fpuXsaveopt(area, fpu::mMask);
+				break;
+			case fpuMethod_t::XSAVE:
+				::fpuXsave(area, fpu::mMask);
+				break;
+			default:
+				::fpuFxsave(area);
+				break;
+		}
+	}
+
+	// Restore state from area
+	inline void fpu::restore(const igros_pointer_t area) noexcept {
+		switch (fpu::mMethod) {
+			case fpuMethod_t::XSAVES:
+				::fpuXrstors(area, fpu::mMask);
+				break;
+			case fpuMethod_t::XSAVEOPT:
+			case fpuMethod_t::XSAVE:
+				::fpuXrstor(area, fpu::mMask);
+				break;
+			default:
+				::fpuFxrstor(area);
+				break;
+		}
+	}
+
+
+	// Load default state to registers
+	inline void fpu::reset() noexcept {
+		::fpuReset();
+	}
+
+
+	// Allow FPU use
+	inline void fpu::enable() noexcept {
+		::fpuClearTS();
+	}
+
+	// Trap next FPU use
+	inline void fpu::disable() noexcept {
+		::fpuSetTS();
+	}
+
+
+}	// namespace igros::x86_64
+
@@ -83,6 +83,9 @@ namespace igros::x86_64 {
 		template<offset_t HANDLE, igros_word_t SELECTOR, igros_byte_t TYPE>
 		[[nodiscard]]
 		constexpr static auto	setEntry() noexcept -> entry_t;
+		// Set IDT entry (handler known at run time)
+		[[nodiscard]]
+		static auto		setEntry(const offset_t handle, const igros_word_t selector, const igros_byte_t type) noexcept -> entry_t;
 		// Calc IDT size
 		[[nodiscard]]
 		constexpr static auto	calcSize(const table_t &table) noexcept -> igros_word_t;
@@ -112,6 +115,20 @@ namespace igros::x86_64 {
 		};
 	}
 
+	// Set IDT entry (handler known at run time)
+	[[nodiscard]]
+	inline auto idt::setEntry(const offset_t handle, const igros_word_t selector, const igros_byte_t type) noexcept -> entry_t {
+		return entry_t {
+			.offsetLow	= static_cast<igros_word_t>(std::bit_cast<igros_usize_t>(handle) & 0xFFFF_u64),
+			.selector	= selector,
+			.ist		= 0_u8,
+			.type		= type,
+			.offsetMiddle	= static_cast<igros_word_t>((std::bit_cast<igros_usize_t>(handle) & 0xFFFF0000_u64) >> 16),
+			.offsetHigh	= static_cast<igros_dword_t>((std::bit_cast<igros_usize_t>(handle) & 0xFFFFFFFF00000000_u64) >> 32),
+			.reserved2	= 0_u32
+		};
+	}
+
 	// Calculate IDT size
 	[[nodiscard]]
 	constexpr auto idt::calcSize(const table_t &table) noexcept -> igros_word_t {
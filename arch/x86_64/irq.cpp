@@ -30,6 +30,11 @@ extern "C" {
 	void	irqEnable() noexcept;
 	// Disable interrupts
 	void	irqDisable() noexcept;
+	// Save flags and disable interrupts
+	[[nodiscard]]
+	auto	irqSave() noexcept -> igros::igros_usize_t;
+	// Restore flags
+	void	irqRestore(const igros::igros_usize_t flags) noexcept;
 
 
 #ifdef	__cplusplus
@@ -73,6 +78,17 @@ namespace igros::x86_64 {
 		::irqDisable();
 	}
 
+	// Save interrupts state and disable interrupts
+	[[nodiscard]]
+	auto irq::save() noexcept -> igros_usize_t {
+		return ::irqSave();
+	}
+
+	// Restore interrupts state
+	void irq::restore(const igros_usize_t flags) noexcept {
+		::irqRestore(flags);
+	}
+
 
 	// Mask interrupt
 	void irq::mask(const irq_t number) noexcept {
@@ -121,10 +137,9 @@ namespace igros::x86_64 {
 			if (static_cast<igros_dword_t>(number) > 39_u32) {
 				// Notify slave PIC
 				::inPort8(PIC_SLAVE_CONTROL, 0x20_u8);
-			} else {
-				// Notify master PIC
-				::inPort8(PIC_MASTER_CONTROL, 0x20_u8);
 			}
+			// Notify master PIC (cascade line is in service too)
+			::inPort8(PIC_MASTER_CONTROL, 0x20_u8);
 		}
 	}
 
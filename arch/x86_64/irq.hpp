@@ -28,38 +28,8 @@ extern "C" {
 #endif	// __cplusplus
 
 
-	// Interrupt 0 handler
-	void	irqHandler0() noexcept;
-	// Interrupt 1 handler
-	void	irqHandler1() noexcept;
-	// Interrupt 2 handler
-	void	irqHandler2() noexcept;
-	// Interrupt 3 handler
-	void	irqHandler3() noexcept;
-	// Interrupt 4 handler
-	void	irqHandler4() noexcept;
-	// Interrupt 5 handler
-	void	irqHandler5() noexcept;
-	// Interrupt 6 handler
-	void	irqHandler6() noexcept;
-	// Interrupt 7 handler
-	void	irqHandler7() noexcept;
-	// Interrupt 8 handler
-	void	irqHandler8() noexcept;
-	// Interrupt 9 handler
-	void	irqHandler9() noexcept;
-	// Interrupt 10 handler
-	void	irqHandlerA() noexcept;
-	// Interrupt 11 handler
-	void	irqHandlerB() noexcept;
-	// Interrupt 12 handler
-	void	irqHandlerC() noexcept;
-	// Interrupt 13 handler
-	void	irqHandlerD() noexcept;
-	// Interrupt 14 handler
-	void	irqHandlerE() noexcept;
-	// Interrupt 15 handler
-	void	irqHandlerF() noexcept;
+	// IRQ entry stubs (vectors 32 - 255)
+	extern const std::array<std::add_pointer_t<void ()>, igros::x86_64::ISR_SIZE - igros::x86_64::IRQ_OFFSET>	irqStubTable;
 
 
 #ifdef	__cplusplus
@@ -87,7 +57,8 @@ namespace igros::x86_64 {
 		KEYBOARD	= 1_u32,
 		PIC		= 2_u32,
 		UART2		= 3_u32,
-		UART1		= 4_u32
+		UART1		= 4_u32,
+		RTC		= 8_u32
 	};
 
 
@@ -107,6 +78,11 @@ namespace igros::x86_64 {
 
 	public:
 
+		// Shared IRQ handler result
+		using return_t	= isrReturn_t;
+		// Shared IRQ handler type (with device cookie)
+		using handler_t	= isrHandler_t;
+
 		// Default c-tor
 		irq() noexcept = default;
 
@@ -117,6 +93,11 @@ namespace igros::x86_64 {
 		static void	enable() noexcept;
 		// Disable interrupts
 		static void	disable() noexcept;
+		// Save interrupts state and disable interrupts
+		[[nodiscard]]
+		static auto	save() noexcept -> igros_usize_t;
+		// Restore interrupts state
+		static void	restore(const igros_usize_t flags) noexcept;
 
 		// Mask interrupt
 		static void	mask(const irq_t number) noexcept;
@@ -136,6 +117,12 @@ namespace igros::x86_64 {
 		template<irq_t N>
 		static void	uninstall() noexcept;
 
+		// Add shared IRQ handler
+		[[nodiscard]]
+		static auto	add(const irq_t number, const handler_t handler, const igros_pointer_t cookie) noexcept -> bool;
+		// Remove shared IRQ handler
+		static void	remove(const irq_t number, const handler_t handler, const igros_pointer_t cookie) noexcept;
+
 		// Send EOI (IRQ done)
 		static void	eoi(const irq_t number) noexcept;
 
@@ -147,7 +134,7 @@ namespace igros::x86_64 {
 	template<irq_t N, isr_t HANDLE>
 	inline void irq::install() noexcept {
 		// Install ISR
-		isrHandlerInstall(static_cast<igros_usize_t>(N) + IRQ_OFFSET, HANDLE);
+		isrHandlerInstall(static_cast<igros_usize_t>(N) + IRQ_OFFSET, isrWrap<HANDLE>);
 	}
 
 	// Uninstall handler
@@ -158,5 +145,17 @@ namespace igros::x86_64 {
 	}
 
 
+	// Add shared IRQ handler
+	[[nodiscard]]
+	inline auto irq::add(const irq_t number, const handler_t handler, const igros_pointer_t cookie) noexcept -> bool {
+		return isrHandlerAdd(static_cast<igros_usize_t>(number) + IRQ_OFFSET, handler, cookie);
+	}
+
+	// Remove shared IRQ handler
+	inline void irq::remove(const irq_t number, const handler_t handler, const igros_pointer_t cookie) noexcept {
+		isrHandlerRemove(static_cast<igros_usize_t>(number) + IRQ_OFFSET, handler, cookie);
+	}
+
+
 }	// namespace igros::x86_64
 
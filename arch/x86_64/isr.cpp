@@ -11,34 +11,224 @@
 //
 
 
+// C++
+#include <array>
+#include <bit>
 // IgrOS-Kernel arch x86_64
+#include <arch/x86_64/apic.hpp>
 #include <arch/x86_64/cpu.hpp>
 #include <arch/x86_64/io.hpp>
 #include <arch/x86_64/irq.hpp>
 #include <arch/x86_64/isr.hpp>
 #include <arch/x86_64/register.hpp>
 // IgrOS-Kernel library
+#include <klib/kLock.hpp>
 #include <klib/kprint.hpp>
+#include <klib/kRCU.hpp>
+// IgrOS-Kernel system
+#include <sys/irqtrace.hpp>
+#include <sys/sched.hpp>
+#include <sys/softirq.hpp>
 
 
 // x86_64 namespace
 namespace igros::x86_64 {
 
 
-	// Interrupt handlers
-	static auto isrList {std::array<isr_t, ISR_SIZE> {}};
+	// Interrupt enable flag
+	constexpr auto ISR_FLAGS_IF	{0x00000200_usize};
 
 
-	// Install interrupt service routine handler
-	void isrHandlerInstall(const igros_usize_t number, const isr_t handle) noexcept {
-		// Put interrupt service routine handler in ISRs list
-		isrList[number] = handle;
+	// Max number of installed handlers (all vectors)
+	constexpr auto ISR_ACTIONS_MAX	{128_usize};
+
+
+	// Installed handler
+	struct isrAction_t {
+		klib::kRCUHead		rcu;			// Reclaim after grace period (must be first)
+		isrAction_t*		next;			// Next handler sharing vector
+		isrHandler_t		handler;		// Handler (nullptr if free)
+		igros_pointer_t		cookie;			// Device cookie
+	};
+
+
+	// Interrupt handler chains
+	static auto isrList		{std::array<isrAction_t*, ISR_SIZE> {}};
+	// Handlers pool
+	static auto isrActions		{std::array<isrAction_t, ISR_ACTIONS_MAX> {}};
+	// Unclaimed interrupts count
+	static auto isrUnhandled	{std::array<igros_usize_t, ISR_SIZE> {}};
+	// Allocated message signalled interrupts vectors bitmap
+	static auto isrVectors		{std::array<igros_quad_t, ISR_SIZE / 64_usize> {}};
+	// Handler chains update lock
+	static klib::kSpinlock<>	isrLock {};
+
+
+	// Take free handler from pool (lock held)
+	[[nodiscard]]
+	static auto isrAlloc(const isrHandler_t handle, const igros_pointer_t cookie) noexcept -> isrAction_t* {
+		for (auto &action : isrActions) {
+			if (nullptr == action.handler) {
+				action.next	= nullptr;
+				action.handler	= handle;
+				action.cookie	= cookie;
+				return &action;
+			}
+		}
+		return nullptr;
+	}
+
+	// Return handler to pool (no CPU may run it anymore)
+	static void isrFree(klib::kRCUHead* const head) noexcept {
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {isrLock};
+		std::bit_cast<isrAction_t*>(head)->handler = nullptr;
 	}
 
-	// Uninstall interrupt service routine handler
+	// Free unlinked handlers after grace period
+	static void isrRetire(isrAction_t* action) noexcept {
+		while (nullptr != action) {
+			// Next is gone once callback runs
+			const auto next {action->next};
+			klib::kRCU::call(&action->rcu, isrFree);
+			action = next;
+		}
+	}
+
+
+	// Install interrupt service routine handler (replaces all others)
+	void isrHandlerInstall(const igros_usize_t number, const isrHandler_t handle, const igros_pointer_t cookie) noexcept {
+		auto old {static_cast<isrAction_t*>(nullptr)};
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {isrLock};
+			const auto action {isrAlloc(handle, cookie)};
+			if (nullptr == action) [[unlikely]] {
+				return;
+			}
+			// Publish interrupt service routine handler in ISRs list
+			old = isrList[number];
+			klib::kRCU::assign(isrList[number], action);
+		}
+		isrRetire(old);
+	}
+
+	// Uninstall all interrupt service routine handlers
 	void isrHandlerUninstall(const igros_usize_t number) noexcept {
-		// Remove interrupt service routine handler from ISRs list
-		isrList[number] = nullptr;
+		auto old {static_cast<isrAction_t*>(nullptr)};
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {isrLock};
+			// Remove interrupt service routine handlers from ISRs list
+			old = isrList[number];
+			klib::kRCU::assign(isrList[number], static_cast<isrAction_t*>(nullptr));
+		}
+		// Wait till no CPU runs old handler
+		klib::kRCU::synchronize();
+		isrRetire(old);
+	}
+
+
+	// Add shared interrupt service routine handler
+	[[nodiscard]]
+	auto isrHandlerAdd(const igros_usize_t number, const isrHandler_t handle, const igros_pointer_t cookie) noexcept -> bool {
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {isrLock};
+		const auto action {isrAlloc(handle, cookie)};
+		if (nullptr == action) [[unlikely]] {
+			return false;
+		}
+		// Append (handlers run in registration order)
+		auto slot {&isrList[number]};
+		while (nullptr != *slot) {
+			slot = &(*slot)->next;
+		}
+		klib::kRCU::assign(*slot, action);
+		return true;
+	}
+
+	// Remove shared interrupt service routine handler
+	void isrHandlerRemove(const igros_usize_t number, const isrHandler_t handle, const igros_pointer_t cookie) noexcept {
+		auto old {static_cast<isrAction_t*>(nullptr)};
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {isrLock};
+			for (auto slot {&isrList[number]}; nullptr != *slot; slot = &(*slot)->next) {
+				if (((*slot)->handler == handle) && ((*slot)->cookie == cookie)) {
+					// Readers still in it go on to the rest of chain
+					old = *slot;
+					klib::kRCU::assign(*slot, old->next);
+					break;
+				}
+			}
+		}
+		if (nullptr != old) {
+			// Wait till no CPU runs old handler
+			klib::kRCU::synchronize();
+			isrFree(&old->rcu);
+		}
+	}
+
+
+	// Allocate block of free vectors (count is power of two, block is aligned to it)
+	[[nodiscard]]
+	auto isrVectorAlloc(const igros_usize_t count) noexcept -> igros_usize_t {
+		if ((0_usize == count) || (0_usize != (count & (count - 1_usize)))) [[unlikely]] {
+			return ISR_VECTOR_NONE;
+		}
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {isrLock};
+		// Multiple message MSI puts message number in low vector bits
+		for (auto first {(ISR_DYNAMIC_FIRST + count - 1_usize) & ~(count - 1_usize)}; (first + count) <= ISR_DYNAMIC_END; first += count) {
+			auto free {true};
+			for (auto i {first}; free && (i < (first + count)); i++) {
+				free = 0_u64 == (isrVectors[i >> 6] & (1_u64 << (i & 63_usize)));
+			}
+			if (free) {
+				for (auto i {first}; i < (first + count); i++) {
+					isrVectors[i >> 6] |= 1_u64 << (i & 63_usize);
+				}
+				return first;
+			}
+		}
+		return ISR_VECTOR_NONE;
+	}
+
+	// Free block of vectors
+	void isrVectorFree(const igros_usize_t first, const igros_usize_t count) noexcept {
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {isrLock};
+		for (auto i {first}; (i < (first + count)) && (i < ISR_DYNAMIC_END); i++) {
+			isrVectors[i >> 6] &= ~(1_u64 << (i & 63_usize));
+		}
+	}
+
+
+	// Run handlers of vector (false if none installed)
+	[[nodiscard]]
+	static auto isrDispatch(const register_t* const regs) noexcept -> bool {
+		const auto action {klib::kRCU::dereference(isrList[regs->number])};
+		if (nullptr == action) [[unlikely]] {
+			return false;
+		}
+		auto handled {false};
+		// Single handler fast path
+		if (const auto next {klib::kRCU::dereference(action->next)}; nullptr == next) [[likely]] {
+			handled = (isrReturn_t::HANDLED == action->handler(regs, action->cookie));
+		// Shared vector - ask every device
+		} else {
+			handled = (isrReturn_t::HANDLED == action->handler(regs, action->cookie));
+			for (auto other {next}; nullptr != other; other = klib::kRCU::dereference(other->next)) {
+				handled = (isrReturn_t::HANDLED == other->handler(regs, other->cookie)) || handled;
+			}
+		}
+		// Nobody claimed it (report at powers of two)
+		if (!handled) [[unlikely]] {
+			if (const auto count {++isrUnhandled[regs->number]}; 0_usize == (count & (count - 1_usize))) {
+				klib::kprintf("ISR:\t\t#%z unhandled %z times\n", static_cast<igros_usize_t>(regs->number), count);
+			}
+		}
+		// PIC IRQ done (once for all handlers)
+		if ((regs->number >= IRQ_OFFSET) && (regs->number < (IRQ_OFFSET + IRQ_PIC_SIZE))) {
+			irq::eoi(static_cast<irq_t>(regs->number));
+		// Message signalled IRQ done (local APIC)
+		} else if ((regs->number >= (IRQ_OFFSET + IRQ_PIC_SIZE)) && apic::isAvailable()) {
+			apic::eoi();
+		}
+		return true;
 	}
 
 
@@ -53,10 +243,17 @@ extern "C" {
 
 	// Interrupts handler function
 	void isrHandler(const igros::x86_64::register_t* regs) noexcept {
+		// Handler duration and interrupts-off tracing
+		const auto start {igros::sys::irqTraceEnter(regs->number, regs->rflags)};
+		// Idle CPU becomes RCU reader
+		igros::klib::kRCU::irqEnter();
+		// Softirqs raised from now on run on exit
+		igros::sys::softirqIRQEnter();
+		// ISRs list is RCU protected (lockless read)
+		igros::klib::kRCU::readLock();
 		// Check if irq/exception handler installed
-		if (const auto isr = igros::x86_64::isrList[regs->number]; nullptr != isr) {
-			// Handle ISR
-			isr(regs);
+		if (igros::x86_64::isrDispatch(regs)) [[likely]] {
+			igros::sys::irqTraceExit(regs->number, start);
 		} else {
 			// Disable interrupts
 			igros::x86_64::irq::disable();
@@ -72,6 +269,16 @@ R"unhandled(
 			// Hang CPU
 			igros::x86_64::cpu::halt();
 		}
+		// Leave read-side critical section
+		igros::klib::kRCU::readUnlock();
+		// Deferred work (only where interrupted code allows interrupts)
+		igros::sys::softirqIRQExit(igros::x86_64::ISR_FLAGS_IF == (regs->rflags & igros::x86_64::ISR_FLAGS_IF));
+		// Back to idle if interrupted idle
+		igros::klib::kRCU::irqExit();
+		// Switch thread if time slice is over
+		igros::sys::sched::preempt();
+		// Interrupts are enabled again on return
+		igros::sys::irqTraceReturn(regs->rflags);
 	}
 
 #ifdef	__cplusplus
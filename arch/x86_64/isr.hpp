@@ -29,18 +29,59 @@ namespace igros::x86_64 {
 
 	// IRQ offset in ISR list
 	constexpr auto IRQ_OFFSET	{32_usize};
+	// Legacy PIC IRQs count
+	constexpr auto IRQ_PIC_SIZE	{16_usize};
 	// ISR list size
 	constexpr auto ISR_SIZE		{256_usize};
+	// First vector handed out to message signalled interrupts (after legacy PIC IRQs)
+	constexpr auto ISR_DYNAMIC_FIRST	{IRQ_OFFSET + IRQ_PIC_SIZE};
+	// End of message signalled interrupts vectors (HPET comparators and local APIC above)
+	constexpr auto ISR_DYNAMIC_END		{0xD0_usize};
+	// No vector allocated
+	constexpr auto ISR_VECTOR_NONE		{0_usize};
 
 	// Interrupt service routine handler type
 	using isr_t			= std::add_pointer_t<void (const register_t* const)>;
 
-	// Install interrupt service routine handler
-	void	isrHandlerInstall(const igros_usize_t number, const isr_t handle) noexcept;
+	// Interrupt service routine result
+	enum class isrReturn_t : igros_dword_t {
+		NONE,					// Not our device
+		HANDLED					// Interrupt handled
+	};
 
-	// Uninstall interrupt service routine handler
+	// Shared interrupt service routine handler type (with device cookie)
+	using isrHandler_t		= std::add_pointer_t<isrReturn_t (const register_t* const, const igros_pointer_t)>;
+
+
+	// Plain handler adapter
+	template<isr_t HANDLE>
+	auto	isrWrap(const register_t* const regs, const igros_pointer_t cookie) noexcept -> isrReturn_t;
+
+	// Install interrupt service routine handler (replaces all others)
+	void	isrHandlerInstall(const igros_usize_t number, const isrHandler_t handle, const igros_pointer_t cookie = nullptr) noexcept;
+	// Uninstall all interrupt service routine handlers
 	void	isrHandlerUninstall(const igros_usize_t number) noexcept;
 
+	// Add shared interrupt service routine handler
+	[[nodiscard]]
+	auto	isrHandlerAdd(const igros_usize_t number, const isrHandler_t handle, const igros_pointer_t cookie) noexcept -> bool;
+	// Remove shared interrupt service routine handler
+	void	isrHandlerRemove(const igros_usize_t number, const isrHandler_t handle, const igros_pointer_t cookie) noexcept;
+
+	// Allocate block of free vectors (count is power of two, block is aligned to it)
+	[[nodiscard]]
+	auto	isrVectorAlloc(const igros_usize_t count) noexcept -> igros_usize_t;
+	// Free block of vectors
+	void	isrVectorFree(const igros_usize_t first, const igros_usize_t count) noexcept;
+
+
+	// Plain handler adapter
+	template<isr_t HANDLE>
+	inline auto isrWrap(const register_t* const regs, [[maybe_unused]] const igros_pointer_t cookie) noexcept -> isrReturn_t {
+		HANDLE(regs);
+		return isrReturn_t::HANDLED;
+	}
+
 
 }	// namespace igros::x86_64
 
@@ -27,10 +27,10 @@ extern "C" {
 
 	// Read MSR register
 	[[nodiscard]]
-	auto	outMSR(const igros::igros_dword_t reg) noexcept -> igros::igros_dword_t;
+	auto	outMSR(const igros::igros_dword_t reg) noexcept -> igros::igros_quad_t;
 
 	// Write MSR register
-	void	inMSR(const igros::igros_dword_t reg, const igros::igros_dword_t value) noexcept;
+	void	inMSR(const igros::igros_dword_t reg, const igros::igros_quad_t value) noexcept;
 
 
 #ifdef	__cplusplus
@@ -24,6 +24,7 @@
 #include <arch/x86_64/register.hpp>
 // IgrOS-Kernel library
 #include <klib/kAlign.hpp>
+#include <klib/kLock.hpp>
 #include <klib/kFlags.hpp>
 #include <klib/kmemory.hpp>
 #include <klib/kprint.hpp>
@@ -37,6 +38,30 @@ namespace igros::x86_64 {
 
 	// Free pages list
 	paging::table_t* paging::mFreePages	{std::bit_cast<table_t*>(&paging::mFreePages)};
+	// Free pages list lock
+	static klib::kSpinlock<>	pagingLock {};
+
+	// Kernel image and heap virtual offset (-2Gb -> 0)
+	constexpr auto PAGE_KERNEL_VMA		{0xFFFFFFFF80000000_usize};
+	// Kernel stacks area (PML4 entry 510, nothing else lives there)
+	constexpr auto PAGE_STACK_PML4		{510_usize};
+	constexpr auto PAGE_STACK_AREA		{0xFFFFFF0000000000_usize};
+	// Present and writable table or page entry
+	constexpr auto PAGE_STACK_ENTRY		{0x0000000000000003_u64};
+	// Stack slot (guard page, then stack pages)
+	constexpr auto PAGE_STACK_SLOT		{paging::STACK_PAGES + 1_usize};
+
+	static_assert(paging::STACK_SLOTS * PAGE_STACK_SLOT <= paging::PAGE_TABLE_SIZE, "Kernel stacks do not fit single page table!");
+
+
+	// Kernel stacks area tables (kernel image, so physical address is known)
+	alignas(paging::PAGE_SIZE) static std::array<igros_quad_t, paging::PAGE_TABLE_SIZE>	pagingStackPDP		{};
+	alignas(paging::PAGE_SIZE) static std::array<igros_quad_t, paging::PAGE_TABLE_SIZE>	pagingStackPD		{};
+	alignas(paging::PAGE_SIZE) static std::array<igros_quad_t, paging::PAGE_TABLE_SIZE>	pagingStackPT		{};
+	// Kernel stacks area is linked into page map
+	static bool				pagingStackReady	{false};
+	// Kernel stacks area link lock
+	static klib::kSpinlock<>		pagingStackLock		{};
 
 
 	// Kernel memory map structure
@@ -152,6 +177,8 @@ namespace igros::x86_64 {
 	// Allocate page
 	[[nodiscard]]
 	igros_pointer_t paging::allocate() noexcept {
+		// Free pages list is shared by all CPUs
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {pagingLock};
 		// Check if pages exist
 		if (paging::mFreePages->next != paging::mFreePages) {
 			// Get free page
@@ -171,12 +198,48 @@ namespace igros::x86_64 {
 		if (!klib::kAlign::check(page, PAGE_SHIFT)) {
 			return;
 		}
+		// Free pages list is shared by all CPUs
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {pagingLock};
 		// Deallocate page back to heap free list
 		static_cast<table_t*>(page)->next = paging::mFreePages;
 		paging::mFreePages = static_cast<table_t*>(page);
 	}
 
 
+	// Get kernel stack of slot (mapped on first use, guard page below stays unmapped)
+	[[nodiscard]]
+	auto paging::stack(const igros_usize_t slot) noexcept -> igros_pointer_t {
+		if (slot >= STACK_SLOTS) [[unlikely]] {
+			return nullptr;
+		}
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {pagingStackLock};
+			if (!pagingStackReady) {
+				pagingStackPD[0_usize]		= (std::bit_cast<igros_usize_t>(pagingStackPT.data()) - PAGE_KERNEL_VMA) | PAGE_STACK_ENTRY;
+				pagingStackPDP[0_usize]		= (std::bit_cast<igros_usize_t>(pagingStackPD.data()) - PAGE_KERNEL_VMA) | PAGE_STACK_ENTRY;
+				// Page map is shared by all CPUs and identity mapped
+				const auto pml4			{std::bit_cast<igros_quad_t*>(static_cast<igros_usize_t>(::outCR3() & ~PAGE_MASK))};
+				pml4[PAGE_STACK_PML4]		= (std::bit_cast<igros_usize_t>(pagingStackPDP.data()) - PAGE_KERNEL_VMA) | PAGE_STACK_ENTRY;
+				pagingStackReady		= true;
+			}
+		}
+		// Slot belongs to single thread, its first page is guard and never mapped
+		const auto first {slot * PAGE_STACK_SLOT + 1_usize};
+		for (auto i {first}; i < (first + STACK_PAGES); i++) {
+			// Pages stay mapped after thread exit, so slot is never remapped (no TLB shootdown)
+			if (0_u64 == (pagingStackPT[i] & PAGE_STACK_ENTRY)) {
+				const auto page {paging::allocate()};
+				if (nullptr == page) [[unlikely]] {
+					return nullptr;
+				}
+				// Not present entries are never cached, no flush needed
+				pagingStackPT[i] = (std::bit_cast<igros_usize_t>(page) - PAGE_KERNEL_VMA) | PAGE_STACK_ENTRY;
+			}
+		}
+		return std::bit_cast<igros_pointer_t>(PAGE_STACK_AREA + (first << PAGE_SHIFT));
+	}
+
+
 	// Make PML4
 	[[nodiscard]]
 	paging::pml4_t* paging::makePML4() noexcept {
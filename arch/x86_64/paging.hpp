@@ -47,6 +47,12 @@ namespace igros::x86_64 {
 		constexpr static auto	PAGE_SIZE			{1_usize << PAGE_SHIFT};
 		// Page mask
 		constexpr static auto	PAGE_MASK			{PAGE_SIZE - 1_usize};
+		// Kernel stack pages
+		constexpr static auto	STACK_PAGES			{4_usize};
+		// Kernel stack size
+		constexpr static auto	STACK_SIZE			{STACK_PAGES << PAGE_SHIFT};
+		// Kernel stack slots
+		constexpr static auto	STACK_SLOTS			{64_usize};
 
 
 #pragma push(pack, 1)
@@ -149,6 +155,10 @@ namespace igros::x86_64 {
 		// Deallocate page
 		static void	deallocate(const igros_pointer_t page) noexcept;
 
+		// Get kernel stack of slot (mapped on first use, guard page below stays unmapped)
+		[[nodiscard]]
+		static auto	stack(const igros_usize_t slot) noexcept -> igros_pointer_t;
+
 		// Make PML4
 		[[nodiscard]]
 		static auto	makePML4() noexcept -> pml4_t*;
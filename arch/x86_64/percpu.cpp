@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////
+//
+//	Per-CPU data area for x86_64
+//
+//	File:	percpu.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+// IgrOS-Kernel arch x86_64
+#include <arch/x86_64/msr.hpp>
+#include <arch/x86_64/percpu.hpp>
+#include <arch/x86_64/smp.hpp>
+
+
+// x86_64 namespace
+namespace igros::x86_64 {
+
+
+	// Active GS base MSR
+	constexpr auto PERCPU_GS_BASE_MSR		{0xC0000101_u32};
+	// Inactive GS base MSR (swapped in by "swapgs")
+	constexpr auto PERCPU_KERNEL_GS_BASE_MSR	{0xC0000102_u32};
+
+
+	// Per-CPU data blocks
+	static std::array<percpu_t, SMP_MAX_CPUS>	percpuBlocks {};
+
+
+	// Init per-CPU data block of current CPU
+	void percpuInit(const igros_usize_t id, const igros_dword_t apicID) noexcept {
+		// Fill block
+		auto &block		{percpuBlocks[id]};
+		block.self		= &block;
+		block.id		= id;
+		block.apicID		= apicID;
+		block.preemptCount	= 0_u32;
+		block.needResched	= 0_u32;
+		block.irqNesting	= 0_usize;
+		block.current		= nullptr;
+		// Kernel runs with GS pointing to its block, user GS base is swapped in on return to user
+		::inMSR(PERCPU_GS_BASE_MSR, std::bit_cast<igros_quad_t>(&block));
+		::inMSR(PERCPU_KERNEL_GS_BASE_MSR, 0_u64);
+	}
+
+	// Get per-CPU data block of CPU by index
+	[[nodiscard]]
+	auto percpuOf(const igros_usize_t id) noexcept -> percpu_t* {
+		return &percpuBlocks[id];
+	}
+
+
+}	// namespace igros::x86_64
+
@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////
+//
+//	Per-CPU data area for x86_64
+//
+//	File:	percpu.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+#ifdef	__cplusplus
+
+extern "C" {
+
+#endif	// __cplusplus
+
+
+	// Read per-CPU byte
+	[[nodiscard]]
+	auto	percpuRead8(const igros::igros_usize_t offset) noexcept -> igros::igros_byte_t;
+	// Read per-CPU word
+	[[nodiscard]]
+	auto	percpuRead16(const igros::igros_usize_t offset) noexcept -> igros::igros_word_t;
+	// Read per-CPU long
+	[[nodiscard]]
+	auto	percpuRead32(const igros::igros_usize_t offset) noexcept -> igros::igros_dword_t;
+	// Read per-CPU quad
+	[[nodiscard]]
+	auto	percpuRead64(const igros::igros_usize_t offset) noexcept -> igros::igros_quad_t;
+
+	// Write per-CPU byte
+	void	percpuWrite8(const igros::igros_usize_t offset, const igros::igros_byte_t value) noexcept;
+	// Write per-CPU word
+	void	percpuWrite16(const igros::igros_usize_t offset, const igros::igros_word_t value) noexcept;
+	// Write per-CPU long
+	void	percpuWrite32(const igros::igros_usize_t offset, const igros::igros_dword_t value) noexcept;
+	// Write per-CPU quad
+	void	percpuWrite64(const igros::igros_usize_t offset, const igros::igros_quad_t value) noexcept;
+
+	// Add to per-CPU byte
+	void	percpuAdd8(const igros::igros_usize_t offset, const igros::igros_byte_t value) noexcept;
+	// Add to per-CPU word
+	void	percpuAdd16(const igros::igros_usize_t offset, const igros::igros_word_t value) noexcept;
+	// Add to per-CPU long
+	void	percpuAdd32(const igros::igros_usize_t offset, const igros::igros_dword_t value) noexcept;
+	// Add to per-CPU quad
+	void	percpuAdd64(const igros::igros_usize_t offset, const igros::igros_quad_t value) noexcept;
+
+
+#ifdef	__cplusplus
+
+}	// extern "C"
+
+#endif	// __cplusplus
+
+
+// x86_64 namespace
+namespace igros::x86_64 {
+
+
+	// Per-CPU data block (addressed via GS base)
+	struct alignas(64) percpu_t {
+		percpu_t*		self;		// Block linear address (must be first)
+		igros_usize_t		id;		// CPU index
+		igros_dword_t		apicID;		// Local APIC ID
+		igros_dword_t		preemptCount;	// Preemption disable depth
+		igros_dword_t		needResched;	// Reschedule requested
+		igros_dword_t		reserved;	// Reserved
+		igros_usize_t		irqNesting;	// Interrupt nesting depth
+		igros_pointer_t		current;	// Current thread
+	};
+
+
+	// Per-CPU variable accessor
+	template<typename T, igros_usize_t OFFSET>
+	class percpu final {
+
+		// Only register-sized trivial values can be accessed with single instruction
+		static_assert(std::is_trivially_copyable_v<T>, "Per-CPU value must be trivially copyable!");
+		static_assert(
+			(1_usize == sizeof(T)) || (2_usize == sizeof(T)) || (4_usize == sizeof(T)) || (8_usize == sizeof(T)),
+			"Per-CPU value must be 1, 2, 4 or 8 bytes long!"
+		);
+		static_assert(0_usize == (OFFSET % sizeof(T)), "Per-CPU value must be naturally aligned!");
+		static_assert((OFFSET + sizeof(T)) <= sizeof(percpu_t), "Per-CPU value is out of block bounds!");
+
+		// Copy c-tor
+		percpu(const percpu &other) = delete;
+		// Copy assignment
+		auto	operator=(const percpu &other) -> percpu& = delete;
+
+		// Move c-tor
+		percpu(percpu &&other) = delete;
+		// Move assignment
+		auto	operator=(percpu &&other) -> percpu& = delete;
+
+
+	public:
+
+		// Default c-tor
+		percpu() noexcept = default;
+
+		// Read value of current CPU
+		[[nodiscard]]
+		static auto	read() noexcept -> T;
+		// Write value of current CPU
+		static void	write(const T value) noexcept;
+		// Add to value of current CPU
+		static void	add(const T value) noexcept requires std::is_integral_v<T>;
+
+		// Get pointer to value of current CPU
+		[[nodiscard]]
+		static auto	ptr() noexcept -> T*;
+
+
+	};
+
+
+	// Init per-CPU data block of current CPU
+	void	percpuInit(const igros_usize_t id, const igros_dword_t apicID) noexcept;
+
+	// Get per-CPU data block of current CPU
+	[[nodiscard]]
+	inline auto percpuSelf() noexcept -> percpu_t* {
+		return std::bit_cast<percpu_t*>(static_cast<igros_usize_t>(::percpuRead64(offsetof(percpu_t, self))));
+	}
+
+	// Get per-CPU data block of CPU by index
+	[[nodiscard]]
+	auto	percpuOf(const igros_usize_t id) noexcept -> percpu_t*;
+
+
+	// Read value of current CPU
+	template<typename T, igros_usize_t OFFSET>
+	[[nodiscard]]
+	inline auto percpu<T, OFFSET>::read() noexcept -> T {
+		if constexpr (1_usize == sizeof(T)) {
+			return std::bit_cast<T>(::percpuRead8(OFFSET));
+		} else if constexpr (2_usize == sizeof(T)) {
+			return std::bit_cast<T>(::percpuRead16(OFFSET));
+		} else if constexpr (4_usize == sizeof(T)) {
+			return std::bit_cast<T>(::percpuRead32(OFFSET));
+		} else {
+			return std::bit_cast<T>(::percpuRead64(OFFSET));
+		}
+	}
+
+	// Write value of current CPU
+	template<typename T, igros_usize_t OFFSET>
+	inline void percpu<T, OFFSET>::write(const T value) noexcept {
+		if constexpr (1_usize == sizeof(T)) {
+			::percpuWrite8(OFFSET, std::bit_cast<igros_byte_t>(value));
+		} else if constexpr (2_usize == sizeof(T)) {
+			::percpuWrite16(OFFSET, std::bit_cast<igros_word_t>(value));
+		} else if constexpr (4_usize == sizeof(T)) {
+			::percpuWrite32(OFFSET, std::bit_cast<igros_dword_t>(value));
+		} else {
+			::percpuWrite64(OFFSET, std::bit_cast<igros_quad_t>(value));
+		}
+	}
+
+	// Add to value of current CPU
+	template<typename T, igros_usize_t OFFSET>
+	inline void percpu<T, OFFSET>::add(const T value) noexcept requires std::is_integral_v<T> {
+		if constexpr (1_usize == sizeof(T)) {
+			::percpuAdd8(OFFSET, static_cast<igros_byte_t>(value));
+		} else if constexpr (2_usize == sizeof(T)) {
+			::percpuAdd16(OFFSET, static_cast<igros_word_t>(value));
+		} else if constexpr (4_usize == sizeof(T)) {
+			::percpuAdd32(OFFSET, static_cast<igros_dword_t>(value));
+		} else {
+			::percpuAdd64(OFFSET, static_cast<igros_quad_t>(value));
+		}
+	}
+
+	// Get pointer to value of current CPU
+	template<typename T, igros_usize_t OFFSET>
+	[[nodiscard]]
+	inline auto percpu<T, OFFSET>::ptr() noexcept -> T* {
+		return std::bit_cast<T*>(std::bit_cast<igros_usize_t>(percpuSelf()) + OFFSET);
+	}
+
+
+}	// namespace igros::x86_64
+
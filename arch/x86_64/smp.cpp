@@ -0,0 +1,296 @@
+////////////////////////////////////////////////////////////////
+//
+//	Symmetric multiprocessing for x86_64
+//
+//	File:	smp.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <bit>
+// IgrOS-Kernel arch x86_64
+#include <arch/x86_64/apic.hpp>
+#include <arch/x86_64/atomic.hpp>
+#include <arch/x86_64/cpu.hpp>
+#include <arch/x86_64/cr.hpp>
+#include <arch/x86_64/gdt.hpp>
+#include <arch/x86_64/idt.hpp>
+#include <arch/x86_64/irq.hpp>
+#include <arch/x86_64/percpu.hpp>
+#include <arch/x86_64/smp.hpp>
+// IgrOS-Kernel drivers
+#include <drivers/acpi/acpi.hpp>
+#include <drivers/clock/pit.hpp>
+// IgrOS-Kernel library
+#include <klib/kmemory.hpp>
+#include <klib/kprint.hpp>
+#include <klib/kRCU.hpp>
+// IgrOS-Kernel system
+#include <sys/clockevent.hpp>
+#include <sys/fpu.hpp>
+#include <sys/sched.hpp>
+#include <sys/softirq.hpp>
+
+
+#ifdef	__cplusplus
+
+extern "C" {
+
+#endif	// __cplusplus
+
+
+	// Trampoline start
+	extern const igros::igros_byte_t	trampolineStart[];
+	// Trampoline data
+	extern const igros::igros_byte_t	trampolineData[];
+	// Trampoline end
+	extern const igros::igros_byte_t	trampolineEnd[];
+
+
+#ifdef	__cplusplus
+
+}	// extern "C"
+
+#endif	// __cplusplus
+
+
+// x86_64 namespace
+namespace igros::x86_64 {
+
+
+#pragma pack(push, 1)
+
+	// Trampoline data layout (see trampoline.s)
+	struct smpTrampoline_t {
+		igros_dword_t		pml4;
+		igros_dword_t		reserved;
+		igros_quad_t		stack;
+		igros_quad_t		entry;
+		igros_quad_t		id;
+	};
+
+#pragma pack(pop)
+
+
+	// INIT IPI settle delay (10 ms)
+	constexpr auto SMP_DELAY_INIT		{10000_u32};
+	// STARTUP IPI delay (200 us)
+	constexpr auto SMP_DELAY_STARTUP	{200_u32};
+	// Application processor startup poll step (100 us)
+	constexpr auto SMP_DELAY_POLL		{100_u32};
+	// Application processor startup timeout (in poll steps, ~100 ms)
+	constexpr auto SMP_STARTUP_TIMEOUT	{1000_usize};
+	// Number of STARTUP IPIs to send
+	constexpr auto SMP_STARTUP_TRIES	{2_usize};
+
+	// Local APIC enabled flag
+	constexpr auto SMP_LAPIC_ENABLED	{0x00000001_u32};
+	// Max local APIC ID reachable with xAPIC
+	constexpr auto SMP_XAPIC_MAX		{0xFF_u32};
+
+
+	// Application processors stacks
+	alignas(16) static std::array<std::array<igros_byte_t, SMP_STACK_SIZE>, SMP_MAX_CPUS>	smpStacks {};
+
+
+	// Online CPUs mask
+	igros_quad_t					smp::mOnline	{0_u64};
+	// Number of known CPUs
+	igros_usize_t					smp::mCount	{1_usize};
+	// CPU index to local APIC ID map
+	std::array<igros_dword_t, SMP_MAX_CPUS>		smp::mApicIDs	{};
+
+
+	// Init SMP (start all application processors)
+	void smp::init() noexcept {
+
+		// Bootstrap processor is always online
+		smp::mOnline	= 1_u64;
+		smp::mCount	= 1_usize;
+
+		// Need MADT to find application processors
+		if (nullptr == arch::acpi::madt()) [[unlikely]] {
+			klib::kprintf("SMP:\t\tno MADT, single CPU\n");
+			return;
+		}
+
+		// Enable bootstrap processor local APIC
+		apic::init();
+		smp::mApicIDs[0_usize] = apic::id();
+		percpu<igros_dword_t, offsetof(percpu_t, apicID)>::write(smp::mApicIDs[0_usize]);
+
+		// Copy trampoline to low memory
+		klib::kmemcpy(
+			std::bit_cast<igros_byte_t*>(SMP_TRAMPOLINE),
+			const_cast<igros_byte_t*>(trampolineStart),
+			std::bit_cast<igros_usize_t>(&trampolineEnd[0]) - std::bit_cast<igros_usize_t>(&trampolineStart[0])
+		);
+
+		// Enumerate processors
+		for (const auto &entry : arch::acpi::madtEntries()) {
+			// Only xAPIC processors are supported
+			if (arch::acpiMADTType_t::LAPIC != entry.type) {
+				continue;
+			}
+			// Get processor entry
+			const auto lapic {arch::acpiEntryCast<arch::acpiMADTLAPIC_t>(entry)};
+			if (
+				(nullptr == lapic)							||
+				(0_u32 == (lapic->flags & SMP_LAPIC_ENABLED))				||
+				(smp::mApicIDs[0_usize] == lapic->apicID)				||
+				(SMP_XAPIC_MAX == lapic->apicID)
+			) {
+				continue;
+			}
+			// Check CPUs limit
+			if (smp::mCount >= SMP_MAX_CPUS) [[unlikely]] {
+				break;
+			}
+			// Register processor
+			const auto id		{smp::mCount++};
+			smp::mApicIDs[id]	= lapic->apicID;
+			// Start processor
+			if (!smp::start(id)) [[unlikely]] {
+				klib::kprintf("SMP:\t\tCPU #%z (APIC #%d) failed to start\n", id, smp::mApicIDs[id]);
+			}
+		}
+
+		// Print result
+		klib::kprintf("SMP:\t\t%z of %z CPUs online\n", smp::count(), smp::mCount);
+
+	}
+
+
+	// Start application processor
+	[[nodiscard]]
+	bool smp::start(const igros_usize_t id) noexcept {
+
+		// Fill trampoline data
+		const auto data	{std::bit_cast<smpTrampoline_t*>(SMP_TRAMPOLINE + std::bit_cast<igros_usize_t>(&trampolineData[0]) - std::bit_cast<igros_usize_t>(&trampolineStart[0]))};
+		data->pml4	= static_cast<igros_dword_t>(::outCR3());
+		data->stack	= std::bit_cast<igros_quad_t>(smpStacks[id].data() + SMP_STACK_SIZE);
+		data->entry	= std::bit_cast<igros_quad_t>(&smp::entry);
+		data->id	= id;
+
+		// Local APIC ID of processor
+		const auto apicID {smp::mApicIDs[id]};
+
+		// Reset processor
+		apic::sendInit(apicID);
+		arch::pitDelay(SMP_DELAY_INIT);
+
+		// Send STARTUP IPIs
+		for (auto i {0_usize}; (i < SMP_STARTUP_TRIES) && !smp::isOnline(id); i++) {
+			apic::sendStartup(apicID, static_cast<igros_byte_t>(SMP_TRAMPOLINE >> 12));
+			arch::pitDelay(SMP_DELAY_STARTUP);
+		}
+
+		// Wait for processor to come online
+		for (auto i {0_usize}; (i < SMP_STARTUP_TIMEOUT) && !smp::isOnline(id); i++) {
+			arch::pitDelay(SMP_DELAY_POLL);
+		}
+
+		// Check result
+		return smp::isOnline(id);
+
+	}
+
+
+	// Application processor entry
+	[[noreturn]]
+	void smp::entry(const igros_usize_t id) noexcept {
+		// Load kernel GDT
+		gdt::init();
+		// Setup per-CPU data block
+		percpuInit(id, smp::mApicIDs[id]);
+		// Load kernel IDT
+		idt::init();
+		// Enable local APIC
+		apic::init();
+		// Boot context becomes processor idle thread
+		sys::sched::init();
+		// Leftover deferred interrupt work
+		sys::softirqThreadInit();
+		// Lazy FPU state switching
+		sys::fpuInit();
+		// Mark processor online
+		::atomicOr64(&smp::mOnline, 1_u64 << id);
+		// Wait for work
+		smp::idle();
+	}
+
+	// CPU idle loop
+	[[noreturn]]
+	void smp::idle() noexcept {
+		// Sleep till interrupt
+		while (true) {
+			irq::disable();
+			// Softirqs raised outside interrupts (or left over) run before sleep
+			if (sys::softirqPending()) {
+				sys::softirqRun();
+				sys::sched::schedule();
+				continue;
+			}
+			// Idle CPU is in extended quiescent state
+			klib::kRCU::idleEnter();
+			// No tick while asleep
+			sys::tickIdleEnter();
+			cpu::idle();
+			irq::disable();
+			sys::tickIdleExit();
+			klib::kRCU::idleExit();
+			// Run ready threads (also reports RCU quiescent state)
+			sys::sched::schedule();
+		}
+	}
+
+
+	// Get current CPU index
+	[[nodiscard]]
+	auto smp::id() noexcept -> igros_usize_t {
+		// Read from per-CPU data block
+		return percpu<igros_usize_t, offsetof(percpu_t, id)>::read();
+	}
+
+	// Get number of online CPUs
+	[[nodiscard]]
+	auto smp::count() noexcept -> igros_usize_t {
+		// Count set bits
+		auto count	{0_usize};
+		for (auto mask {smp::online()}; 0_u64 != mask; mask &= mask - 1_u64) {
+			count++;
+		}
+		return count;
+	}
+
+	// Get online CPUs mask
+	[[nodiscard]]
+	auto smp::online() noexcept -> igros_quad_t {
+		return ::atomicLoad64(&smp::mOnline);
+	}
+
+	// Check if CPU is online
+	[[nodiscard]]
+	bool smp::isOnline(const igros_usize_t id) noexcept {
+		return 0_u64 != (smp::online() & (1_u64 << id));
+	}
+
+	// Get CPU local APIC ID
+	[[nodiscard]]
+	auto smp::apicID(const igros_usize_t id) noexcept -> igros_dword_t {
+		return smp::mApicIDs[id];
+	}
+
+	// Wake up idle CPU
+	void smp::kick(const igros_usize_t id) noexcept {
+		apic::sendFixed(smp::mApicIDs[id], static_cast<igros_byte_t>(APIC_WAKEUP_VECTOR));
+	}
+
+
+}	// namespace igros::x86_64
+
@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////
+//
+//	Symmetric multiprocessing for x86_64
+//
+//	File:	smp.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <array>
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+// x86_64 namespace
+namespace igros::x86_64 {
+
+
+	// Max number of supported CPUs
+	constexpr auto SMP_MAX_CPUS		{64_usize};
+	// Application processor stack size
+	constexpr auto SMP_STACK_SIZE		{0x2000_usize};
+	// Trampoline physical address (must be page aligned and below 1MB)
+	constexpr auto SMP_TRAMPOLINE		{0x8000_usize};
+
+
+	// SMP structure
+	class smp final {
+
+		// Online CPUs mask
+		static igros_quad_t						mOnline;
+		// Number of known CPUs
+		static igros_usize_t						mCount;
+		// CPU index to local APIC ID map
+		static std::array<igros_dword_t, SMP_MAX_CPUS>			mApicIDs;
+
+		// Start application processor
+		[[nodiscard]]
+		static bool	start(const igros_usize_t id) noexcept;
+
+		// Copy c-tor
+		smp(const smp &other) = delete;
+		// Copy assignment
+		auto	operator=(const smp &other) -> smp& = delete;
+
+		// Move c-tor
+		smp(smp &&other) = delete;
+		// Move assignment
+		auto	operator=(smp &&other) -> smp& = delete;
+
+
+	public:
+
+		// Max number of supported CPUs
+		constexpr static auto MAX_CPUS {SMP_MAX_CPUS};
+
+		// Default c-tor
+		smp() noexcept = default;
+
+		// Init SMP (start all application processors)
+		static void	init() noexcept;
+
+		// Application processor entry
+		[[noreturn]]
+		static void	entry(const igros_usize_t id) noexcept;
+		// CPU idle loop
+		[[noreturn]]
+		static void	idle() noexcept;
+
+		// Get current CPU index
+		[[nodiscard]]
+		static auto	id() noexcept -> igros_usize_t;
+		// Get number of online CPUs
+		[[nodiscard]]
+		static auto	count() noexcept -> igros_usize_t;
+		// Get online CPUs mask
+		[[nodiscard]]
+		static auto	online() noexcept -> igros_quad_t;
+		// Check if CPU is online
+		[[nodiscard]]
+		static bool	isOnline(const igros_usize_t id) noexcept;
+		// Get CPU local APIC ID
+		[[nodiscard]]
+		static auto	apicID(const igros_usize_t id) noexcept -> igros_dword_t;
+
+		// Wake up idle CPU
+		static void	kick(const igros_usize_t id) noexcept;
+
+
+	};
+
+
+}	// namespace igros::x86_64
+
@@ -1,4 +1,9 @@
 #!/bin/sh
 
-qemu-system-x86_64 -cdrom release/os-x86_64.iso -m 2G
+# Attach raw disk image as virtio-blk if present (qemu-img create -f raw disk.img 64M)
+if [ -f disk.img ]; then
+	DISK="-drive file=disk.img,if=virtio,format=raw"
+fi
+
+qemu-system-x86_64 -cdrom release/os-x86_64.iso -m 2G ${DISK}
 
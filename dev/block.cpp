@@ -0,0 +1,473 @@
+////////////////////////////////////////////////////////////////
+//
+//	Block I/O layer
+//
+//	File:	block.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+#include <bit>
+// IgrOS-Kernel arch
+#include <arch/paging.hpp>
+#include <arch/percpu.hpp>
+#include <arch/smp.hpp>
+// IgrOS-Kernel devices
+#include <dev/block.hpp>
+// IgrOS-Kernel library
+#include <klib/kLock.hpp>
+#include <klib/kRCU.hpp>
+#include <klib/kmemory.hpp>
+#include <klib/kprint.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Bios for generic device requests
+	constexpr auto BLOCK_BIO_POOL		{64_usize};
+
+
+	// Hardware queue (one page)
+	struct blockHwQueue_t {
+		klib::kSpinlock<>					lock;		// Queue lock
+		blockRequest_t*						pending;	// Requests in sector order
+		blockRequest_t*						free;		// Free requests
+		blockBio_t*						waiting;	// Bios waiting for free request
+		blockBio_t**						waitingTail;	// Waiting bios tail link
+		igros_quad_t						position;	// End of last started request
+		igros_usize_t						inflight;	// Started requests
+		bool							dispatching;	// Some CPU is starting requests
+		std::array<blockRequest_t, BLOCK_QUEUE_DEPTH>		requests;	// Requests
+	};
+
+	static_assert(sizeof(blockHwQueue_t) <= arch::paging::PAGE_SIZE, "Block hardware queue does not fit page!");
+
+
+	// Generic device requests bios
+	static std::array<blockBio_t, BLOCK_BIO_POOL>	blockBios	{};
+	// Released bios
+	static blockBio_t*				blockBioFree	{nullptr};
+	// Never used bios start
+	static igros_usize_t				blockBioNext	{0_usize};
+	// Bios pool lock
+	static klib::kSpinlock<>			blockBioLock	{};
+
+
+	// Hardware queue of current CPU
+	[[nodiscard]]
+	static auto blockQueueIndex(const blockDevice_t &dev) noexcept -> igros_usize_t {
+		return arch::percpuID::read() % dev.queues;
+	}
+
+
+	// Merge bio into adjacent pending request (queue locked)
+	[[nodiscard]]
+	static auto blockMerge(const blockDevice_t &dev, blockHwQueue_t &hw, blockBio_t &bio) noexcept -> bool {
+		for (auto request {hw.pending}; nullptr != request; request = request->next) {
+			if (
+				(request->op != bio.op)						||
+				((request->count + bio.count) > BLOCK_MERGE_MAX)		||
+				((0_usize != dev.segments) && (request->bios >= dev.segments))
+			) {
+				continue;
+			}
+			// Back merge
+			if ((request->sector + request->count) == bio.sector) {
+				bio.next		= nullptr;
+				request->last->next	= &bio;
+				request->last		= &bio;
+				request->count		+= bio.count;
+				request->bios++;
+				return true;
+			}
+			// Front merge
+			if ((bio.sector + bio.count) == request->sector) {
+				bio.next		= request->first;
+				request->first		= &bio;
+				request->sector		= bio.sector;
+				request->count		+= bio.count;
+				request->bios++;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Queue bio as new or merged request (queue locked, false if no free request)
+	[[nodiscard]]
+	static auto blockQueue(blockDevice_t &dev, blockHwQueue_t &hw, const igros_usize_t index, blockBio_t &bio) noexcept -> bool {
+		if (blockMerge(dev, hw, bio)) {
+			return true;
+		}
+		const auto request {hw.free};
+		if (nullptr == request) {
+			return false;
+		}
+		hw.free			= request->next;
+		bio.next		= nullptr;
+		request->first		= &bio;
+		request->last		= &bio;
+		request->sector		= bio.sector;
+		request->count		= bio.count;
+		request->bios		= 1_u32;
+		request->op		= bio.op;
+		request->device		= &dev;
+		request->queue		= index;
+		request->driver		= nullptr;
+		// Keep sector order
+		auto link {&hw.pending};
+		while ((nullptr != *link) && ((*link)->sector <= request->sector)) {
+			link = &(*link)->next;
+		}
+		request->next	= *link;
+		*link		= request;
+		return true;
+	}
+
+	// Queue bio or park it till request is free (queue locked)
+	static void blockAdd(blockDevice_t &dev, blockHwQueue_t &hw, const igros_usize_t index, blockBio_t &bio) noexcept {
+		if (!blockQueue(dev, hw, index, bio)) {
+			bio.next	= nullptr;
+			*hw.waitingTail	= &bio;
+			hw.waitingTail	= &bio.next;
+		}
+	}
+
+	// Release hardware queues
+	static void blockFreeQueues(blockDevice_t &dev) noexcept {
+		for (auto &hw : dev.hw) {
+			if (nullptr != hw) {
+				arch::paging::get().deallocate(hw);
+				hw = nullptr;
+			}
+		}
+	}
+
+	// Take next pending request in one-way elevator order (queue locked, nullptr if none or queue is full)
+	[[nodiscard]]
+	static auto blockNext(const blockDevice_t &dev, blockHwQueue_t &hw) noexcept -> blockRequest_t* {
+		if ((nullptr == hw.pending) || (hw.inflight >= dev.depth)) {
+			return nullptr;
+		}
+		// Next one after last position, then wrap around
+		auto link {&hw.pending};
+		while ((nullptr != *link) && ((*link)->sector < hw.position)) {
+			link = &(*link)->next;
+		}
+		if (nullptr == *link) {
+			link = &hw.pending;
+		}
+		const auto request	{*link};
+		*link			= request->next;
+		request->next		= nullptr;
+		hw.position		= request->sector + request->count;
+		hw.inflight++;
+		return request;
+	}
+
+	// Start pending requests up to queue depth
+	static void blockDispatch(blockDevice_t &dev, blockHwQueue_t &hw, const igros_usize_t index) noexcept {
+		// Completions (even synchronous ones from driver) leave new work to running dispatch instead of nesting
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {hw.lock};
+			if (hw.dispatching) {
+				return;
+			}
+			hw.dispatching = true;
+		}
+		auto started		{0_usize};
+		blockRequest_t* failed	{nullptr};
+		for (;;) {
+			blockRequest_t* request {nullptr};
+			{
+				const klib::kIRQLockGuard<klib::kSpinlock<>> guard {hw.lock};
+				request = blockNext(dev, hw);
+				// Checked under lock, so work queued by others is not missed
+				if ((nullptr == request) && (nullptr == failed)) {
+					hw.dispatching = false;
+					break;
+				}
+			}
+			// Requests driver failed to start are completed after loop (their callbacks may queue more)
+			if (nullptr == request) {
+				while (nullptr != failed) {
+					const auto next {failed->next};
+					blockComplete(*failed, true);
+					failed = next;
+				}
+				continue;
+			}
+			// Driver may complete it right away
+			if (dev.ops->queue(dev, *request)) [[likely]] {
+				started++;
+			} else {
+				request->next	= failed;
+				failed		= request;
+			}
+		}
+		// One hardware notification per batch
+		if ((0_usize != started) && (nullptr != dev.ops->commit)) {
+			dev.ops->commit(dev, index);
+		}
+	}
+
+
+	// Submit bio (batched if plug is given, completion is always called)
+	void blockSubmit(blockDevice_t &dev, blockBio_t &bio, blockPlug_t* const plug) noexcept {
+		// Out of device range
+		if ((0_u32 == bio.count) || (bio.sector >= dev.sectors) || (bio.count > (dev.sectors - bio.sector))) [[unlikely]] {
+			bio.failed = true;
+			bio.complete(bio);
+			return;
+		}
+		bio.failed = false;
+		// Batch (sorted on unplug)
+		if (nullptr != plug) {
+			if (&dev != plug->device) {
+				blockUnplug(*plug);
+				plug->device = &dev;
+			}
+			bio.next	= plug->bios;
+			plug->bios	= &bio;
+			if (++plug->count >= BLOCK_PLUG_MAX) {
+				blockUnplug(*plug);
+			}
+			return;
+		}
+		const auto index	{blockQueueIndex(dev)};
+		auto &hw		{*dev.hw[index]};
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {hw.lock};
+			blockAdd(dev, hw, index, bio);
+		}
+		blockDispatch(dev, hw, index);
+	}
+
+	// Queue plugged bios
+	void blockUnplug(blockPlug_t &plug) noexcept {
+		const auto dev	{plug.device};
+		auto bios	{plug.bios};
+		plug.bios	= nullptr;
+		plug.count	= 0_usize;
+		if ((nullptr == dev) || (nullptr == bios)) {
+			return;
+		}
+		// Sector order makes adjacent bios merge (plug is short)
+		blockBio_t* sorted {nullptr};
+		while (nullptr != bios) {
+			const auto bio {bios};
+			bios = bios->next;
+			auto link {&sorted};
+			while ((nullptr != *link) && ((*link)->sector <= bio->sector)) {
+				link = &(*link)->next;
+			}
+			bio->next	= *link;
+			*link		= bio;
+		}
+		// Whole batch under one lock
+		const auto index	{blockQueueIndex(*dev)};
+		auto &hw		{*dev->hw[index]};
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {hw.lock};
+			while (nullptr != sorted) {
+				const auto next {sorted->next};
+				blockAdd(*dev, hw, index, *sorted);
+				sorted = next;
+			}
+		}
+		blockDispatch(*dev, hw, index);
+	}
+
+	// Complete request (driver side, interrupt context allowed)
+	void blockComplete(blockRequest_t &request, const bool failed) noexcept {
+		// Request is reused as soon as it is released
+		auto &dev		{*request.device};
+		const auto index	{request.queue};
+		auto &hw		{*dev.hw[index]};
+		auto bio		{request.first};
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {hw.lock};
+			request.next	= hw.free;
+			hw.free		= &request;
+			hw.inflight--;
+			// Parked bios take released request
+			while (nullptr != hw.waiting) {
+				const auto next {hw.waiting->next};
+				if (!blockQueue(dev, hw, index, *hw.waiting)) {
+					break;
+				}
+				hw.waiting = next;
+			}
+			if (nullptr == hw.waiting) {
+				hw.waitingTail = &hw.waiting;
+			}
+		}
+		// Callbacks may submit again
+		while (nullptr != bio) {
+			const auto next {bio->next};
+			bio->failed = failed;
+			bio->complete(*bio);
+			bio = next;
+		}
+		blockDispatch(dev, hw, index);
+	}
+
+
+	// Take bio from pool (nullptr if none)
+	[[nodiscard]]
+	static auto blockBioAlloc() noexcept -> blockBio_t* {
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {blockBioLock};
+		auto bio {blockBioFree};
+		if (nullptr != bio) {
+			blockBioFree = bio->next;
+		} else if (blockBioNext < BLOCK_BIO_POOL) {
+			bio = &blockBios[blockBioNext++];
+		}
+		return bio;
+	}
+
+	// Return bio to pool
+	static void blockBioRelease(blockBio_t &bio) noexcept {
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {blockBioLock};
+		bio.next	= blockBioFree;
+		blockBioFree	= &bio;
+	}
+
+
+	// Generic device open (handle is block device)
+	[[nodiscard]]
+	static auto blockDeviceOpen(const char* name, const igros_dword_t flags) -> igros_pointer_t;
+
+	// Generic device close
+	static void blockDeviceClose([[maybe_unused]] igros_pointer_t handle) {}
+
+	// Generic device request done
+	static void blockDeviceEnd(blockBio_t &bio) noexcept {
+		const auto request	{static_cast<deviceRequest_t*>(bio.arg)};
+		request->failed		= bio.failed;
+		request->done		= bio.failed ? 0_usize : (static_cast<igros_usize_t>(bio.count) << BLOCK_SECTOR_SHIFT);
+		blockBioRelease(bio);
+		deviceComplete(*request);
+	}
+
+	// Generic device request (whole sectors only)
+	[[nodiscard]]
+	static auto blockDeviceSubmit(const igros_pointer_t handle, deviceRequest_t &request) -> bool {
+		const auto dev {static_cast<blockDevice_t*>(handle)};
+		if (
+			(nullptr == dev)						||
+			(0_usize == request.size)					||
+			(0_u64 != (request.offset & (BLOCK_SECTOR_SIZE - 1_usize)))	||
+			(0_usize != (request.size & (BLOCK_SECTOR_SIZE - 1_usize)))
+		) [[unlikely]] {
+			return false;
+		}
+		const auto bio {blockBioAlloc()};
+		if (nullptr == bio) [[unlikely]] {
+			return false;
+		}
+		bio->sector	= request.offset >> BLOCK_SECTOR_SHIFT;
+		bio->count	= static_cast<igros_dword_t>(request.size >> BLOCK_SECTOR_SHIFT);
+		bio->op		= request.op;
+		bio->buffer	= request.buffer;
+		bio->complete	= blockDeviceEnd;
+		bio->arg	= &request;
+		blockSubmit(*dev, *bio);
+		return true;
+	}
+
+	// Generic device operations of block devices
+	static constexpr deviceOps_t	blockDeviceOps	{nullptr, nullptr, blockDeviceOpen, blockDeviceClose, nullptr, nullptr, nullptr, blockDeviceSubmit};
+
+
+	// Generic device open (handle is block device, valid till it is unregistered)
+	[[nodiscard]]
+	static auto blockDeviceOpen(const char* name, [[maybe_unused]] const igros_dword_t flags) -> igros_pointer_t {
+		// Generic device may be unregistered and freed once guard is dropped
+		const klib::kRCUReadGuard guard {};
+		const auto dev {deviceFind(name)};
+		return ((nullptr != dev) && (&blockDeviceOps == dev->ops)) ? dev->data : nullptr;
+	}
+
+
+	// Register block device (allocates queues, registers generic device)
+	[[nodiscard]]
+	auto blockRegister(blockDevice_t &dev) noexcept -> bool {
+		if ((nullptr == dev.ops) || (nullptr == dev.ops->queue) || (0_u64 == dev.sectors)) [[unlikely]] {
+			return false;
+		}
+		// Hardware queues sized to CPUs count
+		auto cpus {0_usize};
+		for (auto cpu {0_usize}; cpu < arch::smp::MAX_CPUS; cpu++) {
+			if (arch::smp::get().isOnline(cpu)) {
+				cpus++;
+			}
+		}
+		cpus		= (0_usize != cpus) ? cpus : 1_usize;
+		dev.queues	= (0_usize == dev.queues) ? 1_usize : ((dev.queues > cpus) ? cpus : dev.queues);
+		dev.depth	= (0_usize == dev.depth) ? 1_usize : ((dev.depth > BLOCK_QUEUE_DEPTH) ? BLOCK_QUEUE_DEPTH : dev.depth);
+		dev.hw.fill(nullptr);
+		for (auto i {0_usize}; i < dev.queues; i++) {
+			const auto page {arch::paging::get().allocate()};
+			if (nullptr == page) [[unlikely]] {
+				klib::kprintf("BLOCK:\t\tOut of memory for \"%s\" queues\n", dev.device.name);
+				blockFreeQueues(dev);
+				return false;
+			}
+			klib::kmemset(page, arch::paging::PAGE_SIZE, 0_u8);
+			auto &hw	{*std::bit_cast<blockHwQueue_t*>(page)};
+			hw.waitingTail	= &hw.waiting;
+			for (auto &request : hw.requests) {
+				request.next	= hw.free;
+				hw.free		= &request;
+			}
+			dev.hw[i] = &hw;
+		}
+		// Reachable as generic device too
+		dev.device.ops	= &blockDeviceOps;
+		dev.device.data	= &dev;
+		if (!registerDevice(dev.device)) [[unlikely]] {
+			blockFreeQueues(dev);
+			return false;
+		}
+		klib::kprintf(
+			"BLOCK:\t\t%s: %llu sectors, %z queue(s) x %z\n",
+			dev.device.name,
+			dev.sectors,
+			dev.queues,
+			dev.depth
+		);
+		return true;
+	}
+
+
+	// Unregister idle block device (false if any request is not done yet)
+	[[nodiscard]]
+	auto blockUnregister(blockDevice_t &dev) noexcept -> bool {
+		// Queues are freed below, so nothing may be queued or in flight
+		for (auto i {0_usize}; i < dev.queues; i++) {
+			auto &hw {*dev.hw[i]};
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {hw.lock};
+			if ((0_usize != hw.inflight) || (nullptr != hw.pending) || (nullptr != hw.waiting) || hw.dispatching) {
+				klib::kprintf("BLOCK:\t\t%s: can't unregister busy device\n", dev.device.name);
+				return false;
+			}
+		}
+		if (!unregisterDevice(dev.device)) [[unlikely]] {
+			return false;
+		}
+		blockFreeQueues(dev);
+		return true;
+	}
+
+
+}	// namespace igros::sys
+
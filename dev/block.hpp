@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////
+//
+//	Block I/O layer
+//
+//	File:	block.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <array>
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/smp.hpp>
+#include <arch/types.hpp>
+// IgrOS-Kernel devices
+#include <dev/device.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Block layer
+	//
+	// Callers describe I/O with bios (sector range + buffer). Bios go to
+	// hardware queue of submitting CPU, where adjacent ones of same direction
+	// are merged into requests kept in sector order, and driver gets them in
+	// one-way elevator order up to its queue depth, then one commit call lets
+	// it notify hardware once for whole batch. Bios collected with plug
+	// are sorted and queued at once on unplug, so whole batch merges before
+	// driver sees any of it. Drivers complete requests from interrupt handler,
+	// which also starts next ones. Only one CPU starts requests of hardware
+	// queue at a time, completions done meanwhile (even from driver queue
+	// call) leave new work to it, so stack does not grow with queue depth.
+	// Every block device is registered as generic device too, so it can be
+	// used through deviceSubmit/deviceTransfer
+
+
+	// Sector size
+	constexpr auto BLOCK_SECTOR_SHIFT	{9_u32};
+	constexpr auto BLOCK_SECTOR_SIZE	{1_usize << BLOCK_SECTOR_SHIFT};
+	// Max requests per hardware queue (pending and in flight)
+	constexpr auto BLOCK_QUEUE_DEPTH	{32_usize};
+	// Max merged request size (sectors)
+	constexpr auto BLOCK_MERGE_MAX		{256_u32};
+	// Plugged bios count that forces unplug
+	constexpr auto BLOCK_PLUG_MAX		{16_usize};
+
+
+	struct blockBio_t;
+	struct blockDevice_t;
+	struct blockHwQueue_t;
+	struct blockRequest_t;
+
+
+	// Bio completion callback (bio may be reused or freed right away)
+	using blockEnd_t	= std::add_pointer_t<void (blockBio_t&)>;
+	// Start request on hardware (false if it failed to start)
+	using blockQueueRq_t	= std::add_pointer_t<auto (blockDevice_t&, blockRequest_t&) -> bool>;
+	// Notify hardware queue about requests started since last call
+	using blockCommit_t	= std::add_pointer_t<void (blockDevice_t&, const igros_usize_t)>;
+
+
+	// Block I/O unit (owned by caller till completion)
+	struct blockBio_t {
+		blockBio_t*		next;			// Plug or request link
+		igros_quad_t		sector;			// First sector
+		igros_dword_t		count;			// Sectors count
+		deviceOp_t		op;			// Direction
+		igros_pointer_t		buffer;			// Data buffer (count sectors)
+		bool			failed;			// Error (set on completion)
+		blockEnd_t		complete;		// Completion callback
+		igros_pointer_t		arg;			// Completion callback argument
+	};
+
+	// Merged adjacent bios handed to driver
+	struct blockRequest_t {
+		blockRequest_t*		next;			// Queue link
+		blockBio_t*		first;			// Bios in sector order (linked by next)
+		blockBio_t*		last;			// Last bio
+		igros_quad_t		sector;			// First sector
+		igros_dword_t		count;			// Sectors count
+		igros_dword_t		bios;			// Bios count
+		deviceOp_t		op;			// Direction
+		blockDevice_t*		device;			// Owner device
+		igros_usize_t		queue;			// Hardware queue index
+		igros_pointer_t		driver;			// Driver private data
+	};
+
+	// Block driver operations
+	struct blockOps_t {
+		blockQueueRq_t		queue;			// Start request (completed with blockComplete)
+		blockCommit_t		commit;			// Kick hardware after batch (may be nullptr)
+	};
+
+	// Block device (filled by driver before registration)
+	struct blockDevice_t {
+		device_t						device;		// Generic device (name is set by driver)
+		const blockOps_t*					ops;		// Driver operations
+		igros_pointer_t						data;		// Driver private data
+		igros_quad_t						sectors;	// Capacity
+		igros_usize_t						queues;		// Hardware queues (clamped to online CPUs)
+		igros_usize_t						depth;		// Requests in flight per queue (clamped)
+		igros_usize_t						segments;	// Max bios per request (0 - no limit)
+		std::array<blockHwQueue_t*, arch::smp::MAX_CPUS>	hw;		// Hardware queues
+	};
+
+	// Bios batch (caller owned, one device at a time)
+	struct blockPlug_t {
+		blockDevice_t*		device;			// Batch device
+		blockBio_t*		bios;			// Plugged bios
+		igros_usize_t		count;			// Plugged bios count
+	};
+
+
+	// Register block device (allocates queues, registers generic device)
+	[[nodiscard]]
+	auto	blockRegister(blockDevice_t &dev) noexcept -> bool;
+	// Unregister idle block device (false if any request is not done yet)
+	[[nodiscard]]
+	auto	blockUnregister(blockDevice_t &dev) noexcept -> bool;
+
+	// Submit bio (batched if plug is given, completion is always called)
+	void	blockSubmit(blockDevice_t &dev, blockBio_t &bio, blockPlug_t* const plug = nullptr) noexcept;
+	// Queue plugged bios
+	void	blockUnplug(blockPlug_t &plug) noexcept;
+	// Complete request (driver side, interrupt context allowed)
+	void	blockComplete(blockRequest_t &request, const bool failed) noexcept;
+
+
+}	// namespace igros::sys
+
@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////////
+//
+//	Device registry
+//
+//	File:	device.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+// IgrOS-Kernel devices
+#include <dev/device.hpp>
+// IgrOS-Kernel library
+#include <klib/kAtomic.hpp>
+#include <klib/kLock.hpp>
+#include <klib/kRCU.hpp>
+#include <klib/kstring.hpp>
+// IgrOS-Kernel system
+#include <sys/sched.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Name hash buckets (power of two)
+	constexpr auto DEVICE_HASH_SIZE		{64_usize};
+
+	static_assert(0_usize == (DEVICE_HASH_SIZE & (DEVICE_HASH_SIZE - 1_usize)), "Bad device hash size!");
+
+
+	// Synchronous transfer waiter
+	struct deviceWaiter_t {
+		thread_t*		thread;			// Sleeping thread
+		igros_dword_t		done;			// Request completed
+	};
+
+
+	// Devices by ID (RCU protected)
+	static std::array<device_t*, DEVICE_MAX>		deviceTable	{};
+	// Devices by name hash (RCU protected chains)
+	static std::array<device_t*, DEVICE_HASH_SIZE>		deviceHash	{};
+	// Released IDs (reused first, keeps IDs dense)
+	static std::array<igros_usize_t, DEVICE_MAX>		deviceFreeIDs	{};
+	// Released IDs count
+	static igros_usize_t					deviceFreeCount	{0_usize};
+	// Never used IDs start
+	static igros_usize_t					deviceNextID	{0_usize};
+	// Writers lock
+	static klib::kSpinlock<>				deviceLock	{};
+
+
+	// Name hash bucket (FNV-1a)
+	[[nodiscard]]
+	static auto deviceBucket(const char* const name) noexcept -> igros_usize_t {
+		auto hash {2166136261_u32};
+		for (auto i {0_usize}; (i < DEVICE_NAME_MAX) && ('\0' != name[i]); i++) {
+			hash = (hash ^ static_cast<igros_byte_t>(name[i])) * 16777619_u32;
+		}
+		return hash & (DEVICE_HASH_SIZE - 1_usize);
+	}
+
+	// Compare device names
+	[[nodiscard]]
+	static auto deviceNameEqual(const char* const name1, const char* const name2) noexcept -> bool {
+		return 0_i32 == klib::kstrcmp(name1, name2, DEVICE_NAME_MAX);
+	}
+
+
+	// Register device (false if name is taken or registry is full)
+	[[nodiscard]]
+	auto registerDevice(device_t &dev) noexcept -> bool {
+		if ((nullptr == dev.name) || (nullptr == dev.ops)) [[unlikely]] {
+			return false;
+		}
+		const auto bucket {deviceBucket(dev.name)};
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {deviceLock};
+		// Names are unique
+		for (auto other {deviceHash[bucket]}; nullptr != other; other = other->hashNext) {
+			if (deviceNameEqual(other->name, dev.name)) {
+				return false;
+			}
+		}
+		// Take lowest released or next new ID
+		if (deviceFreeCount > 0_usize) {
+			dev.id = deviceFreeIDs[--deviceFreeCount];
+		} else if (deviceNextID < DEVICE_MAX) {
+			dev.id = deviceNextID++;
+		} else {
+			return false;
+		}
+		// Publish fully initialized device
+		dev.hashNext = deviceHash[bucket];
+		klib::kRCU::assign(deviceHash[bucket], &dev);
+		klib::kRCU::assign(deviceTable[dev.id], &dev);
+		return true;
+	}
+
+	// Unregister device (waits till lookups in progress are done)
+	[[nodiscard]]
+	auto unregisterDevice(device_t &dev) noexcept -> bool {
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {deviceLock};
+			if ((dev.id >= DEVICE_MAX) || (&dev != deviceTable[dev.id])) [[unlikely]] {
+				return false;
+			}
+			// Readers standing on device still see rest of chain
+			for (auto link {&deviceHash[deviceBucket(dev.name)]}; nullptr != *link; link = &(*link)->hashNext) {
+				if (&dev == *link) {
+					klib::kRCU::assign(*link, dev.hashNext);
+					break;
+				}
+			}
+			klib::kRCU::assign<device_t>(deviceTable[dev.id], nullptr);
+			deviceFreeIDs[deviceFreeCount++]	= dev.id;
+			dev.id					= DEVICE_ID_NONE;
+		}
+		// Nobody sees device after grace period
+		klib::kRCU::synchronize();
+		return true;
+	}
+
+
+	// Find device by name (nullptr if none, caller holds kRCUReadGuard while using it)
+	[[nodiscard]]
+	auto deviceFind(const char* const name) noexcept -> device_t* {
+		if (nullptr == name) [[unlikely]] {
+			return nullptr;
+		}
+		for (auto dev {klib::kRCU::dereference(deviceHash[deviceBucket(name)])}; nullptr != dev; dev = klib::kRCU::dereference(dev->hashNext)) {
+			if (deviceNameEqual(dev->name, name)) {
+				return dev;
+			}
+		}
+		return nullptr;
+	}
+
+	// Get device by ID (nullptr if none, caller holds kRCUReadGuard while using it)
+	[[nodiscard]]
+	auto deviceGet(const igros_usize_t id) noexcept -> device_t* {
+		return (id < DEVICE_MAX) ? klib::kRCU::dereference(deviceTable[id]) : nullptr;
+	}
+
+
+	// Submit asynchronous request (false if rejected, callback is not called then)
+	[[nodiscard]]
+	auto deviceSubmit(const device_t &dev, deviceRequest_t &request) noexcept -> bool {
+		request.done	= 0_usize;
+		request.failed	= false;
+		// Driver queues it and completes later
+		if (nullptr != dev.ops->submit) {
+			return dev.ops->submit(request.handle, request);
+		}
+		// Synchronous driver - done right here
+		if (deviceOp_t::READ == request.op) {
+			if (nullptr == dev.ops->read) [[unlikely]] {
+				return false;
+			}
+			request.done = dev.ops->read(request.handle, request.buffer, request.size);
+		} else {
+			if (nullptr == dev.ops->write) [[unlikely]] {
+				return false;
+			}
+			request.done = dev.ops->write(request.handle, request.buffer, request.size);
+		}
+		deviceComplete(request);
+		return true;
+	}
+
+	// Complete request (driver side, interrupt context allowed)
+	void deviceComplete(deviceRequest_t &request) noexcept {
+		// Request may be gone once callback returns
+		if (nullptr != request.complete) {
+			request.complete(request);
+		}
+	}
+
+
+	// Wake up synchronous transfer waiter
+	static void deviceWake(deviceRequest_t &request) noexcept {
+		const auto waiter	{static_cast<deviceWaiter_t*>(request.arg)};
+		const auto thread	{waiter->thread};
+		// Waiter may return (and drop its stack) right after flag is set
+		klib::kAtomicRef<igros_dword_t>(waiter->done).store(1_u32, klib::kMemoryOrder::RELEASE);
+		sched::wake(thread);
+	}
+
+	// Submit request and sleep till it completes (thread context)
+	[[nodiscard]]
+	auto deviceTransfer(const device_t &dev, deviceRequest_t &request) noexcept -> bool {
+		deviceWaiter_t waiter {sched::current(), 0_u32};
+		request.complete	= deviceWake;
+		request.arg		= &waiter;
+		if (!deviceSubmit(dev, request)) [[unlikely]] {
+			return false;
+		}
+		// Wake up is never lost
+		while (0_u32 == klib::kAtomicRef<igros_dword_t>(waiter.done).load(klib::kMemoryOrder::ACQUIRE)) {
+			sched::block();
+		}
+		return !request.failed;
+	}
+
+
+}	// namespace igros::sys
+
@@ -25,6 +25,30 @@
 namespace igros::sys {
 
 
+	// Device registry
+	//
+	// Registered devices get dense integer ID (reused after unregistration)
+	// and are indexed by name hash, so both lookups are O(1). Lookups are
+	// lock-free RCU readers, unregistration waits for grace period, so device
+	// may be freed right after it. Found device pointer is valid only while
+	// caller stays in read-side section (kRCUReadGuard) it was looked up in.
+	// Requests are submitted asynchronously and completed from driver
+	// (possibly from interrupt handler), so drivers can keep several
+	// requests in flight. Devices without submit operation are served
+	// synchronously with read/write
+
+
+	// Max devices
+	constexpr auto DEVICE_MAX		{256_usize};
+	// Max device name length (including terminating zero)
+	constexpr auto DEVICE_NAME_MAX		{64_usize};
+	// No device ID
+	constexpr auto DEVICE_ID_NONE		{~0_usize};
+
+
+	struct deviceRequest_t;
+
+
 	// Device init function pointer
 	using devFuncInit_t	= std::add_pointer_t<auto () -> igros_pointer_t>;
 	// Device deinit function pointer
@@ -41,13 +65,16 @@ namespace igros::sys {
 	using devFuncRead_t	= std::add_pointer_t<auto (const igros_pointer_t, void* const, const igros_usize_t) -> igros_usize_t>;
 
 	// Device IOCTL function pointer
-	using devFuncIOCTL_t	= std::add_pointer_t<auto (const igros_pointer_t, const igros_dword_t, ...) -> igros_usize_t>
+	using devFuncIOCTL_t	= std::add_pointer_t<auto (const igros_pointer_t, const igros_dword_t, ...) -> igros_usize_t>;
 
+	// Device asynchronous request submit function pointer (false if rejected)
+	using devFuncSubmit_t	= std::add_pointer_t<auto (const igros_pointer_t, deviceRequest_t&) -> bool>;
+	// Request completion callback (request may be reused or freed right away)
+	using devFuncComplete_t	= std::add_pointer_t<void (deviceRequest_t&)>;
 
-	// Device description structure
-	struct device_t {
 
-		const char		name[64_usize];		// Get device name
+	// Device operations table (shared by devices of one driver)
+	struct deviceOps_t {
 
 		devFuncInit_t		init;			// Init device
 		devFuncDeinit_t		deinit;			// Deinit device
@@ -60,15 +87,64 @@ namespace igros::sys {
 
 		devFuncIOCTL_t		ioctl;			// Device IOCTL
 
+		devFuncSubmit_t		submit;			// Queue asynchronous request (may be nullptr)
+
+	};
+
+
+	// Device description structure
+	struct device_t {
+		const char*		name;			// Device name (outlives registration)
+		const deviceOps_t*	ops;			// Device operations
+		igros_pointer_t		data;			// Driver private data
+		device_t*		hashNext;		// Next device in name hash chain
+		igros_usize_t		id;			// Dense device ID (set on registration)
+	};
+
+
+	// Request operation
+	enum class deviceOp_t : igros_dword_t {
+		READ,						// Read to buffer
+		WRITE						// Write from buffer
+	};
+
+	// Asynchronous I/O request (owned by caller till completion)
+	struct deviceRequest_t {
+		deviceRequest_t*	next;			// Driver queue link
+		igros_pointer_t		handle;			// Open device handle
+		deviceOp_t		op;			// Operation
+		igros_quad_t		offset;			// Device offset (block devices)
+		igros_pointer_t		buffer;			// Data buffer
+		igros_usize_t		size;			// Bytes requested
+		igros_usize_t		done;			// Bytes transferred (set by driver)
+		bool			failed;			// Error (set by driver)
+		devFuncComplete_t	complete;		// Completion callback
+		igros_pointer_t		arg;			// Completion callback argument
 	};
 
 
-	// Register device
-	[[nodicard]]
-	auto	registerDevice(const device_t &dev) noexcept -> bool;
-	// Unregister device
-	[[nodicard]]
-	auto	unregisterDevice(const device_t &dev) noexcept -> bool;
+	// Register device (false if name is taken or registry is full)
+	[[nodiscard]]
+	auto	registerDevice(device_t &dev) noexcept -> bool;
+	// Unregister device (waits till lookups in progress are done)
+	[[nodiscard]]
+	auto	unregisterDevice(device_t &dev) noexcept -> bool;
+
+	// Find device by name (nullptr if none, caller holds kRCUReadGuard while using it)
+	[[nodiscard]]
+	auto	deviceFind(const char* const name) noexcept -> device_t*;
+	// Get device by ID (nullptr if none, caller holds kRCUReadGuard while using it)
+	[[nodiscard]]
+	auto	deviceGet(const igros_usize_t id) noexcept -> device_t*;
+
+	// Submit asynchronous request (false if rejected, callback is not called then)
+	[[nodiscard]]
+	auto	deviceSubmit(const device_t &dev, deviceRequest_t &request) noexcept -> bool;
+	// Complete request (driver side, interrupt context allowed)
+	void	deviceComplete(deviceRequest_t &request) noexcept;
+	// Submit request and sleep till it completes (thread context)
+	[[nodiscard]]
+	auto	deviceTransfer(const device_t &dev, deviceRequest_t &request) noexcept -> bool;
 
 
 }	// namespace igros::sys
@@ -0,0 +1,319 @@
+////////////////////////////////////////////////////////////////
+//
+//	ACPI tables parser
+//
+//	File:	acpi.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// IgrOS-Kernel arch
+#include <arch/io.hpp>
+// IgrOS-Kernel drivers
+#include <drivers/acpi/acpi.hpp>
+// IgrOS-Kernel library
+#include <klib/kprint.hpp>
+#include <klib/kstring.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// EBDA segment pointer address
+	constexpr auto ACPI_EBDA_POINTER	{0x040E_usize};
+	// EBDA search size
+	constexpr auto ACPI_EBDA_SIZE		{0x0400_usize};
+	// BIOS read-only area start
+	constexpr auto ACPI_BIOS_START		{0x000E0000_usize};
+	// BIOS read-only area end
+	constexpr auto ACPI_BIOS_END		{0x00100000_usize};
+	// RSDP alignment
+	constexpr auto ACPI_RSDP_ALIGN		{0x10_usize};
+	// ACPI 1.0 RSDP size
+	constexpr auto ACPI_RSDP_V1_SIZE	{20_usize};
+
+#if	defined (IGROS_ARCH_i386)
+	// Identity mapped memory limit (kernel lives above)
+	constexpr auto ACPI_MAPPED_LIMIT	{0xC0000000_u64};
+#elif	defined (IGROS_ARCH_x86_64)
+	// Identity mapped memory limit
+	constexpr auto ACPI_MAPPED_LIMIT	{0x100000000_u64};
+#else
+	static_assert(false, u8"Unknown architecture!!!");
+#endif
+
+
+	// Cached RSDP
+	const acpiRSDP_t*	acpi::mRSDP	{nullptr};
+	// RSDP search done flag
+	bool			acpi::mSearched	{false};
+	// Cached tables
+	std::array<const acpiHeader_t*, static_cast<igros_usize_t>(acpi::table_t::COUNT)>	acpi::mTables	{};
+	// Cached tables lookup done flags
+	std::array<bool, static_cast<igros_usize_t>(acpi::table_t::COUNT)>			acpi::mResolved	{};
+
+
+	// Init ACPI (use RSDP provided by bootloader if any)
+	void acpi::init(const igros_pointer_t rsdp) noexcept {
+		// Check provided RSDP
+		if (nullptr == rsdp) {
+			return;
+		}
+		// Validate provided RSDP
+		const auto tempRSDP {static_cast<const acpiRSDP_t*>(rsdp)};
+		if (
+			(0_i32 == klib::kstrcmp(tempRSDP->signature, "RSD PTR ", sizeof(tempRSDP->signature)))	&&
+			acpi::checksum(rsdp, ACPI_RSDP_V1_SIZE)
+		) [[likely]] {
+			// Cache RSDP
+			acpi::mRSDP	= tempRSDP;
+			acpi::mSearched	= true;
+		}
+	}
+
+
+	// Validate table checksum
+	[[nodiscard]]
+	bool acpi::checksum(const igros_pointer_t data, const igros_usize_t size) noexcept {
+		// Bytes pointer
+		const auto bytes	{static_cast<const igros_byte_t*>(data)};
+		// Sum of all bytes must be zero
+		auto sum		{0_u8};
+		for (auto i {0_usize}; i < size; i++) {
+			sum += bytes[i];
+		}
+		return 0_u8 == sum;
+	}
+
+	// Convert physical address to accessible pointer
+	[[nodiscard]]
+	auto acpi::map(const igros_quad_t phys) noexcept -> const igros_byte_t* {
+		// Only identity mapped memory is accessible
+		if ((0_u64 == phys) || (phys >= ACPI_MAPPED_LIMIT)) [[unlikely]] {
+			return nullptr;
+		}
+		// Identity mapped
+		return std::bit_cast<const igros_byte_t*>(static_cast<igros_usize_t>(phys));
+	}
+
+
+	// Search RSDP in memory range
+	[[nodiscard]]
+	auto acpi::search(const igros_usize_t start, const igros_usize_t end) noexcept -> const acpiRSDP_t* {
+		// RSDP is always 16-byte aligned
+		for (auto addr {start}; (addr + sizeof(acpiRSDP_t)) <= end; addr += ACPI_RSDP_ALIGN) {
+			// Get RSDP candidate
+			const auto rsdp {std::bit_cast<const acpiRSDP_t*>(addr)};
+			// Check signature
+			if (0_i32 != klib::kstrcmp(rsdp->signature, "RSD PTR ", sizeof(rsdp->signature))) [[likely]] {
+				continue;
+			}
+			// Check ACPI 1.0 checksum
+			if (!acpi::checksum(std::bit_cast<igros_pointer_t>(addr), ACPI_RSDP_V1_SIZE)) {
+				continue;
+			}
+			// Check ACPI 2.0+ extended checksum
+			if (
+				(rsdp->revision >= 2_u8)	&&
+				!acpi::checksum(std::bit_cast<igros_pointer_t>(addr), rsdp->length)
+			) {
+				continue;
+			}
+			// RSDP found
+			return rsdp;
+		}
+		// Not found
+		return nullptr;
+	}
+
+	// Get RSDP
+	[[nodiscard]]
+	auto acpi::rsdp() noexcept -> const acpiRSDP_t* {
+		// Search only once
+		if (!acpi::mSearched) [[unlikely]] {
+			// Mark search done
+			acpi::mSearched	= true;
+			// Get EBDA address from BIOS data area
+			const auto ebda	{static_cast<igros_usize_t>(io::get().readMemory16(std::bit_cast<const igros_word_t*>(ACPI_EBDA_POINTER))) << 4};
+			// Search first 1KB of EBDA
+			if ((0_usize != ebda) && (ebda < ACPI_BIOS_END)) {
+				acpi::mRSDP = acpi::search(ebda, ebda + ACPI_EBDA_SIZE);
+			}
+			// Search BIOS read-only area
+			if (nullptr == acpi::mRSDP) {
+				acpi::mRSDP = acpi::search(ACPI_BIOS_START, ACPI_BIOS_END);
+			}
+		}
+		// Return cached RSDP
+		return acpi::mRSDP;
+	}
+
+
+	// Find table by signature
+	[[nodiscard]]
+	auto acpi::find(const char* signature, const igros_usize_t index) noexcept -> const acpiHeader_t* {
+
+		// Get RSDP
+		const auto rsdp		{acpi::rsdp()};
+		if (nullptr == rsdp) [[unlikely]] {
+			return nullptr;
+		}
+
+		// Prefer XSDT (64-bit pointers) over RSDT (32-bit pointers)
+		const auto useXSDT	{(rsdp->revision >= 2_u8) && (nullptr != acpi::map(rsdp->xsdtAddress))};
+		// Get root table
+		const auto root		{std::bit_cast<const acpiHeader_t*>(acpi::map(useXSDT ? rsdp->xsdtAddress : rsdp->rsdtAddress))};
+		// Short length would pass checksum and underflow entries count
+		if (
+			(nullptr == root)				||
+			(root->length < sizeof(acpiHeader_t))		||
+			!acpi::checksum(std::bit_cast<igros_pointer_t>(root), root->length)
+		) [[unlikely]] {
+			return nullptr;
+		}
+
+		// Root table entries
+		const auto entries	{std::bit_cast<const igros_byte_t*>(root) + sizeof(acpiHeader_t)};
+		const auto entrySize	{useXSDT ? sizeof(igros_quad_t) : sizeof(igros_dword_t)};
+		const auto count	{(root->length - sizeof(acpiHeader_t)) / entrySize};
+
+		// Walk through root table entries
+		auto found		{0_usize};
+		for (auto i {0_usize}; i < count; i++) {
+			// Read table physical address (entries are not naturally aligned in XSDT)
+			auto phys	{0_u64};
+			for (auto j {0_usize}; j < entrySize; j++) {
+				phys |= static_cast<igros_quad_t>(entries[i * entrySize + j]) << (j << 3);
+			}
+			// Get table header
+			const auto table {std::bit_cast<const acpiHeader_t*>(acpi::map(phys))};
+			if (nullptr == table) [[unlikely]] {
+				continue;
+			}
+			// Check signature
+			if (0_i32 != klib::kstrcmp(table->signature, signature, sizeof(table->signature))) {
+				continue;
+			}
+			// Check table length and checksum
+			if ((table->length < sizeof(acpiHeader_t)) || !acpi::checksum(std::bit_cast<igros_pointer_t>(table), table->length)) [[unlikely]] {
+				continue;
+			}
+			// Check table index
+			if (found++ == index) {
+				return table;
+			}
+		}
+
+		// Not found
+		return nullptr;
+
+	}
+
+	// Get cached table
+	[[nodiscard]]
+	auto acpi::cached(const table_t table, const char* signature) noexcept -> const acpiHeader_t* {
+		// Table index
+		const auto id {static_cast<igros_usize_t>(table)};
+		// Lookup only once
+		if (!acpi::mResolved[id]) [[unlikely]] {
+			acpi::mTables[id]	= acpi::find(signature);
+			acpi::mResolved[id]	= true;
+		}
+		// Return cached table
+		return acpi::mTables[id];
+	}
+
+
+	// Get MADT
+	[[nodiscard]]
+	auto acpi::madt() noexcept -> const acpiMADT_t* {
+		return std::bit_cast<const acpiMADT_t*>(acpi::cached(table_t::MADT, "APIC"));
+	}
+
+	// Get HPET
+	[[nodiscard]]
+	auto acpi::hpet() noexcept -> const acpiHPET_t* {
+		return std::bit_cast<const acpiHPET_t*>(acpi::cached(table_t::HPET, "HPET"));
+	}
+
+	// Get FADT
+	[[nodiscard]]
+	auto acpi::fadt() noexcept -> const acpiFADT_t* {
+		return std::bit_cast<const acpiFADT_t*>(acpi::cached(table_t::FADT, "FACP"));
+	}
+
+	// Get MCFG
+	[[nodiscard]]
+	auto acpi::mcfg() noexcept -> const acpiMCFG_t* {
+		return std::bit_cast<const acpiMCFG_t*>(acpi::cached(table_t::MCFG, "MCFG"));
+	}
+
+
+	// Get MADT entries
+	[[nodiscard]]
+	auto acpi::madtEntries() noexcept -> acpiEntries_t<acpiMADT_t, acpiMADTEntry_t> {
+		return acpiEntries_t<acpiMADT_t, acpiMADTEntry_t> {acpi::madt()};
+	}
+
+	// Get MCFG entries
+	[[nodiscard]]
+	auto acpi::mcfgEntries() noexcept -> acpiEntries_t<acpiMCFG_t, acpiMCFGEntry_t> {
+		return acpiEntries_t<acpiMCFG_t, acpiMCFGEntry_t> {acpi::mcfg()};
+	}
+
+
+	// Setup ACPI function
+	void acpiSetup() noexcept {
+
+		// Get RSDP
+		const auto rsdp {acpi::rsdp()};
+		if (nullptr == rsdp) [[unlikely]] {
+			klib::kprintf("ACPI:\t\tRSDP not found\n");
+			return;
+		}
+		klib::kprintf("ACPI:\t\trevision %d, OEM %c%c%c%c%c%c\n", rsdp->revision, rsdp->oemID[0], rsdp->oemID[1], rsdp->oemID[2], rsdp->oemID[3], rsdp->oemID[4], rsdp->oemID[5]);
+
+		// Count processors and I/O APICs
+		auto cpus	{0_usize};
+		auto ioapics	{0_usize};
+		for (const auto &entry : acpi::madtEntries()) {
+			switch (entry.type) {
+				case acpiMADTType_t::LAPIC:
+				case acpiMADTType_t::X2APIC:
+					cpus++;
+					break;
+				case acpiMADTType_t::IOAPIC:
+					ioapics++;
+					break;
+				default:
+					break;
+			}
+		}
+		if (const auto madt {acpi::madt()}; nullptr != madt) {
+			klib::kprintf("ACPI MADT:\tLAPIC at 0x%p, %z CPUs, %z IOAPICs\n", static_cast<igros_usize_t>(madt->lapicAddress), cpus, ioapics);
+		}
+
+		// HPET
+		if (const auto hpet {acpi::hpet()}; nullptr != hpet) {
+			klib::kprintf("ACPI HPET:\tat 0x%p\n", static_cast<igros_usize_t>(hpet->address.address));
+		}
+
+		// FADT
+		if (const auto fadt {acpi::fadt()}; nullptr != fadt) {
+			klib::kprintf("ACPI FADT:\tSCI IRQ %d, century %d\n", fadt->sciInterrupt, fadt->century);
+		}
+
+		// MCFG
+		for (const auto &entry : acpi::mcfgEntries()) {
+			klib::kprintf("ACPI MCFG:\tsegment %d, bus %d - %d at 0x%p\n", entry.segment, entry.busStart, entry.busEnd, static_cast<igros_usize_t>(entry.address));
+		}
+
+	}
+
+
+}	// namespace igros::arch
@@ -0,0 +1,402 @@
+////////////////////////////////////////////////////////////////
+//
+//	ACPI tables parser
+//
+//	File:	acpi.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <array>
+#include <bit>
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+#pragma pack(push, 1)
+
+	// Root System Description Pointer
+	struct acpiRSDP_t {
+		char			signature[8];
+		igros_byte_t		checksum;
+		char			oemID[6];
+		igros_byte_t		revision;
+		igros_dword_t		rsdtAddress;
+		// ACPI 2.0+ fields
+		igros_dword_t		length;
+		igros_quad_t		xsdtAddress;
+		igros_byte_t		extChecksum;
+		igros_byte_t		reserved[3];
+	};
+
+	// System Description Table header
+	struct acpiHeader_t {
+		char			signature[4];
+		igros_dword_t		length;
+		igros_byte_t		revision;
+		igros_byte_t		checksum;
+		char			oemID[6];
+		char			oemTableID[8];
+		igros_dword_t		oemRevision;
+		igros_dword_t		creatorID;
+		igros_dword_t		creatorRevision;
+	};
+
+	// Generic Address Structure
+	struct acpiGAS_t {
+		igros_byte_t		addressSpace;
+		igros_byte_t		bitWidth;
+		igros_byte_t		bitOffset;
+		igros_byte_t		accessSize;
+		igros_quad_t		address;
+	};
+
+
+	// Multiple APIC Description Table
+	struct acpiMADT_t {
+		acpiHeader_t		header;
+		igros_dword_t		lapicAddress;
+		igros_dword_t		flags;
+	};
+
+	// MADT entry types enumeration
+	enum class acpiMADTType_t : igros_byte_t {
+		LAPIC		= 0x00_u8,
+		IOAPIC		= 0x01_u8,
+		ISO		= 0x02_u8,
+		NMI_SOURCE	= 0x03_u8,
+		LAPIC_NMI	= 0x04_u8,
+		LAPIC_OVERRIDE	= 0x05_u8,
+		X2APIC		= 0x09_u8,
+		X2APIC_NMI	= 0x0A_u8
+	};
+
+	// MADT entry header
+	struct acpiMADTEntry_t {
+		acpiMADTType_t		type;
+		igros_byte_t		length;
+	};
+
+	// MADT processor local APIC entry
+	struct acpiMADTLAPIC_t {
+		acpiMADTEntry_t		entry;
+		igros_byte_t		processorID;
+		igros_byte_t		apicID;
+		igros_dword_t		flags;
+	};
+
+	// MADT I/O APIC entry
+	struct acpiMADTIOAPIC_t {
+		acpiMADTEntry_t		entry;
+		igros_byte_t		ioapicID;
+		igros_byte_t		reserved;
+		igros_dword_t		address;
+		igros_dword_t		gsiBase;
+	};
+
+	// MADT interrupt source override entry
+	struct acpiMADTISO_t {
+		acpiMADTEntry_t		entry;
+		igros_byte_t		bus;
+		igros_byte_t		source;
+		igros_dword_t		gsi;
+		igros_word_t		flags;
+	};
+
+	// MADT local APIC NMI entry
+	struct acpiMADTLAPICNMI_t {
+		acpiMADTEntry_t		entry;
+		igros_byte_t		processorID;
+		igros_word_t		flags;
+		igros_byte_t		lint;
+	};
+
+	// MADT local APIC address override entry
+	struct acpiMADTLAPICOverride_t {
+		acpiMADTEntry_t		entry;
+		igros_word_t		reserved;
+		igros_quad_t		address;
+	};
+
+	// MADT processor local x2APIC entry
+	struct acpiMADTX2APIC_t {
+		acpiMADTEntry_t		entry;
+		igros_word_t		reserved;
+		igros_dword_t		x2apicID;
+		igros_dword_t		flags;
+		igros_dword_t		processorUID;
+	};
+
+
+	// High Precision Event Timer table
+	struct acpiHPET_t {
+		acpiHeader_t		header;
+		igros_dword_t		eventTimerBlockID;
+		acpiGAS_t		address;
+		igros_byte_t		hpetNumber;
+		igros_word_t		minimumTick;
+		igros_byte_t		pageProtection;
+	};
+
+
+	// Fixed ACPI Description Table
+	struct acpiFADT_t {
+		acpiHeader_t		header;
+		igros_dword_t		firmwareControl;
+		igros_dword_t		dsdt;
+		igros_byte_t		reserved0;
+		igros_byte_t		preferredPMProfile;
+		igros_word_t		sciInterrupt;
+		igros_dword_t		smiCommandPort;
+		igros_byte_t		acpiEnable;
+		igros_byte_t		acpiDisable;
+		igros_byte_t		s4biosRequest;
+		igros_byte_t		pstateControl;
+		igros_dword_t		pm1aEventBlock;
+		igros_dword_t		pm1bEventBlock;
+		igros_dword_t		pm1aControlBlock;
+		igros_dword_t		pm1bControlBlock;
+		igros_dword_t		pm2ControlBlock;
+		igros_dword_t		pmTimerBlock;
+		igros_dword_t		gpe0Block;
+		igros_dword_t		gpe1Block;
+		igros_byte_t		pm1EventLength;
+		igros_byte_t		pm1ControlLength;
+		igros_byte_t		pm2ControlLength;
+		igros_byte_t		pmTimerLength;
+		igros_byte_t		gpe0Length;
+		igros_byte_t		gpe1Length;
+		igros_byte_t		gpe1Base;
+		igros_byte_t		cstateControl;
+		igros_word_t		worstC2Latency;
+		igros_word_t		worstC3Latency;
+		igros_word_t		flushSize;
+		igros_word_t		flushStride;
+		igros_byte_t		dutyOffset;
+		igros_byte_t		dutyWidth;
+		igros_byte_t		dayAlarm;
+		igros_byte_t		monthAlarm;
+		igros_byte_t		century;
+		igros_word_t		bootArchFlags;
+		igros_byte_t		reserved1;
+		igros_dword_t		flags;
+		// ACPI 2.0+ fields
+		acpiGAS_t		resetRegister;
+		igros_byte_t		resetValue;
+		igros_word_t		armBootArchFlags;
+		igros_byte_t		minorVersion;
+		igros_quad_t		xFirmwareControl;
+		igros_quad_t		xDsdt;
+		acpiGAS_t		xPM1aEventBlock;
+		acpiGAS_t		xPM1bEventBlock;
+		acpiGAS_t		xPM1aControlBlock;
+		acpiGAS_t		xPM1bControlBlock;
+		acpiGAS_t		xPM2ControlBlock;
+		acpiGAS_t		xPMTimerBlock;
+		acpiGAS_t		xGPE0Block;
+		acpiGAS_t		xGPE1Block;
+	};
+
+
+	// PCI Express memory mapped configuration table
+	struct acpiMCFG_t {
+		acpiHeader_t		header;
+		igros_quad_t		reserved;
+	};
+
+	// MCFG configuration space allocation entry
+	struct acpiMCFGEntry_t {
+		igros_quad_t		address;
+		igros_word_t		segment;
+		igros_byte_t		busStart;
+		igros_byte_t		busEnd;
+		igros_dword_t		reserved;
+	};
+
+#pragma pack(pop)
+
+
+	// ACPI table entries view (zero-copy, in-place)
+	template<typename T, typename E>
+	class acpiEntries_t final {
+
+		// Table pointer
+		const T*	mTable;
+
+
+	public:
+
+		// Entries iterator
+		class iterator final {
+
+			// Current entry address
+			const igros_byte_t*	mCurrent;
+
+
+		public:
+
+			// C-tor
+			constexpr explicit iterator(const igros_byte_t* current) noexcept
+				: mCurrent {current} {}
+
+			// Dereference
+			[[nodiscard]]
+			auto	operator*() const noexcept -> const E& {
+				return *std::bit_cast<const E*>(mCurrent);
+			}
+
+			// Increment
+			auto	operator++() noexcept -> iterator& {
+				// Variable size entries hold their own length
+				if constexpr (requires (const E &entry) { entry.length; }) {
+					// Get entry length
+					const auto length {std::bit_cast<const E*>(mCurrent)->length};
+					// Skip broken zero-length entries
+					mCurrent += (0_u8 != length) ? length : sizeof(E);
+				} else {
+					mCurrent += sizeof(E);
+				}
+				return *this;
+			}
+
+			// Compare
+			[[nodiscard]]
+			constexpr bool	operator!=(const iterator &other) const noexcept {
+				return mCurrent < other.mCurrent;
+			}
+
+
+		};
+
+
+		// C-tor
+		constexpr explicit acpiEntries_t(const T* table) noexcept
+			: mTable {table} {}
+
+		// Get first entry
+		[[nodiscard]]
+		auto	begin() const noexcept -> iterator {
+			return iterator {(nullptr != mTable) ? std::bit_cast<const igros_byte_t*>(mTable) + sizeof(T) : nullptr};
+		}
+
+		// Get past-the-end entry
+		[[nodiscard]]
+		auto	end() const noexcept -> iterator {
+			return iterator {(nullptr != mTable) ? std::bit_cast<const igros_byte_t*>(mTable) + mTable->header.length : nullptr};
+		}
+
+
+	};
+
+
+	// Cast MADT entry to concrete type
+	template<typename T>
+	[[nodiscard]]
+	inline auto acpiEntryCast(const acpiMADTEntry_t &entry) noexcept -> const T* {
+		// Entry must be large enough to hold requested type
+		return (sizeof(T) <= entry.length) ? std::bit_cast<const T*>(&entry) : nullptr;
+	}
+
+
+	// ACPI tables structure
+	class acpi final {
+
+		// Cached tables enumeration
+		enum class table_t : igros_usize_t {
+			MADT,
+			HPET,
+			FADT,
+			MCFG,
+			COUNT
+		};
+
+		// Cached RSDP
+		static const acpiRSDP_t*	mRSDP;
+		// RSDP search done flag
+		static bool			mSearched;
+		// Cached tables
+		static std::array<const acpiHeader_t*, static_cast<igros_usize_t>(table_t::COUNT)>	mTables;
+		// Cached tables lookup done flags
+		static std::array<bool, static_cast<igros_usize_t>(table_t::COUNT)>			mResolved;
+
+		// Search RSDP in memory range
+		[[nodiscard]]
+		static auto	search(const igros_usize_t start, const igros_usize_t end) noexcept -> const acpiRSDP_t*;
+		// Get cached table
+		[[nodiscard]]
+		static auto	cached(const table_t table, const char* signature) noexcept -> const acpiHeader_t*;
+
+		// Copy c-tor
+		acpi(const acpi &other) = delete;
+		// Copy assignment
+		auto	operator=(const acpi &other) -> acpi& = delete;
+
+		// Move c-tor
+		acpi(acpi &&other) = delete;
+		// Move assignment
+		auto	operator=(acpi &&other) -> acpi& = delete;
+
+
+	public:
+
+		// Default c-tor
+		acpi() noexcept = default;
+
+		// Init ACPI (use RSDP provided by bootloader if any)
+		static void	init(const igros_pointer_t rsdp = nullptr) noexcept;
+
+		// Validate table checksum
+		[[nodiscard]]
+		static bool	checksum(const igros_pointer_t data, const igros_usize_t size) noexcept;
+		// Convert physical address to accessible pointer
+		[[nodiscard]]
+		static auto	map(const igros_quad_t phys) noexcept -> const igros_byte_t*;
+
+		// Get RSDP
+		[[nodiscard]]
+		static auto	rsdp() noexcept -> const acpiRSDP_t*;
+		// Find table by signature
+		[[nodiscard]]
+		static auto	find(const char* signature, const igros_usize_t index = 0_usize) noexcept -> const acpiHeader_t*;
+
+		// Get MADT
+		[[nodiscard]]
+		static auto	madt() noexcept -> const acpiMADT_t*;
+		// Get HPET
+		[[nodiscard]]
+		static auto	hpet() noexcept -> const acpiHPET_t*;
+		// Get FADT
+		[[nodiscard]]
+		static auto	fadt() noexcept -> const acpiFADT_t*;
+		// Get MCFG
+		[[nodiscard]]
+		static auto	mcfg() noexcept -> const acpiMCFG_t*;
+
+		// Get MADT entries
+		[[nodiscard]]
+		static auto	madtEntries() noexcept -> acpiEntries_t<acpiMADT_t, acpiMADTEntry_t>;
+		// Get MCFG entries
+		[[nodiscard]]
+		static auto	mcfgEntries() noexcept -> acpiEntries_t<acpiMCFG_t, acpiMCFGEntry_t>;
+
+
+	};
+
+
+	// Setup ACPI function
+	void acpiSetup() noexcept;
+
+
+}	// namespace igros::arch
@@ -0,0 +1,363 @@
+////////////////////////////////////////////////////////////////
+//
+//	High Precision Event Timer
+//
+//	File:	hpet.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+#include <bit>
+// IgrOS-Kernel arch
+#include <arch/io.hpp>
+#include <arch/irq.hpp>
+#include <arch/register.hpp>
+#include <arch/smp.hpp>
+#if	defined (IGROS_ARCH_x86_64)
+#include <arch/x86_64/apic.hpp>
+#include <arch/x86_64/isr.hpp>
+#endif	// IGROS_ARCH_x86_64
+// IgrOS-Kernel drivers
+#include <drivers/acpi/acpi.hpp>
+#include <drivers/clock/hpet.hpp>
+// IgrOS-Kernel library
+#include <klib/kLock.hpp>
+#include <klib/kmath.hpp>
+#include <klib/kprint.hpp>
+// IgrOS-Kernel system
+#include <sys/clocksource.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// General capabilities and ID register
+	constexpr auto HPET_GCAP_ID		{0x000_usize};
+	// General configuration register
+	constexpr auto HPET_GEN_CONF		{0x010_usize};
+	// Main counter value register
+	constexpr auto HPET_MAIN_COUNTER	{0x0F0_usize};
+	// Timer N configuration and capability register
+	constexpr auto HPET_TIMER_CONF		{0x100_usize};
+	// Timer N comparator register
+	constexpr auto HPET_TIMER_COMPARATOR	{0x108_usize};
+	// Timer N FSB route register
+	constexpr auto HPET_TIMER_FSB_ROUTE	{0x110_usize};
+	// Timer N registers stride
+	constexpr auto HPET_TIMER_STRIDE	{0x020_usize};
+
+	// Capabilities: number of timers - 1
+	constexpr auto HPET_CAP_TIMERS_SHIFT	{8_u32};
+	constexpr auto HPET_CAP_TIMERS_MASK	{0x1F_u32};
+	// Capabilities: main counter is 64-bit
+	constexpr auto HPET_CAP_COUNT_64	{0x00002000_u32};
+	// Max counter period (femtoseconds)
+	constexpr auto HPET_PERIOD_MAX		{0x05F5E100_u32};
+	// Femtoseconds per second
+	constexpr auto HPET_FSEC_PER_SEC	{1000000000000000_u64};
+	// Femtoseconds per nanosecond
+	constexpr auto HPET_FSEC_PER_NSEC	{1000000_u64};
+
+	// Configuration: main counter runs
+	constexpr auto HPET_CONF_ENABLE		{0x00000001_u32};
+	// Configuration: legacy replacement route
+	constexpr auto HPET_CONF_LEGACY		{0x00000002_u32};
+
+	// Timer: interrupt enable
+	constexpr auto HPET_TIMER_INT_ENABLE	{0x00000004_u32};
+	// Timer: periodic mode
+	constexpr auto HPET_TIMER_PERIODIC	{0x00000008_u32};
+	// Timer: forced 32-bit mode
+	constexpr auto HPET_TIMER_32BIT		{0x00000100_u32};
+	// Timer: FSB delivery enable
+	constexpr auto HPET_TIMER_FSB_ENABLE	{0x00004000_u32};
+	// Timer: FSB delivery capable
+	constexpr auto HPET_TIMER_FSB_CAP	{0x00008000_u32};
+
+	// Max number of comparators
+	constexpr auto HPET_TIMERS_MAX		{32_usize};
+	// Max one-shot delay (1 hour, keeps ns -> fs in quad)
+	constexpr auto HPET_DELAY_MAX		{3600_u64 * sys::NSEC_PER_SEC};
+
+	// Registers block size
+	constexpr auto HPET_MMIO_SIZE		{0x400_u64};
+#if	defined (IGROS_ARCH_i386)
+	// Identity mapped uncached window start (4Gb - 32Mb)
+	constexpr auto HPET_MMIO_START		{0xFE000000_u64};
+#elif	defined (IGROS_ARCH_x86_64)
+	// Identity mapped uncached window start (3Gb)
+	constexpr auto HPET_MMIO_START		{0xC0000000_u64};
+#else
+	static_assert(false, u8"Unknown architecture!!!");
+#endif
+	// Identity mapped uncached window end (4Gb)
+	constexpr auto HPET_MMIO_END		{0x100000000_u64};
+
+#if	defined (IGROS_ARCH_x86_64)
+	// First FSB comparator vector (one per comparator, below APIC vectors)
+	constexpr auto HPET_FSB_VECTOR		{0xD0_usize};
+	// Number of FSB comparator vectors
+	constexpr auto HPET_FSB_VECTORS		{0x10_usize};
+	// Message address (local APIC, destination ID in bits 12 - 19)
+	constexpr auto HPET_FSB_ADDRESS		{0xFEE00000_u32};
+#endif	// IGROS_ARCH_x86_64
+
+
+	// Comparator state
+	struct hpetTimer_t {
+		hpetHandler_t		handler;		// Expiry callback
+		igros_pointer_t		arg;			// Callback argument
+		igros_usize_t		cpu;			// Destination CPU
+		bool			fsb;			// FSB delivery capable
+		bool			used;			// Claimed
+	};
+
+
+	// Registers base (identity mapped, uncached)
+	static igros_byte_t*					hpetBase	{nullptr};
+	// Counter period (femtoseconds)
+	static igros_dword_t					hpetPeriod	{0_u32};
+	// Number of comparators
+	static igros_usize_t					hpetCount	{0_usize};
+	// Comparators
+	static std::array<hpetTimer_t, HPET_TIMERS_MAX>		hpetTimerList	{};
+	// Comparators claim lock
+	static klib::kSpinlock<>				hpetLock	{};
+
+
+	// Read HPET register
+	[[nodiscard]]
+	static auto hpetRegRead(const igros_usize_t reg) noexcept -> igros_dword_t {
+		return io::get().readMemory32(std::bit_cast<const igros_dword_t*>(hpetBase + reg));
+	}
+
+	// Write HPET register
+	static void hpetRegWrite(const igros_usize_t reg, const igros_dword_t value) noexcept {
+		io::get().writeMemory32(std::bit_cast<igros_dword_t*>(hpetBase + reg), value);
+	}
+
+	// Comparator register
+	[[nodiscard]]
+	constexpr static auto hpetTimerReg(const igros_usize_t reg, const igros_usize_t timer) noexcept -> igros_usize_t {
+		return reg + timer * HPET_TIMER_STRIDE;
+	}
+
+
+	// HPET clock source (rated between PIT and invariant TSC)
+	static sys::clocksource_t	hpetClocksource	{"HPET", hpetRead, 0_u64, 250_u32, 0_u32, 0_u32};
+
+
+#if	defined (IGROS_ARCH_x86_64)
+
+	// FSB comparator interrupt handler
+	[[nodiscard]]
+	static auto hpetInterruptHandler([[maybe_unused]] const register_t* const regs, const igros_pointer_t cookie) noexcept -> irq::return_t {
+		const auto timer {static_cast<hpetTimer_t*>(cookie)};
+		// Edge triggered message - nothing to acknowledge in HPET
+		timer->handler(timer->arg);
+		return irq::return_t::HANDLED;
+	}
+
+	// Route comparator messages to CPU
+	[[nodiscard]]
+	static auto hpetTimerRoute(const igros_usize_t index) noexcept -> bool {
+		if (!x86_64::apic::isAvailable() || (index >= HPET_FSB_VECTORS)) {
+			return false;
+		}
+		const auto vector {HPET_FSB_VECTOR + index};
+		if (!x86_64::isrHandlerAdd(vector, hpetInterruptHandler, &hpetTimerList[index])) [[unlikely]] {
+			return false;
+		}
+		// Fixed delivery, edge triggered, physical destination
+		hpetRegWrite(hpetTimerReg(HPET_TIMER_FSB_ROUTE, index), static_cast<igros_dword_t>(vector));
+		hpetRegWrite(hpetTimerReg(HPET_TIMER_FSB_ROUTE, index) + 4_usize, HPET_FSB_ADDRESS | (x86_64::smp::apicID(hpetTimerList[index].cpu) << 12));
+		hpetRegWrite(hpetTimerReg(HPET_TIMER_CONF, index), HPET_TIMER_FSB_ENABLE);
+		return true;
+	}
+
+	// Remove comparator messages route
+	static void hpetTimerUnroute(const igros_usize_t index) noexcept {
+		x86_64::isrHandlerRemove(HPET_FSB_VECTOR + index, hpetInterruptHandler, &hpetTimerList[index]);
+	}
+
+#else
+
+	// No local APIC support - no message delivery
+	[[nodiscard]]
+	static auto hpetTimerRoute([[maybe_unused]] const igros_usize_t index) noexcept -> bool {
+		return false;
+	}
+
+	// No local APIC support - no message delivery
+	static void hpetTimerUnroute([[maybe_unused]] const igros_usize_t index) noexcept {}
+
+#endif	// IGROS_ARCH_x86_64
+
+
+	// HPET counter frequency (Hz, 0 if HPET is not used)
+	[[nodiscard]]
+	auto hpetFrequency() noexcept -> igros_quad_t {
+		return hpetClocksource.frequency;
+	}
+
+	// Read HPET main counter
+	[[nodiscard]]
+	auto hpetRead() noexcept -> igros_quad_t {
+		// Two 32-bit halves - retry if low half wrapped in between
+		for (;;) {
+			const auto high	{hpetRegRead(HPET_MAIN_COUNTER + 4_usize)};
+			const auto low	{hpetRegRead(HPET_MAIN_COUNTER)};
+			if (high == hpetRegRead(HPET_MAIN_COUNTER + 4_usize)) [[likely]] {
+				return (static_cast<igros_quad_t>(high) << 32) | low;
+			}
+		}
+	}
+
+	// Number of comparators
+	[[nodiscard]]
+	auto hpetTimers() noexcept -> igros_usize_t {
+		return hpetCount;
+	}
+
+
+	// Claim free comparator delivering to CPU (HPET_TIMER_NONE if none)
+	[[nodiscard]]
+	auto hpetTimerClaim(const igros_usize_t cpu, const hpetHandler_t handler, const igros_pointer_t arg) noexcept -> igros_usize_t {
+		if ((nullptr == handler) || !smp::get().isOnline(cpu)) [[unlikely]] {
+			return HPET_TIMER_NONE;
+		}
+		auto index {HPET_TIMER_NONE};
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {hpetLock};
+			for (auto i {0_usize}; i < hpetCount; i++) {
+				if (hpetTimerList[i].fsb && !hpetTimerList[i].used) {
+					hpetTimerList[i].handler	= handler;
+					hpetTimerList[i].arg		= arg;
+					hpetTimerList[i].cpu		= cpu;
+					hpetTimerList[i].used		= true;
+					index				= i;
+					break;
+				}
+			}
+		}
+		if (HPET_TIMER_NONE == index) {
+			return HPET_TIMER_NONE;
+		}
+		// Message interrupt straight to requested CPU
+		if (!hpetTimerRoute(index)) [[unlikely]] {
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {hpetLock};
+			hpetTimerList[index].used = false;
+			return HPET_TIMER_NONE;
+		}
+		return index;
+	}
+
+	// Release claimed comparator
+	void hpetTimerRelease(const igros_usize_t timer) noexcept {
+		if ((timer >= hpetCount) || !hpetTimerList[timer].used) [[unlikely]] {
+			return;
+		}
+		hpetRegWrite(hpetTimerReg(HPET_TIMER_CONF, timer), 0_u32);
+		// Waits for running handlers
+		hpetTimerUnroute(timer);
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {hpetLock};
+		hpetTimerList[timer].used = false;
+	}
+
+	// Fire comparator once after given nanoseconds (false if already passed)
+	[[nodiscard]]
+	auto hpetTimerArm(const igros_usize_t timer, const igros_quad_t ns) noexcept -> bool {
+		if ((timer >= hpetCount) || !hpetTimerList[timer].used) [[unlikely]] {
+			return false;
+		}
+		// Delay in counter ticks (at least one)
+		const auto delay	{(ns < HPET_DELAY_MAX) ? ns : HPET_DELAY_MAX};
+		const auto ticks	{klib::kdivmod(delay * HPET_FSEC_PER_NSEC, hpetPeriod).quotient};
+		const auto deadline	{hpetRead() + ((0_u64 != ticks) ? ticks : 1_u64)};
+		// Halves are written separately, so mixed old and new value must not fire
+		hpetRegWrite(hpetTimerReg(HPET_TIMER_CONF, timer), HPET_TIMER_FSB_ENABLE);
+		hpetRegWrite(hpetTimerReg(HPET_TIMER_COMPARATOR, timer), static_cast<igros_dword_t>(deadline));
+		hpetRegWrite(hpetTimerReg(HPET_TIMER_COMPARATOR, timer) + 4_usize, static_cast<igros_dword_t>(deadline >> 32));
+		// One-shot: fires once when counter equals comparator
+		hpetRegWrite(hpetTimerReg(HPET_TIMER_CONF, timer), HPET_TIMER_FSB_ENABLE | HPET_TIMER_INT_ENABLE);
+		// Counter may have run past comparator while it was written
+		return (deadline - hpetRead() - 1_u64) < (1_u64 << 63);
+	}
+
+	// Cancel armed comparator
+	void hpetTimerStop(const igros_usize_t timer) noexcept {
+		if ((timer >= hpetCount) || !hpetTimerList[timer].used) [[unlikely]] {
+			return;
+		}
+		hpetRegWrite(hpetTimerReg(HPET_TIMER_CONF, timer), HPET_TIMER_FSB_ENABLE);
+	}
+
+
+	// Setup HPET
+	void hpetSetup() noexcept {
+
+		// Discovered via ACPI
+		const auto table {acpi::hpet()};
+		if (nullptr == table) {
+			klib::kprintf("HPET:\t\tnot available\n");
+			return;
+		}
+		// Registers must be reachable without remapping
+		if ((table->address.address < HPET_MMIO_START) || (table->address.address > (HPET_MMIO_END - HPET_MMIO_SIZE))) [[unlikely]] {
+			klib::kprintf("HPET:\t\tat 0x%p is not mapped\n", static_cast<igros_usize_t>(table->address.address));
+			return;
+		}
+		// Identity mapped uncached region
+		hpetBase = std::bit_cast<igros_byte_t*>(static_cast<igros_usize_t>(table->address.address));
+
+		// Sane period required
+		const auto caps	{hpetRegRead(HPET_GCAP_ID)};
+		hpetPeriod	= hpetRegRead(HPET_GCAP_ID + 4_usize);
+		if ((0_u32 == hpetPeriod) || (hpetPeriod > HPET_PERIOD_MAX)) [[unlikely]] {
+			klib::kprintf("HPET:\t\tbad period %d fs\n", hpetPeriod);
+			return;
+		}
+		// 32-bit counter wraps in minutes - not worth it
+		if (0_u32 == (caps & HPET_CAP_COUNT_64)) {
+			klib::kprintf("HPET:\t\t32-bit counter, not used\n");
+			return;
+		}
+
+		// Stop counter, keep legacy routes off
+		hpetRegWrite(HPET_GEN_CONF, hpetRegRead(HPET_GEN_CONF) & ~(HPET_CONF_ENABLE | HPET_CONF_LEGACY));
+		// Firmware may have left comparators armed
+		hpetCount = ((caps >> HPET_CAP_TIMERS_SHIFT) & HPET_CAP_TIMERS_MASK) + 1_usize;
+		auto fsb {0_usize};
+		for (auto i {0_usize}; i < hpetCount; i++) {
+			const auto conf {hpetRegRead(hpetTimerReg(HPET_TIMER_CONF, i))};
+			hpetRegWrite(hpetTimerReg(HPET_TIMER_CONF, i), conf & ~(HPET_TIMER_INT_ENABLE | HPET_TIMER_PERIODIC | HPET_TIMER_32BIT | HPET_TIMER_FSB_ENABLE));
+			hpetTimerList[i].fsb = (0_u32 != (conf & HPET_TIMER_FSB_CAP));
+			fsb += hpetTimerList[i].fsb ? 1_usize : 0_usize;
+		}
+		// Start counter
+		hpetRegWrite(HPET_GEN_CONF, hpetRegRead(HPET_GEN_CONF) | HPET_CONF_ENABLE);
+
+		// Hz = 10^15 fs / period
+		hpetClocksource.frequency = klib::kdivmod(HPET_FSEC_PER_SEC, static_cast<igros_quad_t>(hpetPeriod)).quotient;
+		klib::kprintf(
+			"HPET:\t\tat 0x%p, %llu Hz, %z timers (%z FSB)\n",
+			static_cast<igros_usize_t>(table->address.address),
+			hpetClocksource.frequency,
+			hpetCount,
+			fsb
+		);
+		// Better than PIT
+		sys::clocksourceRegister(hpetClocksource);
+
+	}
+
+
+}	// namespace igros::arch
+
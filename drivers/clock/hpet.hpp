@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////////
+//
+//	High Precision Event Timer
+//
+//	File:	hpet.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// HPET
+	//
+	// Block found via ACPI provides 64-bit monotonic main counter (clock
+	// source) and set of comparators. Comparators capable of FSB delivery
+	// send message interrupts straight to chosen CPU and serve as per-CPU
+	// one-shot event timers
+
+
+	// No comparator
+	constexpr auto HPET_TIMER_NONE		{~0_usize};
+
+
+	// Comparator expiry callback (interrupt context)
+	using hpetHandler_t	= std::add_pointer_t<void (const igros_pointer_t)>;
+
+
+	// HPET counter frequency (Hz, 0 if HPET is not used)
+	[[nodiscard]]
+	auto	hpetFrequency() noexcept -> igros_quad_t;
+	// Read HPET main counter
+	[[nodiscard]]
+	auto	hpetRead() noexcept -> igros_quad_t;
+	// Number of comparators
+	[[nodiscard]]
+	auto	hpetTimers() noexcept -> igros_usize_t;
+
+	// Claim free comparator delivering to CPU (HPET_TIMER_NONE if none)
+	[[nodiscard]]
+	auto	hpetTimerClaim(const igros_usize_t cpu, const hpetHandler_t handler, const igros_pointer_t arg) noexcept -> igros_usize_t;
+	// Release claimed comparator
+	void	hpetTimerRelease(const igros_usize_t timer) noexcept;
+	// Fire comparator once after given nanoseconds (false if already passed)
+	[[nodiscard]]
+	auto	hpetTimerArm(const igros_usize_t timer, const igros_quad_t ns) noexcept -> bool;
+	// Cancel armed comparator
+	void	hpetTimerStop(const igros_usize_t timer) noexcept;
+
+	// Setup HPET
+	void	hpetSetup() noexcept;
+
+
+}	// namespace igros::arch
+
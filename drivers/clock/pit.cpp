@@ -21,6 +21,11 @@
 // IgrOS-Kernel library
 #include <klib/kmath.hpp>
 #include <klib/kprint.hpp>
+#include <klib/kSeqlock.hpp>
+// IgrOS-Kernel system
+#include <sys/clockevent.hpp>
+#include <sys/clocksource.hpp>
+#include <sys/timer.hpp>
 
 
 // Arch-dependent code zone
@@ -30,31 +35,54 @@ namespace igros::arch {
 	// PIT ports
 	constexpr auto PIT_CONTROL	{static_cast<io::port_t>(0x0043_u16)};
 	constexpr auto PIT_CHANNEL_0	{static_cast<io::port_t>(0x0040_u16)};
-	//constexpr auto PIT_CHANNEL_1	{static_cast<io::port_t>(PIT_CHANNEL_0 + 1_u16)};
-	//constexpr auto PIT_CHANNEL_2	{static_cast<io::port_t>(PIT_CHANNEL_1 + 1_u16)};
-
-
-	// Ticks count
-	static auto	PIT_TICKS	{0_usize};
+	constexpr auto PIT_CHANNEL_1	{static_cast<io::port_t>(PIT_CHANNEL_0 + 1_u16)};
+	constexpr auto PIT_CHANNEL_2	{static_cast<io::port_t>(PIT_CHANNEL_1 + 1_u16)};
+	// PIT channel 2 gate port (shared with PC speaker)
+	constexpr auto PIT_GATE		{static_cast<io::port_t>(0x0061_u16)};
+
+	// Channel 2 gate bit
+	constexpr auto PIT_GATE_ENABLE	{0x01_u8};
+	// PC speaker enable bit
+	constexpr auto PIT_GATE_SPEAKER	{0x02_u8};
+	// Channel 2 output bit
+	constexpr auto PIT_GATE_OUTPUT	{0x20_u8};
+	// Max single delay (fits into 16-bit counter)
+	constexpr auto PIT_DELAY_MAX	{50000_u32};
+	// Max one-shot event delay (ns, full 16-bit counter)
+	constexpr auto PIT_EVENT_MAX	{0xFFFF_u64 * sys::NSEC_PER_SEC / PIT_MAIN_FREQUENCY};
+
+
+	// Counter state
+	struct pitCount_t {
+		igros_quad_t		cycles;			// Input clock ticks of completed periods
+		igros_word_t		divisor;		// Current divisor
+	};
+
+
+	// Counter state (written from IRQ, read lock-free by clock source)
+	static klib::kSeqlock<pitCount_t>	PIT_COUNT	{pitCount_t {0_u64, 1_u16}};
 	// Current frequency
-	static auto	PIT_FREQUENCY	{0_u16};
-	// Current divisor
-	static auto	PIT_DIVISOR	{1_u16};
+	static auto				PIT_FREQUENCY	{0_u16};
 
 
         // Setup PIT frequency
 	void pitSetupFrequency(const igros_word_t frequency) noexcept {
 
 		// Calculate PIT divisor (Base PIT frequency / required frequency)
-		PIT_DIVISOR	= static_cast<igros_word_t>(PIT_MAIN_FREQUENCY / frequency);
+		const auto divisor	{static_cast<igros_word_t>(PIT_MAIN_FREQUENCY / frequency)};
 		// Save current real frequency value
-		PIT_FREQUENCY	= static_cast<igros_word_t>(PIT_MAIN_FREQUENCY / PIT_DIVISOR);
+		PIT_FREQUENCY		= static_cast<igros_word_t>(PIT_MAIN_FREQUENCY / divisor);
 
-		// Tell pit we want to change divisor for channel 0
-		io::get().writePort8(PIT_CONTROL,	0x36_u16);
+		// PIT interrupt also updates counter state
+		const auto flags	{irq::get().save()};
+		PIT_COUNT.writeBegin().divisor = divisor;
+		// Tell pit we want to change divisor for channel 0 (mode 2, counts down by one)
+		io::get().writePort8(PIT_CONTROL,	0x34_u16);
 		// Set divisor (LOW first, then HIGH)
-		io::get().writePort8(PIT_CHANNEL_0,	(PIT_DIVISOR & 0x00FF_u16));
-		io::get().writePort8(PIT_CHANNEL_0,	(PIT_DIVISOR & 0xFF00_u16) >> 8);
+		io::get().writePort8(PIT_CHANNEL_0,	(divisor & 0x00FF_u16));
+		io::get().writePort8(PIT_CHANNEL_0,	(divisor & 0xFF00_u16) >> 8);
+		PIT_COUNT.writeEnd();
+		irq::get().restore(flags);
 
 		// Print
 		klib::kprintf(
@@ -68,42 +96,121 @@ namespace igros::arch {
 	// Get expired ticks
 	[[nodiscard]]
 	auto pitGetTicks() noexcept -> igros_quad_t {
-		// Send latch command for channel 0;
-		io::get().writePort8(PIT_CONTROL, 0x0000_u16);
-		// Get number of elapsed ticks since last IRQ
-		const auto loByte	{io::get().readPort8(PIT_CHANNEL_0)};
-		const auto hiByte	{io::get().readPort8(PIT_CHANNEL_0)};
-		// Total elapsed ticks value since IRQ
-		const auto elapsed	{static_cast<igros_word_t>(hiByte << 8) | loByte};
-		// Return full expired ticks count
-		return PIT_TICKS * PIT_DIVISOR + elapsed;
+		for (;;) {
+			// Counter latched within read section matches state
+			const auto sequence	{PIT_COUNT.readBegin()};
+			const auto count	{PIT_COUNT.value()};
+			// Send latch command for channel 0;
+			io::get().writePort8(PIT_CONTROL, 0x0000_u16);
+			// Get number of elapsed ticks since last IRQ
+			const auto loByte	{io::get().readPort8(PIT_CHANNEL_0)};
+			const auto hiByte	{io::get().readPort8(PIT_CHANNEL_0)};
+			// Counter runs down from divisor, so elapsed ticks since IRQ are the rest
+			const auto counter	{static_cast<igros_word_t>(hiByte << 8) | loByte};
+			// Return full expired ticks count
+			if (!PIT_COUNT.readRetry(sequence)) [[likely]] {
+				return count.cycles + (count.divisor - counter);
+			}
+		}
 	}
 
 
-	// PIT interrupt (#0) handler
-	void pitInterruptHandler(const register_t* regs) noexcept {
-		// Output every N-th tick were N = frequency
-		if (0_usize == (++PIT_TICKS % PIT_FREQUENCY)) [[unlikely]] {
-			// Current time to HH:MM:SS.zzz
-			const auto elapsed	{pitGetTicks()};
-			const auto res		{klib::kdivmod(elapsed, PIT_MAIN_FREQUENCY)};
-			const auto nanoseconds	{static_cast<igros_dword_t>(res.reminder)};
-			const auto seconds	{static_cast<igros_dword_t>(res.quotient)};
-			const auto minutes	{seconds / 60_u32};
-			const auto hours	{minutes / 60_u32};
-			// Debug date/time
-			klib::kprintf(
-				"IRQ #%d\t[PIT]\n"
-				"Time:\t%02d:%02d:%02d.%03d (~1 sec.)\n",
-				irq::irq_t::PIT,
-				hours	% 24_u32,
-				minutes	% 60_u32,
-				seconds	% 60_u32,
-				nanoseconds
-			);
+	// Busy-wait for given number of PIT input clock ticks
+	void pitDelayTicks(const igros_word_t ticks) noexcept {
+
+		// Disable speaker and channel 2 gate
+		const auto gate		{static_cast<igros_byte_t>(io::get().readPort8(PIT_GATE) & ~(PIT_GATE_ENABLE | PIT_GATE_SPEAKER))};
+		io::get().writePort8(PIT_GATE,		gate);
+		// Channel 2, LOW then HIGH, mode 0 (interrupt on terminal count)
+		io::get().writePort8(PIT_CONTROL,	0xB0_u8);
+		io::get().writePort8(PIT_CHANNEL_2,	(ticks & 0x00FF_u16));
+		io::get().writePort8(PIT_CHANNEL_2,	(ticks & 0xFF00_u16) >> 8);
+		// Start counting
+		io::get().writePort8(PIT_GATE,		gate | PIT_GATE_ENABLE);
+
+		// Wait for channel 2 output to go high
+		while (0_u8 == (io::get().readPort8(PIT_GATE) & PIT_GATE_OUTPUT));
+
+	}
+
+	// Busy-wait for given number of microseconds
+	void pitDelay(const igros_dword_t microseconds) noexcept {
+
+		// Split long delays into counter-sized chunks
+		for (auto left {microseconds}; left > 0_u32;) {
+
+			// Current chunk
+			const auto chunk	{(left > PIT_DELAY_MAX) ? PIT_DELAY_MAX : left};
+			left			-= chunk;
+			// Ticks to count (ticks per millisecond * microseconds / 1000)
+			pitDelayTicks(static_cast<igros_word_t>(((chunk * (PIT_MAIN_FREQUENCY / 1000_u32)) / 1000_u32) | 1_u16));
+
 		}
-		// IRQ EOI
-		irq::get().eoi(static_cast<const irq::irq_t>(regs->number));
+
+	}
+
+
+	// Once a second time report
+	static void pitTimerAction([[maybe_unused]] igros_pointer_t arg) noexcept;
+	// Time report timer
+	static sys::timer_t	pitReportTimer	{nullptr, nullptr, 0_u64, pitTimerAction, nullptr, 0_usize};
+
+	// Once a second time report
+	static void pitTimerAction([[maybe_unused]] igros_pointer_t arg) noexcept {
+		// Current time to HH:MM:SS.zzz
+		const auto res		{klib::kdivmod(sys::ktimeGetNs(), sys::NSEC_PER_MSEC)};
+		const auto ms		{klib::kdivmod(res.quotient, 1000_u32)};
+		const auto milliseconds	{static_cast<igros_dword_t>(ms.reminder)};
+		const auto seconds	{static_cast<igros_dword_t>(ms.quotient)};
+		const auto minutes	{seconds / 60_u32};
+		const auto hours	{minutes / 60_u32};
+		// Debug date/time
+		klib::kprintf(
+			"IRQ #%d\t[PIT]\n"
+			"Time:\t%02d:%02d:%02d.%03d (~1 sec.)\n",
+			irq::irq_t::PIT,
+			hours	% 24_u32,
+			minutes	% 60_u32,
+			seconds	% 60_u32,
+			milliseconds
+		);
+		// Next report
+		sys::timerStart(pitReportTimer, sys::NSEC_PER_SEC);
+	}
+
+	// PIT clock source
+	static sys::clocksource_t	pitClocksource	{"PIT", pitGetTicks, PIT_MAIN_FREQUENCY, 100_u32, 0_u32, 0_u32};
+
+
+	// Fire PIT once after given nanoseconds
+	static void pitEventProgram(const igros_quad_t ns) noexcept {
+		// Counter 0 means 65536, so at least one tick
+		const auto ticks	{klib::kdivmod(ns * PIT_MAIN_FREQUENCY, sys::NSEC_PER_SEC).quotient};
+		const auto count	{static_cast<igros_word_t>((ticks > 0xFFFF_u64) ? 0xFFFF_u64 : ((0_u64 != ticks) ? ticks : 1_u64))};
+		// Channel 0, LOW then HIGH, mode 0 (interrupt on terminal count)
+		io::get().writePort8(PIT_CONTROL,	0x30_u8);
+		io::get().writePort8(PIT_CHANNEL_0,	(count & 0x00FF_u16));
+		io::get().writePort8(PIT_CHANNEL_0,	(count & 0xFF00_u16) >> 8);
+	}
+
+	// Cancel PIT event
+	static void pitEventStop() noexcept {
+		// Counting stops till new count is written
+		io::get().writePort8(PIT_CONTROL,	0x30_u8);
+	}
+
+	// PIT clock event (bootstrap processor only)
+	static sys::clockevent_t	pitClockevent	{"PIT", nullptr, pitEventProgram, pitEventStop, PIT_EVENT_MAX, 100_u32, false};
+
+
+	// PIT interrupt (#0) handler
+	void pitInterruptHandler([[maybe_unused]] const register_t* regs) noexcept {
+		// One more period completed
+		auto &count	{PIT_COUNT.writeBegin()};
+		count.cycles	+= count.divisor;
+		PIT_COUNT.writeEnd();
+		// Periodic or one-shot tick
+		sys::tickHandler();
 	}
 
 
@@ -112,6 +219,8 @@ namespace igros::arch {
 
 		// Setup PIT frequency to 100 HZ
 		pitSetupFrequency(PIT_DEFAULT_FREQUENCY);
+		// Fallback clock source (ticks count through IRQ)
+		sys::clocksourceRegister(pitClocksource);
 
 		// Install PIT interrupt handler
 		irq::get().install<irq::irq_t::PIT, pitInterruptHandler>();
@@ -120,6 +229,20 @@ namespace igros::arch {
 
 	}
 
+	// Start PIT tick (one-shot unless PIT keeps time)
+	void pitTickSetup() noexcept {
+
+		// Periodic interrupts count time for PIT clock source
+		if (&pitClocksource == sys::clocksourceCurrent()) {
+			klib::kprintf("PIT:\t\tkeeps time, periodic %d Hz tick\n", PIT_FREQUENCY);
+		} else {
+			sys::clockeventRegister(pitClockevent);
+		}
+		// Report time once a second
+		sys::timerStart(pitReportTimer, sys::NSEC_PER_SEC);
+
+	}
+
 
 }	// namespace igros::arch
 
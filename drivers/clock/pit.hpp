@@ -67,8 +67,15 @@ namespace igros::arch {
 	[[nodiscard]]
 	auto	pitGetTicks() noexcept -> igros_quad_t;
 
+	// Busy-wait for given number of PIT input clock ticks
+	void	pitDelayTicks(const igros_word_t ticks) noexcept;
+	// Busy-wait for given number of microseconds
+	void	pitDelay(const igros_dword_t microseconds) noexcept;
+
 	// Setup programmable interrupt timer
 	void	pitSetup() noexcept;
+	// Start PIT tick (one-shot unless PIT keeps time)
+	void	pitTickSetup() noexcept;
 
 
 }	// namespace igros::arch
@@ -13,10 +13,15 @@
 
 // IgrOS-Kernel arch
 #include <arch/io.hpp>
+#include <arch/irq.hpp>
+#include <arch/register.hpp>
 // IgrOS-Kernel drivers
 #include <drivers/clock/rtc.hpp>
 // IgrOS-Kernel library
 #include <klib/kprint.hpp>
+#include <klib/kSeqlock.hpp>
+// IgrOS-Kernel system
+#include <sys/clocksource.hpp>
 
 
 // Arch-dependent code zone
@@ -56,10 +61,23 @@ namespace igros::arch {
 
 	constexpr auto RTC_REGISTER_A	{0x0A_u8};
 	constexpr auto RTC_REGISTER_B	{0x0B_u8};
+	constexpr auto RTC_REGISTER_C	{0x0C_u8};
 
 	constexpr auto RTC_IS_TIME_24	{0x02_u8};
 	constexpr auto RTC_IS_BINARY	{0x04_u8};
 
+	// Register A: update in progress
+	constexpr auto RTC_UPDATING		{0x80_u8};
+	// Register B: update-ended interrupt enable
+	constexpr auto RTC_UPDATE_ENABLE	{0x10_u8};
+	// Register C: interrupt requested / update ended
+	constexpr auto RTC_IRQ_FLAG		{0x80_u8};
+	constexpr auto RTC_UPDATE_ENDED		{0x10_u8};
+
+
+	// Date/time cache (written from update-ended interrupt only)
+	static klib::kSeqlock<clockDateTime_t>	rtcCache	{};
+
 
 	// Read CMOS register
 	[[nodiscard]]
@@ -70,6 +88,14 @@ namespace igros::arch {
 		return io::get().readPort8(CMOS_DATA);
 	}
 
+	// Write CMOS register
+	void rtcWrite(const igros_byte_t cmd, const igros_byte_t value) noexcept {
+		// Write command
+		io::get().writePort8(CMOS_COMMAND, cmd);
+		// Write data
+		io::get().writePort8(CMOS_DATA, value);
+	}
+
 	// Read CMOS date
 	[[nodiscard]]
 	auto rtcReadDate() noexcept -> rtcDate_t {
@@ -127,10 +153,9 @@ namespace igros::arch {
 		rtcTimeFromBCD(dateTime.time);
 	}
 
-	// Get current date/time
-	clockDateTime_t clockGetCurrentDateTime() noexcept {
-		// Wait for update if any
-		while (0x00_u8 != (0x80_u8 & rtcRead(RTC_REGISTER_A)));
+	// Read date/time from CMOS (registers must be stable)
+	[[nodiscard]]
+	static auto rtcReadClock() noexcept -> clockDateTime_t {
 		// Read CMOS date/time
 		auto rtcDateTime	{rtcReadDateTime()};
 		// Get RTC flags
@@ -163,10 +188,55 @@ namespace igros::arch {
 	}
 
 
+	// RTC interrupt (#8) handler
+	[[nodiscard]]
+	static auto rtcInterruptHandler([[maybe_unused]] const register_t* const regs, [[maybe_unused]] const igros_pointer_t cookie) noexcept -> irq::return_t {
+		// Reading register C acknowledges interrupt
+		const auto status {rtcRead(RTC_REGISTER_C)};
+		if (0_u8 == (status & RTC_IRQ_FLAG)) {
+			return irq::return_t::NONE;
+		}
+		// Registers stay stable for almost a second after update
+		if (0_u8 != (status & RTC_UPDATE_ENDED)) {
+			rtcCache.write(rtcReadClock());
+		}
+		return irq::return_t::HANDLED;
+	}
+
+
+	// Get current date/time (cached, no CMOS access)
+	[[nodiscard]]
+	auto clockGetCurrentDateTime() noexcept -> clockDateTime_t {
+		return rtcCache.read();
+	}
+
+
+	// Date/time to seconds since 01.01.1970
+	[[nodiscard]]
+	auto clockToSeconds(const clockDateTime_t &dateTime) noexcept -> igros_quad_t {
+		// Count years from March (leap day is last day of year)
+		const auto year		{dateTime.year - ((dateTime.month <= 2_u32) ? 1_u32 : 0_u32)};
+		const auto month	{(dateTime.month > 2_u32) ? (dateTime.month - 3_u32) : (dateTime.month + 9_u32)};
+		// Day of 400-years era
+		const auto era		{year / 400_u32};
+		const auto yearOfEra	{year - era * 400_u32};
+		const auto dayOfYear	{(153_u32 * month + 2_u32) / 5_u32 + dateTime.day - 1_u32};
+		const auto dayOfEra	{yearOfEra * 365_u32 + yearOfEra / 4_u32 - yearOfEra / 100_u32 + dayOfYear};
+		// 719468 days from 01.03.0000 to 01.01.1970
+		const auto days		{static_cast<igros_quad_t>(era) * 146097_u64 + dayOfEra - 719468_u64};
+		return days * 86400_u64 + dateTime.hour * 3600_u32 + dateTime.minute * 60_u32 + dateTime.second;
+	}
+
+
 	// Setup RTC function
 	void rtcSetup() noexcept {
+		// Fill cache once (wait for update if any)
+		while (0_u8 != (rtcRead(RTC_REGISTER_A) & RTC_UPDATING));
+		rtcCache.write(rtcReadClock());
 		// Get current date/time
-		auto dateTime {clockGetCurrentDateTime()};
+		const auto dateTime {clockGetCurrentDateTime()};
+		// Anchor kernel wall time
+		sys::ktimeSetReal(clockToSeconds(dateTime));
 		// Print result
 		klib::kprintf(
 			"RTC date/time:\t%02d.%02d.%04d %02d:%02d:%02d\n",
@@ -177,6 +247,20 @@ namespace igros::arch {
 			dateTime.minute,
 			dateTime.second
 		);
+
+		// Refresh cache from update-ended interrupt (once a second)
+		if (!irq::get().add(irq::irq_t::RTC, rtcInterruptHandler)) [[unlikely]] {
+			klib::kprintf("RTC:\t\tno free IRQ handler slot!\n");
+			return;
+		}
+		const auto flags {irq::get().save()};
+		rtcWrite(RTC_REGISTER_B, rtcRead(RTC_REGISTER_B) | RTC_UPDATE_ENABLE);
+		// Drop stale request
+		static_cast<void>(rtcRead(RTC_REGISTER_C));
+		irq::get().restore(flags);
+		// Mask RTC and slave PIC cascade interrupts
+		irq::get().mask(irq::irq_t::RTC);
+		irq::get().mask(irq::irq_t::PIC);
 	}
 
 
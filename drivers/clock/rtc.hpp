@@ -60,14 +60,19 @@ namespace igros::arch {
 	[[nodiscard]]
 	auto clockFromRTC(const rtcDateTime_t &rtcDateTime, const igros_dword_t century) noexcept -> clockDateTime_t;
 
-	// Get current date/time
+	// Get current date/time (cached, no CMOS access)
 	[[nodiscard]]
 	auto clockGetCurrentDateTime() noexcept -> clockDateTime_t;
+	// Date/time to seconds since 01.01.1970
+	[[nodiscard]]
+	auto clockToSeconds(const clockDateTime_t &dateTime) noexcept -> igros_quad_t;
 
 
 	// Read CMOS register
 	[[nodiscard]]
 	auto rtcRead(const igros_byte_t cmd) noexcept -> igros_byte_t;
+	// Write CMOS register
+	void rtcWrite(const igros_byte_t cmd, const igros_byte_t value) noexcept;
 
 	// Read CMOS date
 	[[nodiscard]]
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////
+//
+//	Time-stamp counter clock source
+//
+//	File:	tsc.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// IgrOS-Kernel arch
+#include <arch/cpu.hpp>
+#include <arch/irq.hpp>
+// IgrOS-Kernel drivers
+#include <drivers/clock/hpet.hpp>
+#include <drivers/clock/pit.hpp>
+#include <drivers/clock/tsc.hpp>
+// IgrOS-Kernel library
+#include <klib/kmath.hpp>
+#include <klib/kprint.hpp>
+// IgrOS-Kernel system
+#include <sys/clocksource.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// Calibration window (PIT ticks, ~10 ms)
+	constexpr auto TSC_CALIBRATE_TICKS	{11932_u16};
+	// Calibration runs
+	constexpr auto TSC_CALIBRATE_RUNS	{3_u32};
+	// Max spread between runs (1 / N of result)
+	constexpr auto TSC_CALIBRATE_SPREAD	{100_u64};
+	// HPET calibration window (1 / N second, ~10 ms)
+	constexpr auto TSC_CALIBRATE_HPET	{100_u64};
+
+
+	// Read TSC
+	[[nodiscard]]
+	static auto tscRead() noexcept -> igros_quad_t {
+		return cpu::get().timestamp();
+	}
+
+
+	// TSC clock source
+	static sys::clocksource_t	tscClocksource	{"TSC", tscRead, 0_u64, 300_u32, 0_u32, 0_u32};
+
+
+	// Measure TSC frequency over one PIT window
+	[[nodiscard]]
+	static auto tscCalibratePIT() noexcept -> igros_quad_t {
+		// Nothing may stretch window
+		const auto flags	{irq::get().save()};
+		const auto start	{cpu::get().timestamp()};
+		pitDelayTicks(TSC_CALIBRATE_TICKS);
+		const auto end		{cpu::get().timestamp()};
+		irq::get().restore(flags);
+		// Hz = cycles * PIT Hz / PIT ticks
+		return klib::kdivmod((end - start) * PIT_MAIN_FREQUENCY, static_cast<igros_dword_t>(TSC_CALIBRATE_TICKS)).quotient;
+	}
+
+	// Measure TSC frequency over one HPET window
+	[[nodiscard]]
+	static auto tscCalibrateHPET() noexcept -> igros_quad_t {
+		const auto window	{klib::kdivmod(hpetFrequency(), TSC_CALIBRATE_HPET).quotient};
+		// Nothing may stretch window
+		const auto flags	{irq::get().save()};
+		const auto hpetStart	{hpetRead()};
+		const auto start	{cpu::get().timestamp()};
+		auto hpetEnd		{hpetStart};
+		while ((hpetEnd - hpetStart) < window) {
+			hpetEnd = hpetRead();
+		}
+		const auto end		{cpu::get().timestamp()};
+		irq::get().restore(flags);
+		// Hz = cycles * HPET Hz / HPET ticks
+		return klib::kdivmod((end - start) * hpetFrequency(), hpetEnd - hpetStart).quotient;
+	}
+
+	// Measure TSC frequency against best reference
+	[[nodiscard]]
+	static auto tscCalibrateRun() noexcept -> igros_quad_t {
+		return (0_u64 != hpetFrequency()) ? tscCalibrateHPET() : tscCalibratePIT();
+	}
+
+
+	// Calibrated TSC frequency (Hz, 0 if TSC is not used)
+	[[nodiscard]]
+	auto tscFrequency() noexcept -> igros_quad_t {
+		return tscClocksource.frequency;
+	}
+
+	// Setup TSC clock source (HPET or PIT stays in use if TSC is unreliable)
+	void tscSetup() noexcept {
+
+		// Rate must not change with P/C-states
+		if (!cpu::get().timestampInvariant()) {
+			klib::kprintf("TSC:\t\tnot invariant, keeping %s\n", sys::clocksourceCurrent()->name);
+			return;
+		}
+
+		// Lowest result is least disturbed (SMI, host preemption)
+		auto minimum {~0_u64};
+		auto maximum {0_u64};
+		for (auto i {0_u32}; i < TSC_CALIBRATE_RUNS; i++) {
+			const auto frequency {tscCalibrateRun()};
+			minimum = (frequency < minimum) ? frequency : minimum;
+			maximum = (frequency > maximum) ? frequency : maximum;
+		}
+		// Runs disagree - TSC (or reference) can't be trusted
+		if ((maximum - minimum) > klib::kdivmod(minimum, TSC_CALIBRATE_SPREAD).quotient) {
+			klib::kprintf("TSC:\t\tcalibration unstable (%llu - %llu Hz), keeping %s\n", minimum, maximum, sys::clocksourceCurrent()->name);
+			return;
+		}
+
+		tscClocksource.frequency = minimum;
+		klib::kprintf("TSC:\t\tinvariant, %llu Hz\n", tscClocksource.frequency);
+		// Switch kernel time to TSC
+		sys::clocksourceRegister(tscClocksource);
+
+	}
+
+
+}	// namespace igros::arch
+
@@ -0,0 +1,34 @@
+////////////////////////////////////////////////////////////////
+//
+//	Time-stamp counter clock source
+//
+//	File:	tsc.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// Calibrated TSC frequency (Hz, 0 if TSC is not used)
+	[[nodiscard]]
+	auto	tscFrequency() noexcept -> igros_quad_t;
+
+	// Setup TSC clock source (HPET or PIT stays in use if TSC is unreliable)
+	void	tscSetup() noexcept;
+
+
+}	// namespace igros::arch
+
@@ -11,13 +11,25 @@
 //
 
 
+// C++
+#include <array>
+#include <bit>
 // IgrOS-Kernel arch
+#include <arch/cpu.hpp>
 #include <arch/io.hpp>
 #include <arch/irq.hpp>
+#include <arch/percpu.hpp>
 #include <arch/register.hpp>
 #include <arch/types.hpp>
+// IgrOS-Kernel drivers
+#include <drivers/input/keyboard.hpp>
 // IgrOS-Kernel library
+#include <klib/kAtomic.hpp>
+#include <klib/kLock.hpp>
 #include <klib/kprint.hpp>
+// IgrOS-Kernel system
+#include <sys/sched.hpp>
+#include <sys/thread.hpp>
 
 
 // Arch-dependent code zone
@@ -28,35 +40,318 @@ namespace igros::arch {
 	constexpr auto KEYBOARD_CONTROL	{static_cast<io::port_t>(0x0064_u16)};
 	constexpr auto KEYBOARD_DATA	{static_cast<io::port_t>(0x0060_u16)};
 
+	// Controller status bits
+	constexpr auto KEYBOARD_OUTPUT_FULL	{0x01_u8};
+	constexpr auto KEYBOARD_INPUT_FULL	{0x02_u8};
+	// Controller read configuration command
+	constexpr auto KEYBOARD_READ_CONFIG	{0x20_u8};
+	// Configuration: set 2 is translated to set 1
+	constexpr auto KEYBOARD_TRANSLATE	{0x40_u8};
+	// Keyboard set LEDs command
+	constexpr auto KEYBOARD_SET_LED		{0xED_u8};
+	// Controller wait limit (status reads)
+	constexpr auto KEYBOARD_WAIT		{100000_u32};
+
+	// Scan code prefixes
+	constexpr auto SCAN_EXTENDED		{0xE0_u8};
+	constexpr auto SCAN_PAUSE		{0xE1_u8};
+	// Set 2 release prefix
+	constexpr auto SCAN_BREAK		{0xF0_u8};
+	// Set 1 release bit
+	constexpr auto SCAN_RELEASED		{0x80_u8};
+	// Pause sequence rest (set 1, set 2)
+	constexpr auto SCAN_PAUSE_SET1		{5_u32};
+	constexpr auto SCAN_PAUSE_SET2		{7_u32};
+
+	// Scan codes buffer size (power of two)
+	constexpr auto KEYBOARD_BUFFER_SIZE	{256_usize};
+
+
+	// Scan codes ring (single producer - interrupt handler)
+	// Indices live inside, so atomics on them order accesses to whole ring
+	struct keyboardRing_t {
+		igros_usize_t					head;		// Next scan code to decode
+		igros_usize_t					tail;		// Next free slot
+		igros_usize_t					waiter;		// Blocked reader (thread_t*)
+		std::array<igros_byte_t, KEYBOARD_BUFFER_SIZE>	codes;		// Scan codes
+	};
+
+	// Scan code decoder state
+	struct keyboardDecoder_t {
+		bool			set2;			// Untranslated set 2 codes
+		bool			extended;		// E0 prefix seen
+		bool			release;		// F0 prefix seen (set 2)
+		igros_dword_t		skip;			// Pause sequence bytes left
+		igros_word_t		held;			// Pressed modifier and lock keys
+		igros_byte_t		locks;			// Lock modifiers state
+	};
+
+
+	// Scan codes read by interrupt handler
+	static keyboardRing_t		keyboardRing	{};
+	// Decoder (readers only)
+	static keyboardDecoder_t	keyboardDecoder	{};
+	// Readers lock (never taken by interrupt handler)
+	static klib::kSpinlock<>	keyboardLock	{};
+
+
+	// Wait till controller accepts byte
+	static void keyboardWaitInput() noexcept {
+		for (auto i {0_u32}; (i < KEYBOARD_WAIT) && (0_u8 != (io::get().readPort8(KEYBOARD_CONTROL) & KEYBOARD_INPUT_FULL)); i++) {
+			cpu::get().pause();
+		}
+	}
+
+	// Set keyboard LEDs (acknowledges are dropped by decoder)
+	static void keyboardSetLED(const igros_byte_t locks) noexcept {
+		// Scroll, num and caps lock LEDs are bits 0 - 2
+		const auto leds {static_cast<igros_byte_t>(
+			((0_u8 != (locks & KEYBOARD_MOD_SCROLL_LOCK))	? 0x01_u8 : 0x00_u8) |
+			((0_u8 != (locks & KEYBOARD_MOD_NUM_LOCK))	? 0x02_u8 : 0x00_u8) |
+			((0_u8 != (locks & KEYBOARD_MOD_CAPS_LOCK))	? 0x04_u8 : 0x00_u8)
+		)};
+		keyboardWaitInput();
+		io::get().writePort8(KEYBOARD_DATA, KEYBOARD_SET_LED);
+		keyboardWaitInput();
+		io::get().writePort8(KEYBOARD_DATA, leds);
+	}
+
+
+	// Held bit of modifier or lock key (0 for others)
+	[[nodiscard]]
+	static auto keyboardHeldBit(const keyCode_t key) noexcept -> igros_word_t {
+		switch (key) {
+			case KEY_LEFT_SHIFT:
+				return 0x0001_u16;
+			case KEY_RIGHT_SHIFT:
+				return 0x0002_u16;
+			case KEY_LEFT_CTRL:
+				return 0x0004_u16;
+			case KEY_RIGHT_CTRL:
+				return 0x0008_u16;
+			case KEY_LEFT_ALT:
+				return 0x0010_u16;
+			case KEY_RIGHT_ALT:
+				return 0x0020_u16;
+			case KEY_CAPS_LOCK:
+				return 0x0040_u16;
+			case KEY_NUM_LOCK:
+				return 0x0080_u16;
+			case KEY_SCROLL_LOCK:
+				return 0x0100_u16;
+			default:
+				return 0x0000_u16;
+		}
+	}
+
+	// Lock modifier toggled by key (0 for others)
+	[[nodiscard]]
+	static auto keyboardLockBit(const keyCode_t key) noexcept -> igros_byte_t {
+		switch (key) {
+			case KEY_CAPS_LOCK:
+				return KEYBOARD_MOD_CAPS_LOCK;
+			case KEY_NUM_LOCK:
+				return KEYBOARD_MOD_NUM_LOCK;
+			case KEY_SCROLL_LOCK:
+				return KEYBOARD_MOD_SCROLL_LOCK;
+			default:
+				return 0x00_u8;
+		}
+	}
+
+	// Current modifiers
+	[[nodiscard]]
+	static auto keyboardModifiers(const keyboardDecoder_t &decoder) noexcept -> igros_byte_t {
+		return static_cast<igros_byte_t>(
+			decoder.locks |
+			((0_u16 != (decoder.held & 0x0003_u16)) ? KEYBOARD_MOD_SHIFT	: 0x00_u8) |
+			((0_u16 != (decoder.held & 0x000C_u16)) ? KEYBOARD_MOD_CTRL	: 0x00_u8) |
+			((0_u16 != (decoder.held & 0x0030_u16)) ? KEYBOARD_MOD_ALT	: 0x00_u8)
+		);
+	}
+
+
+	// Feed scan code to decoder (true if event is complete)
+	[[nodiscard]]
+	static auto keyboardDecode(keyboardDecoder_t &decoder, const igros_byte_t code, keyboardEvent_t &event) noexcept -> bool {
+		// Rest of pause sequence
+		if (decoder.skip > 0_u32) {
+			decoder.skip--;
+			return false;
+		}
+		switch (code) {
+			case SCAN_EXTENDED:
+				decoder.extended = true;
+				return false;
+			// Pause has no release
+			case SCAN_PAUSE:
+				decoder.skip	= decoder.set2 ? SCAN_PAUSE_SET2 : SCAN_PAUSE_SET1;
+				event		= {KEY_PAUSE, '\0', keyboardModifiers(decoder), true};
+				return true;
+			// Acknowledge, resend, echo and errors
+			case 0x00_u8:
+			case 0xEE_u8:
+			case 0xFA_u8:
+			case 0xFE_u8:
+			case 0xFF_u8:
+				return false;
+			default:
+				break;
+		}
+		if (decoder.set2 && (SCAN_BREAK == code)) {
+			decoder.release = true;
+			return false;
+		}
+
+		// Set 1 key code
+		auto key		{decoder.set2 ? keymapFromSet2(code) : static_cast<keyCode_t>(code & ~SCAN_RELEASED)};
+		const auto pressed	{decoder.set2 ? !decoder.release : (0_u8 == (code & SCAN_RELEASED))};
+		const auto extended	{decoder.extended};
+		decoder.extended	= false;
+		decoder.release		= false;
+		if (0_u8 == key) {
+			return false;
+		}
+		if (extended) {
+			// Fake shifts sent around print screen and navigation keys
+			if ((KEY_LEFT_SHIFT == key) || (KEY_RIGHT_SHIFT == key)) {
+				return false;
+			}
+			key |= KEY_EXTENDED;
+		}
+
+		// Modifier and lock keys (auto repeat does not toggle locks)
+		if (const auto bit {keyboardHeldBit(key)}; 0_u16 != bit) {
+			const auto repeat {0_u16 != (decoder.held & bit)};
+			decoder.held = pressed ? (decoder.held | bit) : (decoder.held & ~bit);
+			if (const auto lock {keyboardLockBit(key)}; pressed && !repeat && (0_u8 != lock)) {
+				decoder.locks ^= lock;
+				keyboardSetLED(decoder.locks);
+			}
+		}
+
+		// Character
+		const auto modifiers {keyboardModifiers(decoder)};
+		const auto ascii {pressed ? keymapToASCII(
+			key,
+			0_u8 != (modifiers & KEYBOARD_MOD_SHIFT),
+			0_u8 != (modifiers & KEYBOARD_MOD_CAPS_LOCK),
+			0_u8 != (modifiers & KEYBOARD_MOD_NUM_LOCK)
+		) : '\0'};
+		event = {key, ascii, modifiers, pressed};
+		return true;
+	}
+
+
+	// Decode buffered scan codes till event is complete (false if buffer ran out)
+	[[nodiscard]]
+	static auto keyboardNext(keyboardEvent_t &event) noexcept -> bool {
+		// Preempted holder would make other reader on this CPU spin forever
+		percpuPreempt::add(1_u32);
+		auto decoded {false};
+		{
+			const klib::kLockGuard<klib::kSpinlock<>> guard {keyboardLock};
+			const klib::kAtomicRef<igros_usize_t> head {keyboardRing.head};
+			const klib::kAtomicRef<igros_usize_t> tail {keyboardRing.tail};
+			auto position {head.load(klib::kMemoryOrder::RELAXED)};
+			for (const auto end {tail.load(klib::kMemoryOrder::ACQUIRE)}; (position != end) && !decoded;) {
+				decoded = keyboardDecode(keyboardDecoder, keyboardRing.codes[position++ % KEYBOARD_BUFFER_SIZE], event);
+			}
+			// Slots are free for producer from now on
+			head.store(position, klib::kMemoryOrder::RELEASE);
+		}
+		percpuPreempt::add(~0_u32);
+		return decoded;
+	}
+
+
+	// Read key event (false if none and not blocking)
+	[[nodiscard]]
+	auto keyboardRead(keyboardEvent_t &event, const bool block) noexcept -> bool {
+		const klib::kAtomicRef<igros_usize_t> waiter {keyboardRing.waiter};
+		for (;;) {
+			if (keyboardNext(event)) {
+				return true;
+			}
+			if (!block) {
+				return false;
+			}
+			// Publish waiter before checking buffer, so new scan code wakes it
+			waiter.store(std::bit_cast<igros_usize_t>(sys::sched::current()));
+			if (klib::kAtomicRef<igros_usize_t>(keyboardRing.head).load() != klib::kAtomicRef<igros_usize_t>(keyboardRing.tail).load()) {
+				waiter.store(0_usize);
+				continue;
+			}
+			// Wake up is never lost
+			sys::sched::block();
+		}
+	}
+
 
 	// Keyboard interrupt (#1) handler
-	void keyboardInterruptHandler(const register_t* regs) {
+	auto keyboardInterruptHandler([[maybe_unused]] const register_t* const regs, [[maybe_unused]] const igros_pointer_t cookie) noexcept -> irq::return_t {
 		// Check keyboard data port
-		if (const auto status = io::get().readPort8(KEYBOARD_CONTROL); status & 0x01_u8) [[likely]] {
-			// Read keyboard data
-			const auto keyCode = io::get().readPort8(KEYBOARD_DATA);
-			klib::kprintf(
-				"IRQ #%d\t[Keyboard]\n"
-				"Key:\t%s\n"
-				"Code:\t0x%x\n",
-				irq::irq_t::KEYBOARD,
-				(keyCode > 0x80_u8) ? "RELEASED" : "PRESSED",
-				keyCode
-			);
-		}
-		// IRQ EOI
-		irq::get().eoi(static_cast<irq::irq_t>(regs->number));
+		if (const auto status = io::get().readPort8(KEYBOARD_CONTROL); 0x00_u8 == (status & KEYBOARD_OUTPUT_FULL)) [[unlikely]] {
+			// Not ours
+			return irq::return_t::NONE;
+		}
+		// Read keyboard data (newest is dropped when full)
+		const auto keyCode = io::get().readPort8(KEYBOARD_DATA);
+		const klib::kAtomicRef<igros_usize_t> tail {keyboardRing.tail};
+		const auto position {tail.load(klib::kMemoryOrder::RELAXED)};
+		if ((position - klib::kAtomicRef<igros_usize_t>(keyboardRing.head).load(klib::kMemoryOrder::ACQUIRE)) < KEYBOARD_BUFFER_SIZE) [[likely]] {
+			keyboardRing.codes[position % KEYBOARD_BUFFER_SIZE] = keyCode;
+			tail.store(position + 1_usize, klib::kMemoryOrder::RELEASE);
+		}
+		// Wake blocked reader
+		if (const auto waiter {klib::kAtomicRef<igros_usize_t>(keyboardRing.waiter).exchange(0_usize)}; 0_usize != waiter) {
+			sys::sched::wake(std::bit_cast<sys::thread_t*>(waiter));
+		}
+		return irq::return_t::HANDLED;
+	}
+
+
+	// Keyboard console echo thread
+	static void keyboardEcho([[maybe_unused]] const igros_pointer_t arg) noexcept {
+		keyboardEvent_t event {};
+		while (true) {
+			if (keyboardRead(event) && event.pressed && ('\0' != event.ascii)) {
+				klib::kprintf("%c", event.ascii);
+			}
+		}
 	}
 
 
 	// Setip keyboard function
-	void keyboardSetup() {
+	void keyboardSetup() noexcept {
+
+		// Drop stale output
+		for (auto i {0_u32}; (i < KEYBOARD_WAIT) && (0_u8 != (io::get().readPort8(KEYBOARD_CONTROL) & KEYBOARD_OUTPUT_FULL)); i++) {
+			static_cast<void>(io::get().readPort8(KEYBOARD_DATA));
+		}
+		// Check whether controller translates set 2 to set 1
+		keyboardWaitInput();
+		io::get().writePort8(KEYBOARD_CONTROL, KEYBOARD_READ_CONFIG);
+		for (auto i {0_u32}; (i < KEYBOARD_WAIT) && (0_u8 == (io::get().readPort8(KEYBOARD_CONTROL) & KEYBOARD_OUTPUT_FULL)); i++) {
+			cpu::get().pause();
+		}
+		const auto config {io::get().readPort8(KEYBOARD_DATA)};
+		keyboardDecoder.set2 = (0_u8 == (config & KEYBOARD_TRANSLATE));
 
-		// Install keyboard interrupt handler
-		irq::get().install<irq::irq_t::KEYBOARD, keyboardInterruptHandler>();
+		// Add keyboard interrupt handler
+		if (!irq::get().add(irq::irq_t::KEYBOARD, keyboardInterruptHandler)) [[unlikely]] {
+			klib::kprintf("Keyboard:\tno free IRQ handler slot!\n");
+			return;
+		}
 		// Mask Keyboard interrupts
 		irq::get().mask(irq::irq_t::KEYBOARD);
 
+		// Typed characters go to console from thread context
+		if (nullptr == sys::threadCreate("kbd", keyboardEcho, nullptr)) [[unlikely]] {
+			klib::kprintf("Keyboard:\tno echo thread!\n");
+		}
+		klib::kprintf("Keyboard:\tscan code set %d\n", keyboardDecoder.set2 ? 2 : 1);
+
 	}
 
 
@@ -16,14 +16,36 @@
 
 // IgrOS-Kernel arch
 #include <arch/types.hpp>
+// IgrOS-Kernel drivers
+#include <drivers/input/keymap.hpp>
 
 
 // Arch-dependent code zone
 namespace igros::arch {
 
 
-	// Set keyboard LEDs
-	//void	keyboardSetLED();
+	// Keyboard modifiers
+	constexpr auto KEYBOARD_MOD_SHIFT	{0x01_u8};
+	constexpr auto KEYBOARD_MOD_CTRL	{0x02_u8};
+	constexpr auto KEYBOARD_MOD_ALT		{0x04_u8};
+	constexpr auto KEYBOARD_MOD_CAPS_LOCK	{0x08_u8};
+	constexpr auto KEYBOARD_MOD_NUM_LOCK	{0x10_u8};
+	constexpr auto KEYBOARD_MOD_SCROLL_LOCK	{0x20_u8};
+
+
+	// Decoded key event
+	struct keyboardEvent_t {
+		keyCode_t		key;			// Key code
+		char			ascii;			// Character (0 if none or released)
+		igros_byte_t		modifiers;		// Modifiers after event
+		bool			pressed;		// Pressed or released
+	};
+
+
+	// Read key event (false if none and not blocking)
+	// Only one thread at a time may block
+	[[nodiscard]]
+	auto	keyboardRead(keyboardEvent_t &event, const bool block = true) noexcept -> bool;
 
 	// Setip keyboard function
 	void	keyboardSetup() noexcept;
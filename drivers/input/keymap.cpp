@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////////
+//
+//	Keyboard scan code sets and keymap
+//
+//	File:	keymap.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+// IgrOS-Kernel drivers
+#include <drivers/input/keymap.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// Set 2 codes count (F7 is last)
+	constexpr auto KEYMAP_SET2_SIZE		{0x84_usize};
+	// Set 1 codes with characters count (F12 is last)
+	constexpr auto KEYMAP_SIZE		{0x59_usize};
+
+
+	// Set 2 to set 1 translation (same as 8042 controller does)
+	// Extended codes translate same way, only prefix differs
+	static constexpr std::array<keyCode_t, KEYMAP_SET2_SIZE>	keymapSet2	{
+		0x00_u8, 0x43_u8, 0x00_u8, 0x3F_u8, 0x3D_u8, 0x3B_u8, 0x3C_u8, 0x58_u8,	// 0x00
+		0x00_u8, 0x44_u8, 0x42_u8, 0x40_u8, 0x3E_u8, 0x0F_u8, 0x29_u8, 0x00_u8,	// 0x08
+		0x00_u8, 0x38_u8, 0x2A_u8, 0x00_u8, 0x1D_u8, 0x10_u8, 0x02_u8, 0x00_u8,	// 0x10
+		0x00_u8, 0x00_u8, 0x2C_u8, 0x1F_u8, 0x1E_u8, 0x11_u8, 0x03_u8, 0x5B_u8,	// 0x18
+		0x00_u8, 0x2E_u8, 0x2D_u8, 0x20_u8, 0x12_u8, 0x05_u8, 0x04_u8, 0x5C_u8,	// 0x20
+		0x00_u8, 0x39_u8, 0x2F_u8, 0x21_u8, 0x14_u8, 0x13_u8, 0x06_u8, 0x5D_u8,	// 0x28
+		0x00_u8, 0x31_u8, 0x30_u8, 0x23_u8, 0x22_u8, 0x15_u8, 0x07_u8, 0x00_u8,	// 0x30
+		0x00_u8, 0x00_u8, 0x32_u8, 0x24_u8, 0x16_u8, 0x08_u8, 0x09_u8, 0x00_u8,	// 0x38
+		0x00_u8, 0x33_u8, 0x25_u8, 0x17_u8, 0x18_u8, 0x0B_u8, 0x0A_u8, 0x00_u8,	// 0x40
+		0x00_u8, 0x34_u8, 0x35_u8, 0x26_u8, 0x27_u8, 0x19_u8, 0x0C_u8, 0x00_u8,	// 0x48
+		0x00_u8, 0x00_u8, 0x28_u8, 0x00_u8, 0x1A_u8, 0x0D_u8, 0x00_u8, 0x00_u8,	// 0x50
+		0x3A_u8, 0x36_u8, 0x1C_u8, 0x1B_u8, 0x00_u8, 0x2B_u8, 0x00_u8, 0x00_u8,	// 0x58
+		0x00_u8, 0x56_u8, 0x00_u8, 0x00_u8, 0x00_u8, 0x00_u8, 0x0E_u8, 0x00_u8,	// 0x60
+		0x00_u8, 0x4F_u8, 0x00_u8, 0x4B_u8, 0x47_u8, 0x00_u8, 0x00_u8, 0x00_u8,	// 0x68
+		0x52_u8, 0x53_u8, 0x50_u8, 0x4C_u8, 0x4D_u8, 0x48_u8, 0x01_u8, 0x45_u8,	// 0x70
+		0x57_u8, 0x4E_u8, 0x51_u8, 0x4A_u8, 0x37_u8, 0x49_u8, 0x46_u8, 0x00_u8,	// 0x78
+		0x00_u8, 0x00_u8, 0x00_u8, 0x41_u8	// 0x80
+	};
+
+	// US layout
+	static constexpr std::array<char, KEYMAP_SIZE>			keymapNormal	{
+		'\0', '\x1B', '1', '2', '3', '4', '5', '6',	// 0x00
+		'7', '8', '9', '0', '-', '=', '\b', '\t',	// 0x08
+		'q', 'w', 'e', 'r', 't', 'y', 'u', 'i',	// 0x10
+		'o', 'p', '[', ']', '\n', '\0', 'a', 's',	// 0x18
+		'd', 'f', 'g', 'h', 'j', 'k', 'l', ';',	// 0x20
+		'\'', '`', '\0', '\\', 'z', 'x', 'c', 'v',	// 0x28
+		'b', 'n', 'm', ',', '.', '/', '\0', '*',	// 0x30
+		'\0', ' ', '\0', '\0', '\0', '\0', '\0', '\0',	// 0x38
+		'\0', '\0', '\0', '\0', '\0', '\0', '\0', '7',	// 0x40
+		'8', '9', '-', '4', '5', '6', '+', '1',	// 0x48
+		'2', '3', '0', '.', '\0', '\0', '\\', '\0',	// 0x50
+		'\0'	// 0x58
+	};
+
+	// US layout with shift
+	static constexpr std::array<char, KEYMAP_SIZE>			keymapShift	{
+		'\0', '\x1B', '!', '@', '#', '$', '%', '^',	// 0x00
+		'&', '*', '(', ')', '_', '+', '\b', '\t',	// 0x08
+		'Q', 'W', 'E', 'R', 'T', 'Y', 'U', 'I',	// 0x10
+		'O', 'P', '{', '}', '\n', '\0', 'A', 'S',	// 0x18
+		'D', 'F', 'G', 'H', 'J', 'K', 'L', ':',	// 0x20
+		'"', '~', '\0', '|', 'Z', 'X', 'C', 'V',	// 0x28
+		'B', 'N', 'M', '<', '>', '?', '\0', '*',	// 0x30
+		'\0', ' ', '\0', '\0', '\0', '\0', '\0', '\0',	// 0x38
+		'\0', '\0', '\0', '\0', '\0', '\0', '\0', '7',	// 0x40
+		'8', '9', '-', '4', '5', '6', '+', '1',	// 0x48
+		'2', '3', '0', '.', '\0', '\0', '|', '\0',	// 0x50
+		'\0'	// 0x58
+	};
+
+
+	// Set 2 scan code to set 1 one (0 if unknown)
+	[[nodiscard]]
+	auto keymapFromSet2(const igros_byte_t code) noexcept -> keyCode_t {
+		return (code < KEYMAP_SET2_SIZE) ? keymapSet2[code] : 0_u8;
+	}
+
+	// Key to ASCII with US layout (0 if key has no character)
+	[[nodiscard]]
+	auto keymapToASCII(const keyCode_t key, const bool shift, const bool caps, const bool num) noexcept -> char {
+		// Keypad slash and enter are the only extended keys with characters
+		if (0_u8 != (key & KEY_EXTENDED)) {
+			switch (key & ~KEY_EXTENDED) {
+				case 0x35_u8:
+					return '/';
+				case 0x1C_u8:
+					return '\n';
+				default:
+					return '\0';
+			}
+		}
+		if (key >= KEYMAP_SIZE) {
+			return '\0';
+		}
+		// Keypad digits and dot need num lock
+		if ((key >= 0x47_u8) && (key <= 0x53_u8) && (0x4A_u8 != key) && (0x4E_u8 != key) && !num) {
+			return '\0';
+		}
+		// Caps lock inverts shift for letters only
+		const auto letter {(keymapNormal[key] >= 'a') && (keymapNormal[key] <= 'z')};
+		return ((letter && caps) != shift) ? keymapShift[key] : keymapNormal[key];
+	}
+
+
+}	// namespace igros::arch
+
@@ -0,0 +1,55 @@
+////////////////////////////////////////////////////////////////
+//
+//	Keyboard scan code sets and keymap
+//
+//	File:	keymap.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// Key codes are set 1 make codes, E0 extended ones get highest bit set
+	using keyCode_t			= igros_byte_t;
+
+
+	// Extended key bit
+	constexpr auto KEY_EXTENDED		{static_cast<keyCode_t>(0x80_u8)};
+
+	// Modifier and lock keys
+	constexpr auto KEY_LEFT_CTRL		{static_cast<keyCode_t>(0x1D_u8)};
+	constexpr auto KEY_LEFT_SHIFT		{static_cast<keyCode_t>(0x2A_u8)};
+	constexpr auto KEY_RIGHT_SHIFT		{static_cast<keyCode_t>(0x36_u8)};
+	constexpr auto KEY_LEFT_ALT		{static_cast<keyCode_t>(0x38_u8)};
+	constexpr auto KEY_CAPS_LOCK		{static_cast<keyCode_t>(0x3A_u8)};
+	constexpr auto KEY_NUM_LOCK		{static_cast<keyCode_t>(0x45_u8)};
+	constexpr auto KEY_SCROLL_LOCK		{static_cast<keyCode_t>(0x46_u8)};
+	constexpr auto KEY_RIGHT_CTRL		{static_cast<keyCode_t>(KEY_EXTENDED | KEY_LEFT_CTRL)};
+	constexpr auto KEY_RIGHT_ALT		{static_cast<keyCode_t>(KEY_EXTENDED | KEY_LEFT_ALT)};
+	// Pause (E1 sequence, make only)
+	constexpr auto KEY_PAUSE		{static_cast<keyCode_t>(KEY_EXTENDED | KEY_NUM_LOCK)};
+
+
+	// Set 2 scan code to set 1 one (0 if unknown)
+	[[nodiscard]]
+	auto	keymapFromSet2(const igros_byte_t code) noexcept -> keyCode_t;
+	// Key to ASCII with US layout (0 if key has no character)
+	[[nodiscard]]
+	auto	keymapToASCII(const keyCode_t key, const bool shift, const bool caps, const bool num) noexcept -> char;
+
+
+}	// namespace igros::arch
+
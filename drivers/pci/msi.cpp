@@ -0,0 +1,400 @@
+////////////////////////////////////////////////////////////////
+//
+//	PCI message signalled interrupts
+//
+//	File:	msi.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+#include <bit>
+// IgrOS-Kernel arch
+#include <arch/io.hpp>
+#include <arch/irq.hpp>
+#include <arch/smp.hpp>
+#if	defined (IGROS_ARCH_x86_64)
+#include <arch/x86_64/apic.hpp>
+#include <arch/x86_64/isr.hpp>
+#endif	// IGROS_ARCH_x86_64
+// IgrOS-Kernel drivers
+#include <drivers/pci/msi.hpp>
+#include <drivers/pci/pci.hpp>
+// IgrOS-Kernel library
+#include <klib/kprint.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+#if	defined (IGROS_ARCH_x86_64)
+
+	// MSI message control bits
+	constexpr auto PCI_MSI_ENABLE		{0x0001_u16};
+	constexpr auto PCI_MSI_ENABLED_SHIFT	{4_u32};
+	constexpr auto PCI_MSI_64		{0x0080_u16};
+	constexpr auto PCI_MSI_MASKABLE		{0x0100_u16};
+	// MSI registers (data and mask move by 4 with 64-bit address)
+	constexpr auto PCI_MSI_ADDRESS		{0x04_u16};
+	constexpr auto PCI_MSI_ADDRESS_HIGH	{0x08_u16};
+	constexpr auto PCI_MSI_DATA		{0x08_u16};
+	constexpr auto PCI_MSI_MASK		{0x0C_u16};
+
+	// MSI-X message control bits
+	constexpr auto PCI_MSIX_ENABLE		{0x8000_u16};
+	constexpr auto PCI_MSIX_FUNCTION_MASK	{0x4000_u16};
+	// MSI-X table offset and BAR indicator register
+	constexpr auto PCI_MSIX_TABLE		{0x04_u16};
+	constexpr auto PCI_MSIX_BIR_MASK	{0x00000007_u32};
+	// MSI-X table entry (double words)
+	constexpr auto PCI_MSIX_ENTRY_SIZE	{4_usize};
+	constexpr auto PCI_MSIX_ENTRY_ADDRESS	{0_usize};
+	constexpr auto PCI_MSIX_ENTRY_HIGH	{1_usize};
+	constexpr auto PCI_MSIX_ENTRY_DATA	{2_usize};
+	constexpr auto PCI_MSIX_ENTRY_CONTROL	{3_usize};
+	constexpr auto PCI_MSIX_ENTRY_MASKED	{0x00000001_u32};
+	// MSI-X table must lie in identity mapped first 4Gb
+	constexpr auto PCI_MSIX_MAPPED_END	{0x100000000_u64};
+
+	// Message address (local APIC, destination ID in bits 12 - 19)
+	constexpr auto PCI_MSI_ADDRESS_BASE	{0xFEE00000_u32};
+
+
+	// Message address of CPU (fixed delivery, physical destination)
+	[[nodiscard]]
+	static auto pciMsiAddress(const igros_usize_t cpu) noexcept -> igros_dword_t {
+		return PCI_MSI_ADDRESS_BASE | (x86_64::smp::apicID(cpu) << 12);
+	}
+
+	// Default message destination (CPU N, or round robin over online CPUs)
+	[[nodiscard]]
+	static auto pciMsiDefaultCPU(const igros_usize_t index) noexcept -> igros_usize_t {
+		if ((index < x86_64::smp::MAX_CPUS) && x86_64::smp::isOnline(index)) {
+			return index;
+		}
+		const auto online	{x86_64::smp::online()};
+		auto count		{0_usize};
+		for (auto cpu {0_usize}; cpu < x86_64::smp::MAX_CPUS; cpu++) {
+			count += static_cast<igros_usize_t>((online >> cpu) & 1_u64);
+		}
+		// Bootstrap processor is always online
+		auto nth {index % count};
+		for (auto cpu {0_usize}; cpu < x86_64::smp::MAX_CPUS; cpu++) {
+			if (0_u64 != ((online >> cpu) & 1_u64)) {
+				if (0_usize == nth--) {
+					return cpu;
+				}
+			}
+		}
+		return 0_usize;
+	}
+
+	// MSI register offset (data and mask follow 64-bit address)
+	[[nodiscard]]
+	static auto pciMsiReg(const pciMsi_t &msi, const igros_word_t reg) noexcept -> igros_word_t {
+		const auto wide {0_u16 != (pciRead16(*msi.dev, static_cast<igros_word_t>(msi.dev->msi + PCI_MSI_CONTROL)) & PCI_MSI_64)};
+		return static_cast<igros_word_t>(msi.dev->msi + reg + (wide ? 4_u16 : 0_u16));
+	}
+
+	// MSI-X table entry
+	[[nodiscard]]
+	static auto pciMsixEntry(const pciMsi_t &msi, const igros_usize_t index) noexcept -> igros_dword_t* {
+		return msi.table + index * PCI_MSIX_ENTRY_SIZE;
+	}
+
+	// Set MSI-X entry mask bit (read back flushes posted write)
+	static void pciMsixSetMask(const pciMsi_t &msi, const igros_usize_t index, const bool masked) noexcept {
+		const auto control	{pciMsixEntry(msi, index) + PCI_MSIX_ENTRY_CONTROL};
+		const auto value	{io::get().readMemory32(control)};
+		io::get().writeMemory32(control, masked ? (value | PCI_MSIX_ENTRY_MASKED) : (value & ~PCI_MSIX_ENTRY_MASKED));
+		static_cast<void>(io::get().readMemory32(control));
+	}
+
+	// Write MSI-X entry message (entry masked)
+	static void pciMsixWrite(const pciMsi_t &msi, const igros_usize_t index) noexcept {
+		const auto entry {pciMsixEntry(msi, index)};
+		io::get().writeMemory32(entry + PCI_MSIX_ENTRY_ADDRESS, pciMsiAddress(msi.cpus[index]));
+		io::get().writeMemory32(entry + PCI_MSIX_ENTRY_HIGH, 0_u32);
+		io::get().writeMemory32(entry + PCI_MSIX_ENTRY_DATA, msi.vectors[index]);
+	}
+
+
+	// Remove handlers and free vectors of first messages
+	static void pciMsiRelease(pciMsi_t &msi, const igros_usize_t count) noexcept {
+		for (auto i {0_usize}; i < count; i++) {
+			x86_64::isrHandlerRemove(msi.vectors[i], msi.handler, msi.cookies[i]);
+		}
+		// Plain MSI block was allocated at once
+		if (nullptr == msi.table) {
+			x86_64::isrVectorFree(msi.vectors[0], count);
+			return;
+		}
+		for (auto i {0_usize}; i < count; i++) {
+			x86_64::isrVectorFree(msi.vectors[i], 1_usize);
+		}
+	}
+
+	// Install handler of every message (returns messages installed)
+	[[nodiscard]]
+	static auto pciMsiInstall(pciMsi_t &msi, const igros_usize_t count) noexcept -> igros_usize_t {
+		for (auto i {0_usize}; i < count; i++) {
+			if (!x86_64::isrHandlerAdd(msi.vectors[i], msi.handler, msi.cookies[i])) [[unlikely]] {
+				return i;
+			}
+		}
+		return count;
+	}
+
+
+	// Enable MSI-X (returns messages enabled)
+	[[nodiscard]]
+	static auto pciMsixEnable(pciDevice_t &dev, pciMsi_t &msi, const igros_usize_t wanted) noexcept -> igros_usize_t {
+		// Table lies in memory BAR
+		const auto location	{pciRead32(dev, static_cast<igros_word_t>(dev.msix + PCI_MSIX_TABLE))};
+		const auto bir		{static_cast<igros_usize_t>(location & PCI_MSIX_BIR_MASK)};
+		if ((bir >= PCI_BARS_MAX) || pciBARIsIO(dev, bir) || (0_u64 == pciBAR(dev, bir))) [[unlikely]] {
+			return 0_usize;
+		}
+		const auto address	{pciBAR(dev, bir) + (location & ~PCI_MSIX_BIR_MASK)};
+		if ((address + dev.msixVectors * PCI_MSIX_ENTRY_SIZE * sizeof(igros_dword_t)) > PCI_MSIX_MAPPED_END) [[unlikely]] {
+			klib::kprintf("PCI:\t\tMSI-X table at 0x%p is not mapped\n", static_cast<igros_usize_t>(address));
+			return 0_usize;
+		}
+		msi.table		= std::bit_cast<igros_dword_t*>(static_cast<igros_usize_t>(address));
+		// Vector per entry
+		auto count {0_usize};
+		for (; count < wanted; count++) {
+			const auto vector {x86_64::isrVectorAlloc(1_usize)};
+			if (x86_64::ISR_VECTOR_NONE == vector) [[unlikely]] {
+				break;
+			}
+			msi.vectors[count]	= static_cast<igros_byte_t>(vector);
+			msi.cpus[count]		= static_cast<igros_byte_t>(pciMsiDefaultCPU(count));
+		}
+		if (const auto installed {pciMsiInstall(msi, count)}; installed != count) [[unlikely]] {
+			for (auto i {installed}; i < count; i++) {
+				x86_64::isrVectorFree(msi.vectors[i], 1_usize);
+			}
+			count = installed;
+		}
+		if (0_usize == count) [[unlikely]] {
+			return 0_usize;
+		}
+		// Program table with whole function masked, unused entries stay masked
+		pciEnable(dev, PCI_COMMAND_MEMORY);
+		const auto control {static_cast<igros_word_t>(dev.msix + PCI_MSI_CONTROL)};
+		pciWrite16(dev, control, static_cast<igros_word_t>(pciRead16(dev, control) | PCI_MSIX_ENABLE | PCI_MSIX_FUNCTION_MASK));
+		for (auto i {0_usize}; i < dev.msixVectors; i++) {
+			pciMsixSetMask(msi, i, true);
+		}
+		for (auto i {0_usize}; i < count; i++) {
+			pciMsixWrite(msi, i);
+			pciMsixSetMask(msi, i, false);
+		}
+		pciWrite16(dev, control, static_cast<igros_word_t>(pciRead16(dev, control) & ~PCI_MSIX_FUNCTION_MASK));
+		return count;
+	}
+
+	// Enable MSI (returns messages enabled)
+	[[nodiscard]]
+	static auto pciMsiBlockEnable(pciDevice_t &dev, pciMsi_t &msi, const igros_usize_t wanted) noexcept -> igros_usize_t {
+		// Power of two block, shrink till vectors are found
+		auto count	{1_usize};
+		auto order	{0_u32};
+		while (((count << 1) <= wanted) && ((count << 1) <= dev.msiVectors)) {
+			count <<= 1;
+			order++;
+		}
+		auto first {x86_64::ISR_VECTOR_NONE};
+		for (; 0_usize != count; count >>= 1, order--) {
+			if (first = x86_64::isrVectorAlloc(count); x86_64::ISR_VECTOR_NONE != first) {
+				break;
+			}
+		}
+		if (0_usize == count) [[unlikely]] {
+			return 0_usize;
+		}
+		// Messages share destination
+		for (auto i {0_usize}; i < count; i++) {
+			msi.vectors[i]	= static_cast<igros_byte_t>(first + i);
+			msi.cpus[i]	= static_cast<igros_byte_t>(pciMsiDefaultCPU(0_usize));
+		}
+		msi.table = nullptr;
+		if (const auto installed {pciMsiInstall(msi, count)}; installed != count) [[unlikely]] {
+			for (auto i {0_usize}; i < installed; i++) {
+				x86_64::isrHandlerRemove(msi.vectors[i], msi.handler, msi.cookies[i]);
+			}
+			x86_64::isrVectorFree(first, count);
+			return 0_usize;
+		}
+		// Device puts message number in low data bits
+		pciWrite32(dev, static_cast<igros_word_t>(dev.msi + PCI_MSI_ADDRESS), pciMsiAddress(msi.cpus[0]));
+		const auto control {static_cast<igros_word_t>(dev.msi + PCI_MSI_CONTROL)};
+		if (0_u16 != (pciRead16(dev, control) & PCI_MSI_64)) {
+			pciWrite32(dev, static_cast<igros_word_t>(dev.msi + PCI_MSI_ADDRESS_HIGH), 0_u32);
+		}
+		pciWrite16(dev, pciMsiReg(msi, PCI_MSI_DATA), static_cast<igros_word_t>(first));
+		if (0_u16 != (pciRead16(dev, control) & PCI_MSI_MASKABLE)) {
+			pciWrite32(dev, pciMsiReg(msi, PCI_MSI_MASK), 0_u32);
+		}
+		const auto enabled {static_cast<igros_word_t>(pciRead16(dev, control) & ~(PCI_MSI_MULTIPLE_MASK << PCI_MSI_ENABLED_SHIFT))};
+		pciWrite16(dev, control, static_cast<igros_word_t>(enabled | (order << PCI_MSI_ENABLED_SHIFT) | PCI_MSI_ENABLE));
+		return count;
+	}
+
+
+	// Enable up to count messages, each with own handler cookie (MSI-X preferred, 0 if none enabled)
+	[[nodiscard]]
+	auto pciMsiEnable(pciDevice_t &dev, pciMsi_t &msi, const igros_usize_t count, const irq::handler_t handler, const igros_pointer_t* const cookies) noexcept -> igros_usize_t {
+		msi.dev		= &dev;
+		msi.table	= nullptr;
+		msi.count	= 0_usize;
+		msi.handler	= handler;
+		if (!x86_64::apic::isAvailable() || (0_usize == count) || (nullptr == handler)) [[unlikely]] {
+			return 0_usize;
+		}
+		const auto wanted {(count < PCI_MSI_VECTORS_MAX) ? count : PCI_MSI_VECTORS_MAX};
+		for (auto i {0_usize}; i < wanted; i++) {
+			msi.cookies[i] = cookies[i];
+		}
+		if (0_u16 != dev.msix) {
+			msi.count = pciMsixEnable(dev, msi, (wanted < dev.msixVectors) ? wanted : dev.msixVectors);
+		}
+		if ((0_usize == msi.count) && (0_u16 != dev.msi)) {
+			msi.count = pciMsiBlockEnable(dev, msi, wanted);
+		}
+		if (0_usize == msi.count) {
+			return 0_usize;
+		}
+		// Legacy line is not used anymore
+		pciEnable(dev, PCI_COMMAND_INTX_OFF);
+		klib::kprintf(
+			"PCI:\t\t%d:%d:%d.%d %z %s vector(s) from 0x%x\n",
+			dev.segment, dev.bus, dev.slot, dev.function,
+			msi.count,
+			(nullptr != msi.table) ? "MSI-X" : "MSI",
+			msi.vectors[0]
+		);
+		return msi.count;
+	}
+
+	// Disable messages (function is back on legacy line)
+	void pciMsiDisable(pciMsi_t &msi) noexcept {
+		if (0_usize == msi.count) {
+			return;
+		}
+		auto &dev {*msi.dev};
+		if (nullptr != msi.table) {
+			for (auto i {0_usize}; i < msi.count; i++) {
+				pciMsixSetMask(msi, i, true);
+			}
+			const auto control {static_cast<igros_word_t>(dev.msix + PCI_MSI_CONTROL)};
+			pciWrite16(dev, control, static_cast<igros_word_t>(pciRead16(dev, control) & ~PCI_MSIX_ENABLE));
+		} else {
+			const auto control {static_cast<igros_word_t>(dev.msi + PCI_MSI_CONTROL)};
+			pciWrite16(dev, control, static_cast<igros_word_t>(pciRead16(dev, control) & ~PCI_MSI_ENABLE));
+		}
+		pciWrite16(dev, PCI_COMMAND, static_cast<igros_word_t>(pciRead16(dev, PCI_COMMAND) & ~PCI_COMMAND_INTX_OFF));
+		// Messages in flight are handled before vectors go away
+		pciMsiRelease(msi, msi.count);
+		msi.count = 0_usize;
+	}
+
+
+	// Mask message (false if function can not)
+	[[nodiscard]]
+	auto pciMsiMask(const pciMsi_t &msi, const igros_usize_t index) noexcept -> bool {
+		if (index >= msi.count) [[unlikely]] {
+			return false;
+		}
+		if (nullptr != msi.table) {
+			pciMsixSetMask(msi, index, true);
+			return true;
+		}
+		if (0_u16 == (pciRead16(*msi.dev, static_cast<igros_word_t>(msi.dev->msi + PCI_MSI_CONTROL)) & PCI_MSI_MASKABLE)) {
+			return false;
+		}
+		const auto reg {pciMsiReg(msi, PCI_MSI_MASK)};
+		pciWrite32(*msi.dev, reg, pciRead32(*msi.dev, reg) | (1_u32 << index));
+		return true;
+	}
+
+	// Unmask message
+	void pciMsiUnmask(const pciMsi_t &msi, const igros_usize_t index) noexcept {
+		if (index >= msi.count) [[unlikely]] {
+			return;
+		}
+		if (nullptr != msi.table) {
+			pciMsixSetMask(msi, index, false);
+			return;
+		}
+		if (0_u16 != (pciRead16(*msi.dev, static_cast<igros_word_t>(msi.dev->msi + PCI_MSI_CONTROL)) & PCI_MSI_MASKABLE)) {
+			const auto reg {pciMsiReg(msi, PCI_MSI_MASK)};
+			pciWrite32(*msi.dev, reg, pciRead32(*msi.dev, reg) & ~(1_u32 << index));
+		}
+	}
+
+	// Route message to CPU (plain MSI moves all messages, false if CPU is offline)
+	[[nodiscard]]
+	auto pciMsiSetAffinity(pciMsi_t &msi, const igros_usize_t index, const igros_usize_t cpu) noexcept -> bool {
+		if ((index >= msi.count) || (cpu >= x86_64::smp::MAX_CPUS) || !x86_64::smp::isOnline(cpu)) [[unlikely]] {
+			return false;
+		}
+		// Entry is rewritten masked, pending message is sent after unmask
+		if (nullptr != msi.table) {
+			const auto masked {0_u32 != (io::get().readMemory32(pciMsixEntry(msi, index) + PCI_MSIX_ENTRY_CONTROL) & PCI_MSIX_ENTRY_MASKED)};
+			pciMsixSetMask(msi, index, true);
+			msi.cpus[index] = static_cast<igros_byte_t>(cpu);
+			pciMsixWrite(msi, index);
+			pciMsixSetMask(msi, index, masked);
+			return true;
+		}
+		// Single address register, written at once
+		for (auto i {0_usize}; i < msi.count; i++) {
+			msi.cpus[i] = static_cast<igros_byte_t>(cpu);
+		}
+		pciWrite32(*msi.dev, static_cast<igros_word_t>(msi.dev->msi + PCI_MSI_ADDRESS), pciMsiAddress(cpu));
+		return true;
+	}
+
+#else
+
+	// No local APIC support - no message delivery
+	[[nodiscard]]
+	auto pciMsiEnable(pciDevice_t &dev, pciMsi_t &msi, [[maybe_unused]] const igros_usize_t count, const irq::handler_t handler, [[maybe_unused]] const igros_pointer_t* const cookies) noexcept -> igros_usize_t {
+		msi.dev		= &dev;
+		msi.table	= nullptr;
+		msi.count	= 0_usize;
+		msi.handler	= handler;
+		return 0_usize;
+	}
+
+	// No local APIC support - nothing enabled
+	void pciMsiDisable([[maybe_unused]] pciMsi_t &msi) noexcept {}
+
+	// No local APIC support - nothing to mask
+	[[nodiscard]]
+	auto pciMsiMask([[maybe_unused]] const pciMsi_t &msi, [[maybe_unused]] const igros_usize_t index) noexcept -> bool {
+		return false;
+	}
+
+	// No local APIC support - nothing to unmask
+	void pciMsiUnmask([[maybe_unused]] const pciMsi_t &msi, [[maybe_unused]] const igros_usize_t index) noexcept {}
+
+	// No local APIC support - nothing to route
+	[[nodiscard]]
+	auto pciMsiSetAffinity([[maybe_unused]] pciMsi_t &msi, [[maybe_unused]] const igros_usize_t index, [[maybe_unused]] const igros_usize_t cpu) noexcept -> bool {
+		return false;
+	}
+
+#endif	// IGROS_ARCH_x86_64
+
+
+}	// namespace igros::arch
+
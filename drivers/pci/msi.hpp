@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////
+//
+//	PCI message signalled interrupts
+//
+//	File:	msi.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <array>
+// IgrOS-Kernel arch
+#include <arch/irq.hpp>
+#include <arch/types.hpp>
+// IgrOS-Kernel drivers
+#include <drivers/pci/pci.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// PCI MSI and MSI-X
+	//
+	// Message is memory write of vector to local APIC of chosen CPU, so each
+	// function gets own vectors instead of sharing one of 16 legacy lines and
+	// multi-queue device can complete every queue on CPU submitting to it.
+	// Vectors come from IDT range between legacy PIC IRQs and HPET/APIC ones.
+	// MSI-X is preferred: every table entry has own vector, destination and
+	// mask bit. Plain MSI gets aligned block of vectors sharing destination
+	// and can be masked per vector only if function supports it. Message N
+	// is routed to CPU N by default (block layer submits from CPU N to queue
+	// N modulo queues count), or round robin over online CPUs. Without local
+	// APIC (i386 build) nothing is enabled and drivers stay on legacy line
+
+
+	// Max message vectors of function
+	constexpr auto PCI_MSI_VECTORS_MAX	{32_usize};
+
+
+	// Message signalled interrupts of function
+	struct pciMsi_t {
+		pciDevice_t*						dev;		// Function
+		igros_dword_t*						table;		// MSI-X table (nullptr - plain MSI)
+		igros_usize_t						count;		// Messages enabled (0 - legacy line)
+		irq::handler_t						handler;	// Messages handler
+		std::array<igros_pointer_t, PCI_MSI_VECTORS_MAX>	cookies;	// Handler cookie per message
+		std::array<igros_byte_t, PCI_MSI_VECTORS_MAX>		vectors;	// Vector per message
+		std::array<igros_byte_t, PCI_MSI_VECTORS_MAX>		cpus;		// Destination CPU per message
+	};
+
+
+	// Enable up to count messages, each with own handler cookie (MSI-X preferred, 0 if none enabled)
+	[[nodiscard]]
+	auto	pciMsiEnable(pciDevice_t &dev, pciMsi_t &msi, const igros_usize_t count, const irq::handler_t handler, const igros_pointer_t* const cookies) noexcept -> igros_usize_t;
+	// Disable messages (function is back on legacy line)
+	void	pciMsiDisable(pciMsi_t &msi) noexcept;
+
+	// Mask message (false if function can not)
+	[[nodiscard]]
+	auto	pciMsiMask(const pciMsi_t &msi, const igros_usize_t index) noexcept -> bool;
+	// Unmask message
+	void	pciMsiUnmask(const pciMsi_t &msi, const igros_usize_t index) noexcept;
+	// Route message to CPU (plain MSI moves all messages, false if CPU is offline)
+	[[nodiscard]]
+	auto	pciMsiSetAffinity(pciMsi_t &msi, const igros_usize_t index, const igros_usize_t cpu) noexcept -> bool;
+
+
+}	// namespace igros::arch
+
@@ -0,0 +1,514 @@
+////////////////////////////////////////////////////////////////
+//
+//	PCI bus
+//
+//	File:	pci.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+#include <bit>
+// IgrOS-Kernel arch
+#include <arch/io.hpp>
+// IgrOS-Kernel drivers
+#include <drivers/acpi/acpi.hpp>
+#include <drivers/pci/pci.hpp>
+// IgrOS-Kernel library
+#include <klib/kLock.hpp>
+#include <klib/kprint.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// Configuration address and data ports
+	constexpr auto PCI_CONFIG_ADDRESS	{static_cast<io::port_t>(0x0CF8_u16)};
+	constexpr auto PCI_CONFIG_DATA		{static_cast<io::port_t>(0x0CFC_u16)};
+	// Configuration access enable bit
+	constexpr auto PCI_CONFIG_ENABLE	{0x80000000_u32};
+	// Legacy configuration space size
+	constexpr auto PCI_CONFIG_SIZE		{0x0100_u16};
+	// Extended (ECAM) configuration space size
+	constexpr auto PCI_ECAM_CONFIG_SIZE	{0x1000_u16};
+	// Max ECAM windows
+	constexpr auto PCI_ECAM_MAX		{4_usize};
+
+	// Devices and functions count
+	constexpr auto PCI_SLOTS		{32_u32};
+	constexpr auto PCI_FUNCTIONS		{8_u32};
+	// Header types
+	constexpr auto PCI_HEADER_MULTI		{0x80_u8};
+	constexpr auto PCI_HEADER_DEVICE	{0x00_u8};
+	constexpr auto PCI_HEADER_BRIDGE	{0x01_u8};
+	// BARs count of PCI-to-PCI bridge
+	constexpr auto PCI_BRIDGE_BARS		{2_usize};
+	// Status register: capabilities list present
+	constexpr auto PCI_STATUS_CAP_LIST	{0x0010_u16};
+	// Max capabilities walked (list loops are not followed forever)
+	constexpr auto PCI_CAP_MAX		{48_usize};
+
+	// BAR bits
+	constexpr auto PCI_BAR_IO		{0x00000001_u32};
+	constexpr auto PCI_BAR_IO_MASK		{0xFFFFFFFC_u32};
+	constexpr auto PCI_BAR_MEM_MASK		{0xFFFFFFF0_u32};
+	constexpr auto PCI_BAR_MEM_TYPE		{0x00000006_u32};
+	constexpr auto PCI_BAR_MEM_64		{0x00000004_u32};
+	constexpr auto PCI_BAR_MEM_PREFETCH	{0x00000008_u32};
+
+#if	defined (IGROS_ARCH_i386)
+	// Kernel image and heap virtual offset (3Gb -> 0)
+	constexpr auto PCI_KERNEL_VIRT		{0xC0000000_usize};
+	// Identity mapped devices window (4Gb - 32Mb)
+	constexpr auto PCI_KERNEL_VIRT_END	{0xFE000000_usize};
+	// ECAM must lie in identity mapped low memory or devices window
+	constexpr auto PCI_ECAM_LOW_END		{0xC0000000_u64};
+	constexpr auto PCI_ECAM_HIGH_START	{0xFE000000_u64};
+#elif	defined (IGROS_ARCH_x86_64)
+	// Kernel image and heap virtual offset (-2Gb -> 0)
+	constexpr auto PCI_KERNEL_VIRT		{0xFFFFFFFF80000000_usize};
+	// End of address space
+	constexpr auto PCI_KERNEL_VIRT_END	{0xFFFFFFFFFFFFFFFF_usize};
+	// ECAM must lie in identity mapped first 4Gb
+	constexpr auto PCI_ECAM_LOW_END		{0x100000000_u64};
+	constexpr auto PCI_ECAM_HIGH_START	{0x100000000_u64};
+#else
+	static_assert(false, u8"Unknown architecture!!!");
+#endif
+	// End of 32-bit address space
+	constexpr auto PCI_ECAM_HIGH_END	{0x100000000_u64};
+
+
+	// ECAM window (one segment bus range)
+	struct pciECAM_t {
+		igros_byte_t*		base;			// Configuration space of start bus
+		igros_word_t		segment;		// Segment group
+		igros_byte_t		busStart;		// First bus
+		igros_byte_t		busEnd;			// Last bus
+	};
+
+
+	// Found functions
+	static std::array<pciDevice_t, PCI_DEVICES_MAX>	pciDevices	{};
+	// Found functions count
+	static igros_usize_t				pciCount	{0_usize};
+	// ECAM windows
+	static std::array<pciECAM_t, PCI_ECAM_MAX>	pciWindows	{};
+	// ECAM windows count
+	static igros_usize_t				pciWindowCount	{0_usize};
+	// Registered drivers
+	static pciDriver_t*				pciDrivers	{nullptr};
+	// Configuration ports lock (address and data accesses go in pairs)
+	static klib::kSpinlock<>			pciConfigLock	{};
+	// Drivers list lock
+	static klib::kSpinlock<>			pciDriverLock	{};
+
+
+	// Function at address (configuration space located, rest is empty)
+	[[nodiscard]]
+	static auto pciLocate(const igros_word_t segment, const igros_dword_t bus, const igros_dword_t slot, const igros_dword_t function) noexcept -> pciDevice_t {
+		pciDevice_t dev {};
+		dev.segment	= segment;
+		dev.bus		= static_cast<igros_byte_t>(bus);
+		dev.slot	= static_cast<igros_byte_t>(slot);
+		dev.function	= static_cast<igros_byte_t>(function);
+		dev.irq		= PCI_IRQ_NONE;
+		for (auto i {0_usize}; i < pciWindowCount; i++) {
+			const auto &window {pciWindows[i]};
+			if ((window.segment == segment) && (bus >= window.busStart) && (bus <= window.busEnd)) {
+				dev.config = window.base + (((bus - window.busStart) << 20) | (slot << 15) | (function << 12));
+				break;
+			}
+		}
+		return dev;
+	}
+
+	// Check if register is reachable
+	[[nodiscard]]
+	static auto pciReachable(const pciDevice_t &dev, const igros_word_t offset) noexcept -> bool {
+		return (nullptr != dev.config) ? (offset < PCI_ECAM_CONFIG_SIZE) : ((0_u16 == dev.segment) && (offset < PCI_CONFIG_SIZE));
+	}
+
+	// Select configuration register (config lock held)
+	static void pciSelect(const pciDevice_t &dev, const igros_word_t offset) noexcept {
+		io::get().writePort32(
+			PCI_CONFIG_ADDRESS,
+			PCI_CONFIG_ENABLE							|
+			(static_cast<igros_dword_t>(dev.bus) << 16)				|
+			(static_cast<igros_dword_t>(dev.slot) << 11)				|
+			(static_cast<igros_dword_t>(dev.function) << 8)				|
+			(static_cast<igros_dword_t>(offset) & 0xFC_u32)
+		);
+	}
+
+	// Data port of register byte lane
+	[[nodiscard]]
+	static auto pciDataPort(const igros_word_t offset) noexcept -> io::port_t {
+		return static_cast<io::port_t>(PCI_CONFIG_DATA + (offset & 0x03_u16));
+	}
+
+
+	// Read configuration space byte
+	[[nodiscard]]
+	auto pciRead8(const pciDevice_t &dev, const igros_word_t offset) noexcept -> igros_byte_t {
+		if (!pciReachable(dev, offset)) [[unlikely]] {
+			return 0xFF_u8;
+		}
+		if (nullptr != dev.config) [[likely]] {
+			return io::get().readMemory8(dev.config + offset);
+		}
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {pciConfigLock};
+		pciSelect(dev, offset);
+		return io::get().readPort8(pciDataPort(offset));
+	}
+
+	// Read configuration space word
+	[[nodiscard]]
+	auto pciRead16(const pciDevice_t &dev, const igros_word_t offset) noexcept -> igros_word_t {
+		if (!pciReachable(dev, offset)) [[unlikely]] {
+			return 0xFFFF_u16;
+		}
+		if (nullptr != dev.config) [[likely]] {
+			return io::get().readMemory16(std::bit_cast<const igros_word_t*>(dev.config + offset));
+		}
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {pciConfigLock};
+		pciSelect(dev, offset);
+		return io::get().readPort16(pciDataPort(offset));
+	}
+
+	// Read configuration space double word
+	[[nodiscard]]
+	auto pciRead32(const pciDevice_t &dev, const igros_word_t offset) noexcept -> igros_dword_t {
+		if (!pciReachable(dev, offset)) [[unlikely]] {
+			return 0xFFFFFFFF_u32;
+		}
+		if (nullptr != dev.config) [[likely]] {
+			return io::get().readMemory32(std::bit_cast<const igros_dword_t*>(dev.config + offset));
+		}
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {pciConfigLock};
+		pciSelect(dev, offset);
+		return io::get().readPort32(PCI_CONFIG_DATA);
+	}
+
+	// Write configuration space byte
+	void pciWrite8(const pciDevice_t &dev, const igros_word_t offset, const igros_byte_t value) noexcept {
+		if (!pciReachable(dev, offset)) [[unlikely]] {
+			return;
+		}
+		if (nullptr != dev.config) [[likely]] {
+			io::get().writeMemory8(dev.config + offset, value);
+			return;
+		}
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {pciConfigLock};
+		pciSelect(dev, offset);
+		io::get().writePort8(pciDataPort(offset), value);
+	}
+
+	// Write configuration space word (only own byte lanes, status bits are write-one-to-clear)
+	void pciWrite16(const pciDevice_t &dev, const igros_word_t offset, const igros_word_t value) noexcept {
+		if (!pciReachable(dev, offset)) [[unlikely]] {
+			return;
+		}
+		if (nullptr != dev.config) [[likely]] {
+			io::get().writeMemory16(std::bit_cast<igros_word_t*>(dev.config + offset), value);
+			return;
+		}
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {pciConfigLock};
+		pciSelect(dev, offset);
+		io::get().writePort16(pciDataPort(offset), value);
+	}
+
+	// Write configuration space double word
+	void pciWrite32(const pciDevice_t &dev, const igros_word_t offset, const igros_dword_t value) noexcept {
+		if (!pciReachable(dev, offset)) [[unlikely]] {
+			return;
+		}
+		if (nullptr != dev.config) [[likely]] {
+			io::get().writeMemory32(std::bit_cast<igros_dword_t*>(dev.config + offset), value);
+			return;
+		}
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {pciConfigLock};
+		pciSelect(dev, offset);
+		io::get().writePort32(PCI_CONFIG_DATA, value);
+	}
+
+
+	// BAR address (I/O port or memory, 0 if not present)
+	[[nodiscard]]
+	auto pciBAR(const pciDevice_t &dev, const igros_usize_t index) noexcept -> igros_quad_t {
+		return (index < PCI_BARS_MAX) ? dev.bars[index].address : 0_u64;
+	}
+
+	// BAR size (0 if not present)
+	[[nodiscard]]
+	auto pciBARSize(const pciDevice_t &dev, const igros_usize_t index) noexcept -> igros_quad_t {
+		return (index < PCI_BARS_MAX) ? dev.bars[index].size : 0_u64;
+	}
+
+	// Check if BAR is I/O ports
+	[[nodiscard]]
+	auto pciBARIsIO(const pciDevice_t &dev, const igros_usize_t index) noexcept -> bool {
+		return (index < PCI_BARS_MAX) && (0_usize != dev.bars[index].size) && (0_u8 != (dev.bars[index].flags & PCI_BAR_FLAG_IO));
+	}
+
+	// Find capability (offset, 0 if none)
+	[[nodiscard]]
+	auto pciFindCapability(const pciDevice_t &dev, const igros_byte_t id, const igros_word_t from) noexcept -> igros_word_t {
+		if (0_u16 == (pciRead16(dev, PCI_STATUS) & PCI_STATUS_CAP_LIST)) {
+			return 0_u16;
+		}
+		// Continue after given capability or start from list head
+		auto offset {static_cast<igros_word_t>(pciRead8(dev, (0_u16 != from) ? static_cast<igros_word_t>(from + 1_u16) : PCI_CAPABILITIES) & 0xFC_u8)};
+		for (auto i {0_usize}; (i < PCI_CAP_MAX) && (offset >= 0x40_u16); i++) {
+			if (id == pciRead8(dev, offset)) {
+				return offset;
+			}
+			offset = static_cast<igros_word_t>(pciRead8(dev, static_cast<igros_word_t>(offset + 1_u16)) & 0xFC_u8);
+		}
+		return 0_u16;
+	}
+
+	// Set command register bits
+	void pciEnable(const pciDevice_t &dev, const igros_word_t command) noexcept {
+		pciWrite16(dev, PCI_COMMAND, pciRead16(dev, PCI_COMMAND) | command);
+	}
+
+
+	// Bus address of kernel memory (DMA)
+	[[nodiscard]]
+	auto pciBusAddress(const void* const addr) noexcept -> igros_quad_t {
+		const auto virt {std::bit_cast<igros_usize_t>(addr)};
+		// Kernel image and pages heap are mapped at offset, rest is identity mapped
+		if ((virt >= PCI_KERNEL_VIRT) && (virt < PCI_KERNEL_VIRT_END)) {
+			return virt - PCI_KERNEL_VIRT;
+		}
+		return virt;
+	}
+
+
+	// Check if driver serves function
+	[[nodiscard]]
+	static auto pciMatch(const pciDriver_t &driver, const pciDevice_t &dev) noexcept -> bool {
+		return
+			((PCI_ANY_ID == driver.vendor) || (dev.vendor == driver.vendor))		&&
+			((PCI_ANY_ID == driver.device) || (dev.device == driver.device))		&&
+			((PCI_ANY_CLASS == driver.classCode) || (dev.classCode == driver.classCode))	&&
+			((PCI_ANY_CLASS == driver.subclass) || (dev.subclass == driver.subclass));
+	}
+
+	// Offer free functions to driver
+	static void pciProbe(const pciDriver_t &driver) noexcept {
+		for (auto i {0_usize}; i < pciCount; i++) {
+			auto &dev {pciDevices[i]};
+			if ((nullptr == dev.driver) && pciMatch(driver, dev) && driver.probe(dev)) {
+				dev.driver = &driver;
+				klib::kprintf("PCI:\t\t%d:%d:%d.%d bound to %s\n", dev.segment, dev.bus, dev.slot, dev.function, driver.name);
+			}
+		}
+	}
+
+	// Register driver (probes matching functions)
+	void pciRegisterDriver(pciDriver_t &driver) noexcept {
+		if (nullptr == driver.probe) [[unlikely]] {
+			return;
+		}
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {pciDriverLock};
+			driver.next	= pciDrivers;
+			pciDrivers	= &driver;
+		}
+		// Probes may sleep and allocate (boot time, table is stable)
+		pciProbe(driver);
+	}
+
+
+	// Decode BARs (sized with decoding off, nothing else touches function yet)
+	static void pciDecodeBARs(pciDevice_t &dev) noexcept {
+		const auto count	{(PCI_HEADER_DEVICE == dev.header) ? PCI_BARS_MAX : ((PCI_HEADER_BRIDGE == dev.header) ? PCI_BRIDGE_BARS : 0_usize)};
+		const auto command	{pciRead16(dev, PCI_COMMAND)};
+		pciWrite16(dev, PCI_COMMAND, command & static_cast<igros_word_t>(~(PCI_COMMAND_IO | PCI_COMMAND_MEMORY)));
+		for (auto i {0_usize}; i < count; i++) {
+			const auto offset	{static_cast<igros_word_t>(PCI_BAR0 + (i << 2))};
+			const auto value	{pciRead32(dev, offset)};
+			pciWrite32(dev, offset, 0xFFFFFFFF_u32);
+			const auto mask		{pciRead32(dev, offset)};
+			pciWrite32(dev, offset, value);
+			auto &bar		{dev.bars[i]};
+			// I/O ports (upper half may be hardwired to zero)
+			if (0_u32 != (value & PCI_BAR_IO)) {
+				bar.address	= value & PCI_BAR_IO_MASK;
+				bar.size	= (~(mask & PCI_BAR_IO_MASK) + 1_u32) & 0xFFFF_u32;
+				bar.flags	= PCI_BAR_FLAG_IO;
+				continue;
+			}
+			bar.address	= value & PCI_BAR_MEM_MASK;
+			bar.flags	= (0_u32 != (value & PCI_BAR_MEM_PREFETCH)) ? PCI_BAR_FLAG_PREFETCH : 0_u8;
+			auto sizeMask	{static_cast<igros_quad_t>(mask & PCI_BAR_MEM_MASK) | 0xFFFFFFFF00000000_u64};
+			// 64-bit memory takes next BAR too
+			if ((PCI_BAR_MEM_64 == (value & PCI_BAR_MEM_TYPE)) && ((i + 1_usize) < count)) {
+				const auto next		{static_cast<igros_word_t>(offset + 4_u16)};
+				const auto high		{pciRead32(dev, next)};
+				pciWrite32(dev, next, 0xFFFFFFFF_u32);
+				const auto highMask	{pciRead32(dev, next)};
+				pciWrite32(dev, next, high);
+				bar.address	|= static_cast<igros_quad_t>(high) << 32;
+				bar.flags	|= PCI_BAR_FLAG_64;
+				sizeMask	= (static_cast<igros_quad_t>(highMask) << 32) | (mask & PCI_BAR_MEM_MASK);
+				i++;
+			}
+			bar.size = (0_u32 != (mask & PCI_BAR_MEM_MASK)) ? (~sizeMask + 1_u64) : 0_u64;
+		}
+		pciWrite16(dev, PCI_COMMAND, command);
+	}
+
+	// Find message interrupts capabilities
+	static void pciDecodeCapabilities(pciDevice_t &dev) noexcept {
+		dev.msi = pciFindCapability(dev, PCI_CAP_MSI);
+		if (0_u16 != dev.msi) {
+			const auto control	{pciRead16(dev, static_cast<igros_word_t>(dev.msi + PCI_MSI_CONTROL))};
+			dev.msiVectors		= static_cast<igros_word_t>(1_u32 << ((control >> PCI_MSI_MULTIPLE_SHIFT) & PCI_MSI_MULTIPLE_MASK));
+		}
+		dev.msix = pciFindCapability(dev, PCI_CAP_MSIX);
+		if (0_u16 != dev.msix) {
+			const auto control	{pciRead16(dev, static_cast<igros_word_t>(dev.msix + PCI_MSI_CONTROL))};
+			dev.msixVectors		= static_cast<igros_word_t>((control & PCI_MSIX_SIZE_MASK) + 1_u16);
+		}
+	}
+
+	// Record function (nullptr if table is full)
+	[[nodiscard]]
+	static auto pciAdd(const pciDevice_t &location) noexcept -> pciDevice_t* {
+		if (pciCount >= PCI_DEVICES_MAX) [[unlikely]] {
+			return nullptr;
+		}
+		auto &dev	{pciDevices[pciCount]};
+		dev		= location;
+		dev.vendor	= pciRead16(dev, PCI_VENDOR_ID);
+		dev.device	= pciRead16(dev, PCI_DEVICE_ID);
+		dev.subsystem	= pciRead16(dev, PCI_SUBSYSTEM_ID);
+		dev.classCode	= pciRead8(dev, PCI_CLASS);
+		dev.subclass	= pciRead8(dev, PCI_SUBCLASS);
+		dev.progIF	= pciRead8(dev, PCI_PROG_IF);
+		dev.revision	= pciRead8(dev, PCI_REVISION);
+		dev.header	= pciRead8(dev, PCI_HEADER_TYPE) & static_cast<igros_byte_t>(~PCI_HEADER_MULTI);
+		// Legacy interrupt routed by firmware
+		if ((PCI_HEADER_DEVICE == dev.header) && (0_u8 != pciRead8(dev, PCI_INTERRUPT_PIN))) {
+			dev.irq = pciRead8(dev, PCI_INTERRUPT_LINE);
+		}
+		pciDecodeBARs(dev);
+		pciDecodeCapabilities(dev);
+		klib::kprintf(
+			"PCI:\t\t%d:%d:%d.%d %x:%x class %x:%x irq %d%s%s\n",
+			dev.segment,
+			dev.bus,
+			dev.slot,
+			dev.function,
+			dev.vendor,
+			dev.device,
+			dev.classCode,
+			dev.subclass,
+			dev.irq,
+			(0_u16 != dev.msi) ? " MSI" : "",
+			(0_u16 != dev.msix) ? " MSI-X" : ""
+		);
+		pciCount++;
+		return &dev;
+	}
+
+
+	// Scan bus and buses behind its bridges
+	static void pciScanBus(const igros_word_t segment, const igros_dword_t bus, std::array<igros_dword_t, 8_usize> &visited) noexcept {
+		// Misconfigured bridges may point back
+		if (0_u32 != (visited[bus >> 5] & (1_u32 << (bus & 0x1F_u32)))) {
+			return;
+		}
+		visited[bus >> 5] |= 1_u32 << (bus & 0x1F_u32);
+		for (auto slot {0_u32}; slot < PCI_SLOTS; slot++) {
+			// Absent functions read all ones
+			if (PCI_ANY_ID == pciRead16(pciLocate(segment, bus, slot, 0_u32), PCI_VENDOR_ID)) {
+				continue;
+			}
+			// Other functions only exist on multi-function devices
+			const auto functions {(0_u8 != (pciRead8(pciLocate(segment, bus, slot, 0_u32), PCI_HEADER_TYPE) & PCI_HEADER_MULTI)) ? PCI_FUNCTIONS : 1_u32};
+			for (auto function {0_u32}; function < functions; function++) {
+				const auto location {pciLocate(segment, bus, slot, function)};
+				if (PCI_ANY_ID == pciRead16(location, PCI_VENDOR_ID)) {
+					continue;
+				}
+				const auto dev {pciAdd(location)};
+				// PCI-to-PCI bridge leads to secondary bus
+				if ((nullptr != dev) && (PCI_HEADER_BRIDGE == dev->header)) {
+					pciScanBus(segment, pciRead8(*dev, PCI_SECONDARY_BUS), visited);
+				}
+			}
+		}
+	}
+
+	// Scan segment from root bus
+	static void pciScanSegment(const igros_word_t segment, const igros_dword_t root) noexcept {
+		std::array<igros_dword_t, 8_usize> visited {};
+		// Multi-function host bridge has one root bus per function
+		const auto host {pciLocate(segment, root, 0_u32, 0_u32)};
+		if ((PCI_ANY_ID == pciRead16(host, PCI_VENDOR_ID)) || (0_u8 == (pciRead8(host, PCI_HEADER_TYPE) & PCI_HEADER_MULTI))) {
+			pciScanBus(segment, root, visited);
+			return;
+		}
+		for (auto function {0_u32}; function < PCI_FUNCTIONS; function++) {
+			if (PCI_ANY_ID != pciRead16(pciLocate(segment, root, 0_u32, function), PCI_VENDOR_ID)) {
+				pciScanBus(segment, root + function, visited);
+			}
+		}
+	}
+
+	// Collect ECAM windows from ACPI MCFG
+	static void pciFindECAM() noexcept {
+		for (const auto &entry : acpi::mcfgEntries()) {
+			if ((pciWindowCount >= PCI_ECAM_MAX) || (entry.busEnd < entry.busStart)) [[unlikely]] {
+				continue;
+			}
+			// Window must be reachable without remapping
+			const auto start	{entry.address + (static_cast<igros_quad_t>(entry.busStart) << 20)};
+			const auto end		{entry.address + ((static_cast<igros_quad_t>(entry.busEnd) + 1_u64) << 20)};
+			if (!((end <= PCI_ECAM_LOW_END) || ((start >= PCI_ECAM_HIGH_START) && (end <= PCI_ECAM_HIGH_END)))) [[unlikely]] {
+				klib::kprintf("PCI:\t\tECAM at 0x%p is not mapped\n", static_cast<igros_usize_t>(start));
+				continue;
+			}
+			pciWindows[pciWindowCount++] = {
+				std::bit_cast<igros_byte_t*>(static_cast<igros_usize_t>(start)),
+				entry.segment,
+				entry.busStart,
+				entry.busEnd
+			};
+			klib::kprintf("PCI:\t\tECAM segment %d, bus %d - %d at 0x%p\n", entry.segment, entry.busStart, entry.busEnd, static_cast<igros_usize_t>(start));
+		}
+	}
+
+
+	// Setup PCI
+	void pciSetup() noexcept {
+		pciFindECAM();
+		// Every ECAM segment from its first bus, legacy ports reach segment 0 only
+		auto legacy {true};
+		for (auto i {0_usize}; i < pciWindowCount; i++) {
+			pciScanSegment(pciWindows[i].segment, pciWindows[i].busStart);
+			legacy = legacy && (0_u16 != pciWindows[i].segment);
+		}
+		if (legacy) {
+			pciScanSegment(0_u16, 0_u32);
+		}
+		klib::kprintf("PCI:\t\t%z function(s) found, %s configuration access\n", pciCount, (0_usize != pciWindowCount) ? "ECAM" : "port");
+		// Drivers registered before scan
+		for (auto driver {pciDrivers}; nullptr != driver; driver = driver->next) {
+			pciProbe(*driver);
+		}
+	}
+
+
+}	// namespace igros::arch
+
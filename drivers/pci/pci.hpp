@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////////
+//
+//	PCI bus
+//
+//	File:	pci.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <array>
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// PCI bus
+	//
+	// Configuration space is reached through memory-mapped ECAM windows
+	// listed in ACPI MCFG table when present: every access is single memory
+	// operation, needs no lock and reaches extended (PCIe) registers. Buses
+	// no window covers fall back to legacy 0xCF8/0xCFC ports, where address
+	// and data accesses go in pairs under lock. Buses are scanned at boot
+	// from root ones down through PCI-to-PCI bridges. Found functions are
+	// kept in table with decoded BARs (address, size, type) and positions of
+	// MSI and MSI-X capabilities. Drivers register vendor, device and class
+	// they serve and get probe call for every matching function no other
+	// driver took, regardless of whether they registered before or after scan
+
+
+	// Max PCI functions
+	constexpr auto PCI_DEVICES_MAX		{64_usize};
+	// Any vendor or device ID (driver match)
+	constexpr auto PCI_ANY_ID		{0xFFFF_u16};
+	// Any class or subclass (driver match)
+	constexpr auto PCI_ANY_CLASS		{0xFF_u8};
+	// No interrupt line
+	constexpr auto PCI_IRQ_NONE		{0xFF_u8};
+
+	// Configuration space registers
+	constexpr auto PCI_VENDOR_ID		{0x00_u16};
+	constexpr auto PCI_DEVICE_ID		{0x02_u16};
+	constexpr auto PCI_COMMAND		{0x04_u16};
+	constexpr auto PCI_STATUS		{0x06_u16};
+	constexpr auto PCI_REVISION		{0x08_u16};
+	constexpr auto PCI_PROG_IF		{0x09_u16};
+	constexpr auto PCI_SUBCLASS		{0x0A_u16};
+	constexpr auto PCI_CLASS		{0x0B_u16};
+	constexpr auto PCI_HEADER_TYPE		{0x0E_u16};
+	constexpr auto PCI_BAR0			{0x10_u16};
+	constexpr auto PCI_SECONDARY_BUS	{0x19_u16};
+	constexpr auto PCI_SUBSYSTEM_ID		{0x2E_u16};
+	constexpr auto PCI_CAPABILITIES		{0x34_u16};
+	constexpr auto PCI_INTERRUPT_LINE	{0x3C_u16};
+	constexpr auto PCI_INTERRUPT_PIN	{0x3D_u16};
+
+	// Command register bits
+	constexpr auto PCI_COMMAND_IO		{0x0001_u16};
+	constexpr auto PCI_COMMAND_MEMORY	{0x0002_u16};
+	constexpr auto PCI_COMMAND_MASTER	{0x0004_u16};
+	constexpr auto PCI_COMMAND_INTX_OFF	{0x0400_u16};
+
+	// Capability IDs
+	constexpr auto PCI_CAP_MSI		{0x05_u8};
+	constexpr auto PCI_CAP_VENDOR		{0x09_u8};
+	constexpr auto PCI_CAP_PCIE		{0x10_u8};
+	constexpr auto PCI_CAP_MSIX		{0x11_u8};
+
+	// MSI and MSI-X message control fields
+	constexpr auto PCI_MSI_CONTROL		{0x02_u16};
+	constexpr auto PCI_MSI_MULTIPLE_SHIFT	{1_u32};
+	constexpr auto PCI_MSI_MULTIPLE_MASK	{0x0007_u16};
+	constexpr auto PCI_MSIX_SIZE_MASK	{0x07FF_u16};
+
+	// Max BARs (type 0 header)
+	constexpr auto PCI_BARS_MAX		{6_usize};
+	// BAR flags
+	constexpr auto PCI_BAR_FLAG_IO		{0x01_u8};
+	constexpr auto PCI_BAR_FLAG_64		{0x02_u8};
+	constexpr auto PCI_BAR_FLAG_PREFETCH	{0x04_u8};
+
+
+	struct pciDevice_t;
+
+
+	// Driver probe (false if function is not taken)
+	using pciProbe_t	= std::add_pointer_t<auto (pciDevice_t&) -> bool>;
+
+
+	// PCI driver (outlives registration)
+	struct pciDriver_t {
+		const char*		name;			// Driver name
+		igros_word_t		vendor;			// Vendor ID (or PCI_ANY_ID)
+		igros_word_t		device;			// Device ID (or PCI_ANY_ID)
+		igros_byte_t		classCode;		// Class code (or PCI_ANY_CLASS)
+		igros_byte_t		subclass;		// Subclass code (or PCI_ANY_CLASS)
+		pciProbe_t		probe;			// Probe function
+		pciDriver_t*		next;			// Registered drivers link
+	};
+
+	// Decoded BAR
+	struct pciBar_t {
+		igros_quad_t		address;		// I/O port or memory address (0 if not present)
+		igros_quad_t		size;			// Decoded range size
+		igros_byte_t		flags;			// BAR flags
+	};
+
+	// PCI function
+	struct pciDevice_t {
+		igros_byte_t*				config;		// ECAM configuration space (nullptr - legacy ports)
+		igros_word_t				segment;	// Segment group
+		igros_byte_t				bus;		// Bus number
+		igros_byte_t				slot;		// Device number
+		igros_byte_t				function;	// Function number
+		igros_word_t				vendor;		// Vendor ID
+		igros_word_t				device;		// Device ID
+		igros_word_t				subsystem;	// Subsystem ID
+		igros_byte_t				classCode;	// Class code
+		igros_byte_t				subclass;	// Subclass code
+		igros_byte_t				progIF;		// Programming interface
+		igros_byte_t				revision;	// Revision ID
+		igros_byte_t				header;		// Header type (without multi-function bit)
+		igros_byte_t				irq;		// Legacy interrupt line (or PCI_IRQ_NONE)
+		std::array<pciBar_t, PCI_BARS_MAX>	bars;		// BARs
+		igros_word_t				msi;		// MSI capability offset (0 if none)
+		igros_word_t				msiVectors;	// MSI vectors supported
+		igros_word_t				msix;		// MSI-X capability offset (0 if none)
+		igros_word_t				msixVectors;	// MSI-X table size
+		const pciDriver_t*			driver;		// Bound driver
+	};
+
+
+	// Read configuration space
+	[[nodiscard]]
+	auto	pciRead8(const pciDevice_t &dev, const igros_word_t offset) noexcept -> igros_byte_t;
+	[[nodiscard]]
+	auto	pciRead16(const pciDevice_t &dev, const igros_word_t offset) noexcept -> igros_word_t;
+	[[nodiscard]]
+	auto	pciRead32(const pciDevice_t &dev, const igros_word_t offset) noexcept -> igros_dword_t;
+	// Write configuration space
+	void	pciWrite8(const pciDevice_t &dev, const igros_word_t offset, const igros_byte_t value) noexcept;
+	void	pciWrite16(const pciDevice_t &dev, const igros_word_t offset, const igros_word_t value) noexcept;
+	void	pciWrite32(const pciDevice_t &dev, const igros_word_t offset, const igros_dword_t value) noexcept;
+
+	// BAR address (I/O port or memory, 0 if not present)
+	[[nodiscard]]
+	auto	pciBAR(const pciDevice_t &dev, const igros_usize_t index) noexcept -> igros_quad_t;
+	// BAR size (0 if not present)
+	[[nodiscard]]
+	auto	pciBARSize(const pciDevice_t &dev, const igros_usize_t index) noexcept -> igros_quad_t;
+	// Check if BAR is I/O ports
+	[[nodiscard]]
+	auto	pciBARIsIO(const pciDevice_t &dev, const igros_usize_t index) noexcept -> bool;
+	// Find capability (offset, 0 if none)
+	[[nodiscard]]
+	auto	pciFindCapability(const pciDevice_t &dev, const igros_byte_t id, const igros_word_t from = 0_u16) noexcept -> igros_word_t;
+	// Set command register bits
+	void	pciEnable(const pciDevice_t &dev, const igros_word_t command) noexcept;
+
+	// Bus address of kernel memory (DMA)
+	[[nodiscard]]
+	auto	pciBusAddress(const void* const addr) noexcept -> igros_quad_t;
+
+	// Register driver (probes matching functions)
+	void	pciRegisterDriver(pciDriver_t &driver) noexcept;
+
+	// Setup PCI
+	void	pciSetup() noexcept;
+
+
+}	// namespace igros::arch
+
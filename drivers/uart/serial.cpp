@@ -23,7 +23,11 @@
 // IgrOS-Kernel library
 #include <klib/kmemory.hpp>
 #include <klib/kprint.hpp>
+#include <klib/kLock.hpp>
 #include <klib/kstring.hpp>
+// IgrOS-Kernel system
+#include <sys/irqtrace.hpp>
+#include <sys/workqueue.hpp>
 
 
 // Arch-dependent code zone
@@ -32,7 +36,7 @@ namespace igros::arch {
 
 	// Serial ports
 	constexpr auto SERIAL_PORT_1	{static_cast<io::port_t>(0x03F8_u16)};
-	//constexpr auto SERIAL_PORT_2	{static_cast<io::port_t>(0x02F8_u16)};
+	constexpr auto SERIAL_PORT_2	{static_cast<io::port_t>(0x02F8_u16)};
 	//constexpr auto SERIAL_PORT_3	{static_cast<io::port_t>(0x03E8_u16)};
 	//constexpr auto SERIAL_PORT_4	{static_cast<io::port_t>(0x02E8_u16)};
 
@@ -199,31 +203,98 @@ namespace igros::arch {
 	}
 
 
+	// Serial receive buffer size
+	constexpr auto SERIAL_BUFFER_SIZE	{128_usize};
+	// Serial command line size
+	constexpr auto SERIAL_COMMAND_SIZE	{32_usize};
+
+
+	// Serial port state
+	struct serialPort_t {
+		io::port_t					port;		// Base I/O port
+		irq::irq_t					line;		// IRQ line
+		const char*					name;		// Port name
+		std::array<char, SERIAL_BUFFER_SIZE>		buffer;		// Data read by interrupt handler
+		igros_usize_t					size;		// Data size
+		klib::kSpinlock<>				lock;		// Buffer lock
+		sys::work_t					work;		// Bottom half work
+	};
+
+
+	// Serial ports (COM1/COM3 and COM2/COM4 share IRQ lines)
+	static std::array<serialPort_t, 2_usize>	serialPorts {{
+		{SERIAL_PORT_1, irq::irq_t::UART1, "UART1", {}, 0_usize, {}, {}},
+		{SERIAL_PORT_2, irq::irq_t::UART2, "UART2", {}, 0_usize, {}, {}}
+	}};
+	// Command line typed so far (bottom half only)
+	static std::array<char, SERIAL_COMMAND_SIZE>	serialCommand		{};
+	// Command line size
+	static igros_usize_t				serialCommandSize	{0_usize};
+
+
+	// Run serial console command
+	static void serialCommandRun(const char* const command) noexcept {
+		if (0 == klib::kstrcmp(command, "irqtrace", SERIAL_COMMAND_SIZE)) {
+			sys::irqTraceDump();
+		}
+	}
+
+
+	// Serial bottom half (thread context)
+	static void serialWorkFunc(const igros_pointer_t arg) noexcept {
+		auto &serial {*static_cast<serialPort_t*>(arg)};
+		// Take data
+		std::array<char, SERIAL_BUFFER_SIZE + 1_usize> data;
+		igros_usize_t read {0_usize};
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {serial.lock};
+			read		= serial.size;
+			klib::kmemcpy(data.data(), serial.buffer.data(), read);
+			serial.size	= 0_usize;
+		}
+		data[read] = '\0';
+		// Collect command line
+		for (auto i {0_usize}; i < read; i++) {
+			if (('\r' == data[i]) || ('\n' == data[i])) {
+				serialCommand[serialCommandSize]	= '\0';
+				serialCommandSize			= 0_usize;
+				serialCommandRun(serialCommand.data());
+			} else if ((serialCommandSize + 1_usize) < SERIAL_COMMAND_SIZE) {
+				serialCommand[serialCommandSize++]	= data[i];
+			}
+		}
+		// Debug data
+		klib::kprintf(
+			"IRQ #%d\t[%s]\n"
+			"Read:\t%05d bytes = %s\n",
+			serial.line,
+			serial.name,
+			read,
+			std::bit_cast<const igros_sbyte_t* const>(data.cbegin())
+		);
+	}
+
+
 	// Serial IRQ handler
-	void serialInterruptHandler(const register_t* const regs) noexcept {
-		// Check IRQ #
-		if (regs->number == static_cast<igros_dword_t>(irq::irq_t::UART2)) {
-			// Serial #2 | #4
-			// Debug data
-			klib::kprintf(
-				"IRQ #%d\t[UART2]\n"
-				"Read:\tNOTHING!\n"
-			);
-		} else if (regs->number == static_cast<igros_dword_t>(irq::irq_t::UART1)) {
-			// Serial #1 | #3
-			std::array<char, 128_usize> data;
-			// Zero out
-			klib::kmemset(data.data(), data.size(), 0x00_u8);
-			// Read from UART1
-			const auto read {serialRead(data.data(), data.size())};
-			// Debug data
-			klib::kprintf(
-				"IRQ #%d\t[UART1]\n"
-				"Read:\t%05d bytes = %s\n",
-				read,
-				std::bit_cast<const igros_sbyte_t* const>(data.cbegin())
-			);
+	auto serialInterruptHandler([[maybe_unused]] const register_t* const regs, const igros_pointer_t cookie) noexcept -> irq::return_t {
+		auto &serial {*static_cast<serialPort_t*>(cookie)};
+		// No interrupt pending on this port
+		if (0x01_u8 == (io::get().readPort8(SERIAL_PORT_IIR(serial.port)) & 0x01_u8)) {
+			return irq::return_t::NONE;
+		}
+		// Drain FIFO, print later
+		{
+			const klib::kLockGuard<klib::kSpinlock<>> guard {serial.lock};
+			while (0x01_u8 == (io::get().readPort8(SERIAL_PORT_LSR(serial.port)) & 0x01_u8)) {
+				const auto data {static_cast<char>(io::get().readPort8(SERIAL_PORT_DR(serial.port)))};
+				// Newest is dropped when full
+				if (serial.size < SERIAL_BUFFER_SIZE) [[likely]] {
+					serial.buffer[serial.size++] = data;
+				}
+			}
 		}
+		sys::workQueue(sys::workqueueSystem(), serial.work);
+		return irq::return_t::HANDLED;
 	}
 
 	// Setup serial port
@@ -235,15 +306,16 @@ namespace igros::arch {
 			return;
 		}
 
-		// Install UART1 interrupt handler
-		irq::get().install<irq::irq_t::UART1, serialInterruptHandler>();
-		// Mask UART1 interrupts
-		irq::get().mask(irq::irq_t::UART1);
-
-		// Install UART2 interrupt handler
-		irq::get().install<irq::irq_t::UART2, serialInterruptHandler>();
-		// Mask UART2 interrupts
-		irq::get().mask(irq::irq_t::UART2);
+		// Add handler per port (port is cookie)
+		for (auto &serial : serialPorts) {
+			serial.work = {nullptr, serialWorkFunc, &serial, 0_u32};
+			if (!irq::get().add(serial.line, serialInterruptHandler, &serial)) [[unlikely]] {
+				klib::kprintf("Serial:\t\t%s - no free IRQ handler slot!\n", serial.name);
+				continue;
+			}
+			// Mask UART interrupts
+			irq::get().mask(serial.line);
+		}
 
 	}
 
@@ -0,0 +1,234 @@
+////////////////////////////////////////////////////////////////
+//
+//	Virtio legacy PCI transport and split virtqueues
+//
+//	File:	virtio.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <bit>
+// IgrOS-Kernel drivers
+#include <drivers/pci/pci.hpp>
+#include <drivers/virtio/virtio.hpp>
+// IgrOS-Kernel library
+#include <klib/kAtomic.hpp>
+#include <klib/kmemory.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// Legacy registers (I/O BAR offsets)
+	constexpr auto VIRTIO_REG_DEVICE_FEATURES	{0x00_u16};
+	constexpr auto VIRTIO_REG_GUEST_FEATURES	{0x04_u16};
+	constexpr auto VIRTIO_REG_QUEUE_ADDRESS		{0x08_u16};
+	constexpr auto VIRTIO_REG_QUEUE_SIZE		{0x0C_u16};
+	constexpr auto VIRTIO_REG_QUEUE_SELECT		{0x0E_u16};
+	constexpr auto VIRTIO_REG_QUEUE_NOTIFY		{0x10_u16};
+	constexpr auto VIRTIO_REG_STATUS		{0x12_u16};
+	constexpr auto VIRTIO_REG_ISR			{0x13_u16};
+	constexpr auto VIRTIO_REG_CONFIG		{0x14_u16};
+	// Legacy registers with MSI-X enabled (device configuration follows them)
+	constexpr auto VIRTIO_REG_CONFIG_VECTOR		{0x14_u16};
+	constexpr auto VIRTIO_REG_QUEUE_VECTOR		{0x16_u16};
+	constexpr auto VIRTIO_REG_CONFIG_MSIX		{0x18_u16};
+
+	// Queue address register unit
+	constexpr auto VIRTIO_QUEUE_ADDRESS_SHIFT	{12_u32};
+	// Device does not need notifications (no event index)
+	constexpr auto VIRTQ_USED_F_NO_NOTIFY		{0x0001_u32};
+
+
+	// Register port
+	[[nodiscard]]
+	static auto virtioPort(const virtio_t &dev, const igros_word_t reg) noexcept -> io::port_t {
+		return static_cast<io::port_t>(dev.base + reg);
+	}
+
+
+	// Reset device and negotiate features (returns negotiated ones)
+	[[nodiscard]]
+	auto virtioBegin(virtio_t &dev, const igros_dword_t wanted) noexcept -> igros_dword_t {
+		// Reset, then tell device it was noticed and has driver
+		io::get().writePort8(virtioPort(dev, VIRTIO_REG_STATUS), 0_u8);
+		io::get().writePort8(virtioPort(dev, VIRTIO_REG_STATUS), VIRTIO_STATUS_ACKNOWLEDGE);
+		io::get().writePort8(virtioPort(dev, VIRTIO_REG_STATUS), VIRTIO_STATUS_ACKNOWLEDGE | VIRTIO_STATUS_DRIVER);
+		dev.config = VIRTIO_REG_CONFIG;
+		// Only features both sides know
+		dev.features = io::get().readPort32(virtioPort(dev, VIRTIO_REG_DEVICE_FEATURES)) & wanted;
+		io::get().writePort32(virtioPort(dev, VIRTIO_REG_GUEST_FEATURES), dev.features);
+		return dev.features;
+	}
+
+	// Let device run
+	void virtioReady(const virtio_t &dev) noexcept {
+		const auto port {virtioPort(dev, VIRTIO_REG_STATUS)};
+		io::get().writePort8(port, io::get().readPort8(port) | VIRTIO_STATUS_DRIVER_OK);
+	}
+
+	// Give device up
+	void virtioFail(const virtio_t &dev) noexcept {
+		const auto port {virtioPort(dev, VIRTIO_REG_STATUS)};
+		io::get().writePort8(port, io::get().readPort8(port) | VIRTIO_STATUS_FAILED);
+	}
+
+	// Read and acknowledge interrupt status
+	[[nodiscard]]
+	auto virtioISR(const virtio_t &dev) noexcept -> igros_byte_t {
+		return io::get().readPort8(virtioPort(dev, VIRTIO_REG_ISR));
+	}
+
+	// Switch register layout after function MSI-X was enabled or disabled
+	void virtioMsix(virtio_t &dev, const bool enabled) noexcept {
+		dev.config = enabled ? VIRTIO_REG_CONFIG_MSIX : VIRTIO_REG_CONFIG;
+	}
+
+	// Set configuration change MSI-X entry (false if device refused it)
+	[[nodiscard]]
+	auto virtioSetConfigVector(const virtio_t &dev, const igros_word_t entry) noexcept -> bool {
+		io::get().writePort16(virtioPort(dev, VIRTIO_REG_CONFIG_VECTOR), entry);
+		// Device reports no vector if it could not map entry
+		return io::get().readPort16(virtioPort(dev, VIRTIO_REG_CONFIG_VECTOR)) == entry;
+	}
+
+
+	// Read device configuration word
+	[[nodiscard]]
+	auto virtioConfig16(const virtio_t &dev, const igros_usize_t offset) noexcept -> igros_word_t {
+		return io::get().readPort16(virtioPort(dev, static_cast<igros_word_t>(dev.config + offset)));
+	}
+
+	// Read device configuration double word
+	[[nodiscard]]
+	auto virtioConfig32(const virtio_t &dev, const igros_usize_t offset) noexcept -> igros_dword_t {
+		return io::get().readPort32(virtioPort(dev, static_cast<igros_word_t>(dev.config + offset)));
+	}
+
+	// Read device configuration quad word
+	[[nodiscard]]
+	auto virtioConfig64(const virtio_t &dev, const igros_usize_t offset) noexcept -> igros_quad_t {
+		// Halves are read separately, retry if upper one changed meanwhile
+		auto high {virtioConfig32(dev, offset + 4_usize)};
+		for (;;) {
+			const auto low		{virtioConfig32(dev, offset)};
+			const auto check	{virtioConfig32(dev, offset + 4_usize)};
+			if (check == high) {
+				return (static_cast<igros_quad_t>(high) << 32) | low;
+			}
+			high = check;
+		}
+	}
+
+
+	// Setup virtqueue in given memory (page aligned, physically contiguous)
+	[[nodiscard]]
+	auto virtqSetup(const virtio_t &dev, virtqueue_t &vq, const igros_word_t index, igros_pointer_t memory, const igros_usize_t size) noexcept -> bool {
+		io::get().writePort16(virtioPort(dev, VIRTIO_REG_QUEUE_SELECT), index);
+		// Legacy queue size is fixed by device
+		const auto count {static_cast<igros_usize_t>(io::get().readPort16(virtioPort(dev, VIRTIO_REG_QUEUE_SIZE)))};
+		if (
+			(0_usize == count)				||
+			(count > VIRTQ_SIZE_MAX)			||
+			(0_usize != (count & (count - 1_usize)))	||
+			(virtqMemorySize(count) > size)
+		) [[unlikely]] {
+			return false;
+		}
+		klib::kmemset(memory, virtqMemorySize(count), 0_u8);
+		const auto base		{static_cast<igros_byte_t*>(memory)};
+		const auto usedOffset	{virtqMemorySize(count) - 8_usize - sizeof(virtqUsedElem_t) * count};
+		vq.desc			= std::bit_cast<virtqDesc_t*>(base);
+		vq.avail		= std::bit_cast<igros_dword_t*>(base + sizeof(virtqDesc_t) * count);
+		vq.availRing		= std::bit_cast<igros_word_t*>(vq.avail + 1_usize);
+		vq.usedEvent		= std::bit_cast<igros_dword_t*>(vq.availRing + count);
+		vq.used			= std::bit_cast<igros_dword_t*>(base + usedOffset);
+		vq.usedRing		= std::bit_cast<virtqUsedElem_t*>(vq.used + 1_usize);
+		vq.availEvent		= std::bit_cast<igros_dword_t*>(vq.usedRing + count);
+		vq.notify		= virtioPort(dev, VIRTIO_REG_QUEUE_NOTIFY);
+		vq.index		= index;
+		vq.size			= static_cast<igros_word_t>(count);
+		vq.availIndex		= 0_u16;
+		vq.published		= 0_u16;
+		vq.lastUsed		= 0_u16;
+		vq.eventIndex		= 0_u32 != (dev.features & VIRTIO_F_EVENT_IDX);
+		// Device reads rings from physical page
+		io::get().writePort32(
+			virtioPort(dev, VIRTIO_REG_QUEUE_ADDRESS),
+			static_cast<igros_dword_t>(pciBusAddress(memory) >> VIRTIO_QUEUE_ADDRESS_SHIFT)
+		);
+		return true;
+	}
+
+	// Set virtqueue MSI-X entry (false if device refused it)
+	[[nodiscard]]
+	auto virtqSetVector(const virtio_t &dev, const virtqueue_t &vq, const igros_word_t entry) noexcept -> bool {
+		io::get().writePort16(virtioPort(dev, VIRTIO_REG_QUEUE_SELECT), vq.index);
+		io::get().writePort16(virtioPort(dev, VIRTIO_REG_QUEUE_VECTOR), entry);
+		// Device reports no vector if it could not map entry
+		return io::get().readPort16(virtioPort(dev, VIRTIO_REG_QUEUE_VECTOR)) == entry;
+	}
+
+	// Add descriptor chain head to available ring (queue locked)
+	void virtqPush(virtqueue_t &vq, const igros_word_t head) noexcept {
+		vq.availRing[vq.availIndex & (vq.size - 1_u16)] = head;
+		vq.availIndex++;
+	}
+
+	// Publish added heads (queue locked, true if device must be notified)
+	[[nodiscard]]
+	auto virtqPublish(virtqueue_t &vq) noexcept -> bool {
+		const auto previous	{vq.published};
+		const auto current	{vq.availIndex};
+		if (previous == current) {
+			return false;
+		}
+		vq.published		= current;
+		// Entries and descriptors are visible before index, exchange also orders event read after it
+		klib::kAtomicRef<igros_dword_t>(*vq.avail).store(static_cast<igros_dword_t>(current) << 16, klib::kMemoryOrder::SEQ_CST);
+		if (!vq.eventIndex) {
+			return 0_u32 == (klib::kAtomicRef<igros_dword_t>(*vq.used).load(klib::kMemoryOrder::ACQUIRE) & VIRTQ_USED_F_NO_NOTIFY);
+		}
+		// Notify only if device asked for index inside just published range
+		const auto event {static_cast<igros_word_t>(klib::kAtomicRef<igros_dword_t>(*vq.availEvent).load(klib::kMemoryOrder::ACQUIRE))};
+		return static_cast<igros_word_t>(current - event - 1_u16) < static_cast<igros_word_t>(current - previous);
+	}
+
+	// Notify device (no lock needed)
+	void virtqNotify(const virtqueue_t &vq) noexcept {
+		io::get().writePort16(vq.notify, vq.index);
+	}
+
+	// Take next used element (queue locked, false if none)
+	[[nodiscard]]
+	auto virtqPop(virtqueue_t &vq, virtqUsedElem_t &elem) noexcept -> bool {
+		// Element is read after index
+		const auto index {static_cast<igros_word_t>(klib::kAtomicRef<igros_dword_t>(*vq.used).load(klib::kMemoryOrder::ACQUIRE) >> 16)};
+		if (index == vq.lastUsed) {
+			return false;
+		}
+		elem = vq.usedRing[vq.lastUsed & (vq.size - 1_u16)];
+		vq.lastUsed++;
+		return true;
+	}
+
+	// Ask for interrupt on next used element (queue locked, true if some arrived meanwhile)
+	[[nodiscard]]
+	auto virtqArm(virtqueue_t &vq) noexcept -> bool {
+		// Without event index device interrupts on every element anyway
+		if (vq.eventIndex) {
+			// Exchange orders index read below after event store
+			klib::kAtomicRef<igros_dword_t>(*vq.usedEvent).store(vq.lastUsed, klib::kMemoryOrder::SEQ_CST);
+		}
+		return static_cast<igros_word_t>(klib::kAtomicRef<igros_dword_t>(*vq.used).load(klib::kMemoryOrder::ACQUIRE) >> 16) != vq.lastUsed;
+	}
+
+
+}	// namespace igros::arch
+
@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////
+//
+//	Virtio legacy PCI transport and split virtqueues
+//
+//	File:	virtio.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch
+#include <arch/io.hpp>
+#include <arch/types.hpp>
+// IgrOS-Kernel library
+#include <klib/kLock.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// Virtio
+	//
+	// Device registers live in I/O BAR 0 (legacy interface, offered by every
+	// QEMU/KVM transitional device). Virtqueue is descriptor table, available
+	// ring (driver to device) and used ring (device to driver) in physically
+	// contiguous memory. Driver fills available ring entries and publishes
+	// them all with single index store. With event index negotiated both
+	// sides publish index they want to be notified at, so driver kicks device
+	// only when it is asked to (no VM exit otherwise) and device interrupts
+	// only after driver drained used ring, which coalesces completions
+	// landing meanwhile into same interrupt. Once function MSI-X is enabled
+	// every queue can signal own table entry (device configuration moves
+	// past two vector registers then)
+
+
+	// Virtio PCI vendor ID
+	constexpr auto VIRTIO_VENDOR_ID			{0x1AF4_u16};
+
+	// Device status bits
+	constexpr auto VIRTIO_STATUS_ACKNOWLEDGE	{0x01_u8};
+	constexpr auto VIRTIO_STATUS_DRIVER		{0x02_u8};
+	constexpr auto VIRTIO_STATUS_DRIVER_OK		{0x04_u8};
+	constexpr auto VIRTIO_STATUS_FAILED		{0x80_u8};
+
+	// Interrupt status bits
+	constexpr auto VIRTIO_ISR_QUEUE			{0x01_u8};
+	constexpr auto VIRTIO_ISR_CONFIG		{0x02_u8};
+	// No MSI-X entry
+	constexpr auto VIRTIO_MSI_NO_VECTOR		{0xFFFF_u16};
+
+	// Ring feature bits
+	constexpr auto VIRTIO_F_INDIRECT_DESC		{1_u32 << 28};
+	constexpr auto VIRTIO_F_EVENT_IDX		{1_u32 << 29};
+
+	// Descriptor flags
+	constexpr auto VIRTQ_DESC_F_NEXT		{0x0001_u16};
+	constexpr auto VIRTQ_DESC_F_WRITE		{0x0002_u16};
+	constexpr auto VIRTQ_DESC_F_INDIRECT		{0x0004_u16};
+
+	// Used ring alignment (legacy interface)
+	constexpr auto VIRTQ_ALIGN			{0x1000_usize};
+	// Max supported queue size
+	constexpr auto VIRTQ_SIZE_MAX			{256_usize};
+
+
+	// Virtqueue descriptor
+	struct virtqDesc_t {
+		igros_quad_t		address;		// Buffer bus address
+		igros_dword_t		length;			// Buffer length
+		igros_word_t		flags;			// Descriptor flags
+		igros_word_t		next;			// Next chained descriptor
+	};
+
+	// Used ring element
+	struct virtqUsedElem_t {
+		igros_dword_t		id;			// Head descriptor
+		igros_dword_t		length;			// Bytes written by device
+	};
+
+	// Legacy virtio device
+	struct virtio_t {
+		io::port_t		base;			// I/O BAR
+		igros_dword_t		features;		// Negotiated features
+		igros_word_t		config;			// Device configuration offset
+	};
+
+	// Split virtqueue (fields below lock are protected by it)
+	//
+	// Ring headers (flags and index) and event words are accessed as double
+	// words, so every access is single atomic operation. Event words are
+	// always followed by padding, so upper halves belong to nobody
+	struct virtqueue_t {
+		klib::kSpinlock<>	lock;			// Queue lock
+		virtqDesc_t*		desc;			// Descriptor table
+		igros_dword_t*		avail;			// Available ring header (flags | index << 16)
+		igros_word_t*		availRing;		// Available ring
+		igros_dword_t*		usedEvent;		// Interrupt at this used index (low word)
+		igros_dword_t*		used;			// Used ring header (flags | index << 16)
+		virtqUsedElem_t*	usedRing;		// Used ring
+		igros_dword_t*		availEvent;		// Notify at this available index (low word)
+		io::port_t		notify;			// Notify register
+		igros_word_t		index;			// Queue index
+		igros_word_t		size;			// Queue size (power of two)
+		igros_word_t		availIndex;		// Next available index (not published yet)
+		igros_word_t		published;		// Available index seen by device
+		igros_word_t		lastUsed;		// Next used index to consume
+		bool			eventIndex;		// Event index negotiated
+	};
+
+
+	// Virtqueue memory size
+	[[nodiscard]]
+	constexpr auto virtqMemorySize(const igros_usize_t size) noexcept -> igros_usize_t {
+		// Descriptors and available ring, then aligned used ring (event word is padded to double word)
+		return ((sizeof(virtqDesc_t) * size + 6_usize + 2_usize * size + VIRTQ_ALIGN - 1_usize) & ~(VIRTQ_ALIGN - 1_usize)) + 8_usize + sizeof(virtqUsedElem_t) * size;
+	}
+
+
+	// Reset device and negotiate features (returns negotiated ones)
+	[[nodiscard]]
+	auto	virtioBegin(virtio_t &dev, const igros_dword_t wanted) noexcept -> igros_dword_t;
+	// Let device run
+	void	virtioReady(const virtio_t &dev) noexcept;
+	// Give device up
+	void	virtioFail(const virtio_t &dev) noexcept;
+	// Read and acknowledge interrupt status
+	[[nodiscard]]
+	auto	virtioISR(const virtio_t &dev) noexcept -> igros_byte_t;
+	// Switch register layout after function MSI-X was enabled or disabled
+	void	virtioMsix(virtio_t &dev, const bool enabled) noexcept;
+	// Set configuration change MSI-X entry (false if device refused it)
+	[[nodiscard]]
+	auto	virtioSetConfigVector(const virtio_t &dev, const igros_word_t entry) noexcept -> bool;
+
+	// Read device configuration
+	[[nodiscard]]
+	auto	virtioConfig16(const virtio_t &dev, const igros_usize_t offset) noexcept -> igros_word_t;
+	[[nodiscard]]
+	auto	virtioConfig32(const virtio_t &dev, const igros_usize_t offset) noexcept -> igros_dword_t;
+	[[nodiscard]]
+	auto	virtioConfig64(const virtio_t &dev, const igros_usize_t offset) noexcept -> igros_quad_t;
+
+	// Setup virtqueue in given memory (page aligned, physically contiguous)
+	[[nodiscard]]
+	auto	virtqSetup(const virtio_t &dev, virtqueue_t &vq, const igros_word_t index, igros_pointer_t memory, const igros_usize_t size) noexcept -> bool;
+	// Set virtqueue MSI-X entry (false if device refused it)
+	[[nodiscard]]
+	auto	virtqSetVector(const virtio_t &dev, const virtqueue_t &vq, const igros_word_t entry) noexcept -> bool;
+	// Add descriptor chain head to available ring (queue locked)
+	void	virtqPush(virtqueue_t &vq, const igros_word_t head) noexcept;
+	// Publish added heads (queue locked, true if device must be notified)
+	[[nodiscard]]
+	auto	virtqPublish(virtqueue_t &vq) noexcept -> bool;
+	// Notify device (no lock needed)
+	void	virtqNotify(const virtqueue_t &vq) noexcept;
+	// Take next used element (queue locked, false if none)
+	[[nodiscard]]
+	auto	virtqPop(virtqueue_t &vq, virtqUsedElem_t &elem) noexcept -> bool;
+	// Ask for interrupt on next used element (queue locked, true if some arrived meanwhile)
+	[[nodiscard]]
+	auto	virtqArm(virtqueue_t &vq) noexcept -> bool;
+
+
+}	// namespace igros::arch
+
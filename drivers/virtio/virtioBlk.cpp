@@ -0,0 +1,402 @@
+////////////////////////////////////////////////////////////////
+//
+//	Virtio block device driver
+//
+//	File:	virtioBlk.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+// IgrOS-Kernel arch
+#include <arch/io.hpp>
+#include <arch/irq.hpp>
+#include <arch/paging.hpp>
+#include <arch/register.hpp>
+// IgrOS-Kernel devices
+#include <dev/block.hpp>
+// IgrOS-Kernel drivers
+#include <drivers/pci/msi.hpp>
+#include <drivers/pci/pci.hpp>
+#include <drivers/virtio/virtio.hpp>
+#include <drivers/virtio/virtioBlk.hpp>
+// IgrOS-Kernel library
+#include <klib/kLock.hpp>
+#include <klib/kprint.hpp>
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// Transitional virtio block device ID
+	constexpr auto VIRTBLK_DEVICE_ID		{0x1001_u16};
+
+	// Max disks
+	constexpr auto VIRTBLK_DEVICES_MAX		{2_usize};
+	// Max virtqueues per disk
+	constexpr auto VIRTBLK_QUEUES_MAX		{2_usize};
+	// Max data segments per request (indirect table has header and status too)
+	constexpr auto VIRTBLK_SEGMENTS_MAX		{30_usize};
+	// Request slots per virtqueue
+	constexpr auto VIRTBLK_DEPTH			{sys::BLOCK_QUEUE_DEPTH};
+	// Virtqueue memory (whole pages)
+	constexpr auto VIRTBLK_RING_SIZE		{(virtqMemorySize(VIRTQ_SIZE_MAX) + VIRTQ_ALIGN - 1_usize) & ~(VIRTQ_ALIGN - 1_usize)};
+
+	// Device feature bits
+	constexpr auto VIRTBLK_F_SEG_MAX		{1_u32 << 2};
+	constexpr auto VIRTBLK_F_RO			{1_u32 << 5};
+	constexpr auto VIRTBLK_F_MQ			{1_u32 << 12};
+
+	// Device configuration offsets
+	constexpr auto VIRTBLK_CONFIG_CAPACITY		{0_usize};
+	constexpr auto VIRTBLK_CONFIG_SEG_MAX		{12_usize};
+	constexpr auto VIRTBLK_CONFIG_NUM_QUEUES	{34_usize};
+
+	// Request types
+	constexpr auto VIRTBLK_T_IN			{0_u32};
+	constexpr auto VIRTBLK_T_OUT			{1_u32};
+	// Request status
+	constexpr auto VIRTBLK_S_OK			{0x00_u8};
+	constexpr auto VIRTBLK_S_NONE			{0xFF_u8};
+
+	static_assert(VIRTBLK_DEPTH <= 32_usize, "Failed slots do not fit mask!");
+
+
+	// Request header (device readable)
+	struct virtblkHeader_t {
+		igros_dword_t		type;			// Request type
+		igros_dword_t		reserved;		// Reserved
+		igros_quad_t		sector;			// First sector
+	};
+
+	// Request slot
+	struct virtblkSlot_t {
+		std::array<virtqDesc_t, VIRTBLK_SEGMENTS_MAX + 2_usize>	table;		// Indirect descriptors
+		virtblkHeader_t						header;		// Request header
+		sys::blockRequest_t*					request;	// Block request in flight
+		igros_byte_t						status;		// Request status (device writable)
+	};
+
+	// Virtqueue with its request slots
+	struct virtblkQueue_t {
+		virtqueue_t						vq;		// Virtqueue
+		std::array<virtblkSlot_t, VIRTBLK_DEPTH>		slots;		// Request slots
+		std::array<igros_word_t, VIRTBLK_DEPTH>			free;		// Free slots stack
+		igros_usize_t						freeCount;	// Free slots count
+	};
+
+	// Virtio disk
+	struct virtblk_t {
+		sys::blockDevice_t					block;		// Block device
+		virtio_t						virtio;		// Transport
+		std::array<char, 4_usize>				name;		// Disk name
+		igros_byte_t						irq;		// Legacy interrupt line
+		igros_usize_t						queues;		// Virtqueues set up
+		bool							readOnly;	// Writes are rejected
+		std::array<virtblkQueue_t, VIRTBLK_QUEUES_MAX>		queue;		// Virtqueues
+		pciMsi_t						msi;		// Per-queue message interrupts
+		sys::blockBio_t						check;		// Probe read
+	};
+
+
+	// Disks
+	static std::array<virtblk_t, VIRTBLK_DEVICES_MAX>	virtblkDevices	{};
+	// Disks count
+	static igros_usize_t					virtblkCount	{0_usize};
+	// Virtqueues memory (rings need physically contiguous pages, heap hands out single ones)
+	alignas(VIRTQ_ALIGN) static std::array<std::array<igros_byte_t, VIRTBLK_RING_SIZE>, VIRTBLK_DEVICES_MAX * VIRTBLK_QUEUES_MAX>	virtblkRings	{};
+
+
+	// Start request (descriptors only, published on commit)
+	[[nodiscard]]
+	static auto virtblkQueueRq(sys::blockDevice_t &dev, sys::blockRequest_t &request) noexcept -> bool {
+		auto &disk {*static_cast<virtblk_t*>(dev.data)};
+		if (
+			(request.bios > VIRTBLK_SEGMENTS_MAX)				||
+			((sys::deviceOp_t::WRITE == request.op) && disk.readOnly)
+		) [[unlikely]] {
+			return false;
+		}
+		auto &queue {disk.queue[request.queue]};
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {queue.vq.lock};
+		// Block layer never starts more than depth requests
+		if (0_usize == queue.freeCount) [[unlikely]] {
+			return false;
+		}
+		const auto id		{queue.free[--queue.freeCount]};
+		auto &slot		{queue.slots[id]};
+		slot.request		= &request;
+		slot.header.type	= (sys::deviceOp_t::READ == request.op) ? VIRTBLK_T_IN : VIRTBLK_T_OUT;
+		slot.header.reserved	= 0_u32;
+		slot.header.sector	= request.sector;
+		slot.status		= VIRTBLK_S_NONE;
+		request.driver		= &slot;
+		// Header, data segments, status
+		const auto dataFlags	{(sys::deviceOp_t::READ == request.op) ? VIRTQ_DESC_F_WRITE : 0_u16};
+		auto count		{0_usize};
+		slot.table[count]	= {pciBusAddress(&slot.header), sizeof(virtblkHeader_t), VIRTQ_DESC_F_NEXT, static_cast<igros_word_t>(count + 1_usize)};
+		count++;
+		for (auto bio {request.first}; nullptr != bio; bio = bio->next) {
+			slot.table[count] = {
+				pciBusAddress(bio->buffer),
+				bio->count << sys::BLOCK_SECTOR_SHIFT,
+				static_cast<igros_word_t>(VIRTQ_DESC_F_NEXT | dataFlags),
+				static_cast<igros_word_t>(count + 1_usize)
+			};
+			count++;
+		}
+		slot.table[count]	= {pciBusAddress(&slot.status), sizeof(slot.status), VIRTQ_DESC_F_WRITE, 0_u16};
+		count++;
+		// Ring descriptor of slot always points to its table
+		queue.vq.desc[id].length = static_cast<igros_dword_t>(count * sizeof(virtqDesc_t));
+		virtqPush(queue.vq, id);
+		return true;
+	}
+
+	// Publish started requests and kick device if it asked for it
+	static void virtblkCommit(sys::blockDevice_t &dev, const igros_usize_t index) noexcept {
+		auto &queue {static_cast<virtblk_t*>(dev.data)->queue[index]};
+		auto notify {false};
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {queue.vq.lock};
+			notify = virtqPublish(queue.vq);
+		}
+		// Port write exits to hypervisor, keep it out of lock
+		if (notify) {
+			virtqNotify(queue.vq);
+		}
+	}
+
+	// Block driver operations
+	static constexpr sys::blockOps_t	virtblkOps	{virtblkQueueRq, virtblkCommit};
+
+
+	// Complete finished requests of virtqueue
+	static void virtblkDrain(virtblkQueue_t &queue) noexcept {
+		for (auto more {true}; more;) {
+			std::array<sys::blockRequest_t*, VIRTBLK_DEPTH> done {};
+			auto failed	{0_u32};
+			auto count	{0_usize};
+			{
+				const klib::kIRQLockGuard<klib::kSpinlock<>> guard {queue.vq.lock};
+				virtqUsedElem_t elem {};
+				while ((count < VIRTBLK_DEPTH) && virtqPop(queue.vq, elem)) {
+					if (elem.id >= VIRTBLK_DEPTH) [[unlikely]] {
+						continue;
+					}
+					auto &slot {queue.slots[elem.id]};
+					if (VIRTBLK_S_OK != slot.status) [[unlikely]] {
+						failed |= 1_u32 << count;
+					}
+					done[count++]				= slot.request;
+					queue.free[queue.freeCount++]		= static_cast<igros_word_t>(elem.id);
+				}
+				// Interrupt suppressed till ring is drained (coalesces completions)
+				more = virtqArm(queue.vq);
+			}
+			// Completion starts next requests, which takes queue lock
+			for (auto i {0_usize}; i < count; i++) {
+				sys::blockComplete(*done[i], 0_u32 != (failed & (1_u32 << i)));
+			}
+		}
+	}
+
+	// Interrupt handler (line may be shared)
+	[[nodiscard]]
+	static auto virtblkInterruptHandler([[maybe_unused]] const register_t* const regs, const igros_pointer_t cookie) noexcept -> irq::return_t {
+		auto &disk {*static_cast<virtblk_t*>(cookie)};
+		// Read also lowers line
+		if (0_u8 == (virtioISR(disk.virtio) & (VIRTIO_ISR_QUEUE | VIRTIO_ISR_CONFIG))) {
+			return irq::return_t::NONE;
+		}
+		for (auto i {0_usize}; i < disk.queues; i++) {
+			virtblkDrain(disk.queue[i]);
+		}
+		return irq::return_t::HANDLED;
+	}
+
+	// Virtqueue message interrupt handler (vector is not shared)
+	[[nodiscard]]
+	static auto virtblkQueueInterruptHandler([[maybe_unused]] const register_t* const regs, const igros_pointer_t cookie) noexcept -> irq::return_t {
+		virtblkDrain(*static_cast<virtblkQueue_t*>(cookie));
+		return irq::return_t::HANDLED;
+	}
+
+	// Release interrupts of disk
+	static void virtblkInterruptsRelease(virtblk_t &disk) noexcept {
+		if (0_usize != disk.msi.count) {
+			pciMsiDisable(disk.msi);
+			return;
+		}
+		irq::get().remove(static_cast<irq::irq_t>(disk.irq), virtblkInterruptHandler, &disk);
+	}
+
+
+	// Probe read done
+	static void virtblkCheckDone(sys::blockBio_t &bio) noexcept {
+		const auto disk		{static_cast<virtblk_t*>(bio.arg)};
+		const auto sector	{static_cast<const igros_byte_t*>(bio.buffer)};
+		klib::kprintf(
+			"VIRTIO-BLK:\t%s: sector 0 read %s, signature 0x%x\n",
+			disk->name.data(),
+			bio.failed ? "failed" : "ok",
+			(static_cast<igros_dword_t>(sector[511]) << 8) | sector[510]
+		);
+		arch::paging::get().deallocate(bio.buffer);
+	}
+
+	// Read first sector through whole stack
+	static void virtblkCheck(virtblk_t &disk) noexcept {
+		const auto page {arch::paging::get().allocate()};
+		if (nullptr == page) [[unlikely]] {
+			return;
+		}
+		disk.check.sector	= 0_u64;
+		disk.check.count	= 1_u32;
+		disk.check.op		= sys::deviceOp_t::READ;
+		disk.check.buffer	= page;
+		disk.check.complete	= virtblkCheckDone;
+		disk.check.arg		= &disk;
+		sys::blockSubmit(disk.block, disk.check);
+	}
+
+
+	// Setup virtqueue and its slots
+	[[nodiscard]]
+	static auto virtblkQueueSetup(virtblk_t &disk, const igros_usize_t index) noexcept -> bool {
+		auto &queue {disk.queue[index]};
+		auto &ring {virtblkRings[virtblkCount * VIRTBLK_QUEUES_MAX + index]};
+		if (!virtqSetup(disk.virtio, queue.vq, static_cast<igros_word_t>(index), ring.data(), ring.size())) [[unlikely]] {
+			return false;
+		}
+		// MSI-X entry N belongs to virtqueue N
+		if ((0_usize != disk.msi.count) && !virtqSetVector(disk.virtio, queue.vq, static_cast<igros_word_t>(index))) [[unlikely]] {
+			return false;
+		}
+		// Descriptor N is fixed to slot N table
+		const auto slots {(queue.vq.size < VIRTBLK_DEPTH) ? static_cast<igros_usize_t>(queue.vq.size) : VIRTBLK_DEPTH};
+		queue.freeCount = 0_usize;
+		for (auto i {slots}; i-- > 0_usize;) {
+			queue.vq.desc[i]		= {pciBusAddress(queue.slots[i].table.data()), 0_u32, VIRTQ_DESC_F_INDIRECT, 0_u16};
+			queue.free[queue.freeCount++]	= static_cast<igros_word_t>(i);
+		}
+		disk.block.depth = (slots < disk.block.depth) ? slots : disk.block.depth;
+		return true;
+	}
+
+	// Probe virtio block function
+	[[nodiscard]]
+	static auto virtblkProbe(pciDevice_t &pci) noexcept -> bool {
+		if ((virtblkCount >= VIRTBLK_DEVICES_MAX) || !pciBARIsIO(pci, 0_usize)) [[unlikely]] {
+			return false;
+		}
+		auto &disk		{virtblkDevices[virtblkCount]};
+		disk.virtio.base	= static_cast<io::port_t>(pciBAR(pci, 0_usize));
+		disk.irq		= pci.irq;
+		pciEnable(pci, PCI_COMMAND_IO | PCI_COMMAND_MASTER);
+		const auto features	{virtioBegin(disk.virtio, VIRTIO_F_INDIRECT_DESC | VIRTIO_F_EVENT_IDX | VIRTBLK_F_SEG_MAX | VIRTBLK_F_RO | VIRTBLK_F_MQ)};
+		// Scatter-gather relies on indirect tables
+		if (0_u32 == (features & VIRTIO_F_INDIRECT_DESC)) [[unlikely]] {
+			klib::kprintf("VIRTIO-BLK:\tno indirect descriptors\n");
+			virtioFail(disk.virtio);
+			return false;
+		}
+		// Limits
+		auto queues		{(0_u32 != (features & VIRTBLK_F_MQ)) ? static_cast<igros_usize_t>(virtioConfig16(disk.virtio, VIRTBLK_CONFIG_NUM_QUEUES)) : 1_usize};
+		queues			= (0_usize == queues) ? 1_usize : ((queues > VIRTBLK_QUEUES_MAX) ? VIRTBLK_QUEUES_MAX : queues);
+		auto segments		{VIRTBLK_SEGMENTS_MAX};
+		if (0_u32 != (features & VIRTBLK_F_SEG_MAX)) {
+			const auto limit	{static_cast<igros_usize_t>(virtioConfig32(disk.virtio, VIRTBLK_CONFIG_SEG_MAX))};
+			segments		= (0_usize == limit) ? 1_usize : ((limit < segments) ? limit : segments);
+		}
+		disk.readOnly		= 0_u32 != (features & VIRTBLK_F_RO);
+		disk.block.depth	= VIRTBLK_DEPTH;
+		// Message interrupt per virtqueue (virtio signals through MSI-X only)
+		std::array<igros_pointer_t, VIRTBLK_QUEUES_MAX> cookies {};
+		for (auto i {0_usize}; i < queues; i++) {
+			cookies[i] = &disk.queue[i];
+		}
+		if ((0_usize != pciMsiEnable(pci, disk.msi, queues, virtblkQueueInterruptHandler, cookies.data())) && (nullptr == disk.msi.table)) {
+			pciMsiDisable(disk.msi);
+		}
+		if (0_usize != disk.msi.count) {
+			// Queue without own vector would never complete
+			queues = (disk.msi.count < queues) ? disk.msi.count : queues;
+			virtioMsix(disk.virtio, true);
+			static_cast<void>(virtioSetConfigVector(disk.virtio, VIRTIO_MSI_NO_VECTOR));
+		} else if ((PCI_IRQ_NONE == pci.irq) || (pci.irq >= 16_u8)) [[unlikely]] {
+			klib::kprintf("VIRTIO-BLK:\tno legacy interrupt\n");
+			virtioFail(disk.virtio);
+			return false;
+		}
+		// Virtqueues
+		disk.queues		= 0_usize;
+		while ((disk.queues < queues) && virtblkQueueSetup(disk, disk.queues)) {
+			disk.queues++;
+		}
+		if (0_usize == disk.queues) [[unlikely]] {
+			klib::kprintf("VIRTIO-BLK:\tunsupported queue size\n");
+			pciMsiDisable(disk.msi);
+			virtioFail(disk.virtio);
+			return false;
+		}
+		// Legacy interrupt (shared by all virtqueues)
+		if (0_usize == disk.msi.count) {
+			if (!irq::get().add(static_cast<irq::irq_t>(disk.irq), virtblkInterruptHandler, &disk)) [[unlikely]] {
+				klib::kprintf("VIRTIO-BLK:\tno free IRQ handler slot!\n");
+				virtioFail(disk.virtio);
+				return false;
+			}
+			// Mask line (and slave PIC cascade) to let it through
+			irq::get().mask(static_cast<irq::irq_t>(disk.irq));
+			if (disk.irq >= 8_u8) {
+				irq::get().mask(irq::irq_t::PIC);
+			}
+		}
+		virtioReady(disk.virtio);
+		// Block device
+		disk.name		= {'v', 'd', static_cast<char>('a' + virtblkCount), '\0'};
+		disk.block.device.name	= disk.name.data();
+		disk.block.ops		= &virtblkOps;
+		disk.block.data		= &disk;
+		disk.block.sectors	= virtioConfig64(disk.virtio, VIRTBLK_CONFIG_CAPACITY);
+		disk.block.queues	= disk.queues;
+		disk.block.segments	= segments;
+		if (!sys::blockRegister(disk.block)) [[unlikely]] {
+			virtblkInterruptsRelease(disk);
+			virtioFail(disk.virtio);
+			return false;
+		}
+		virtblkCount++;
+		klib::kprintf(
+			"VIRTIO-BLK:\t%s: %llu MiB, %z segment(s)%s%s%s\n",
+			disk.name.data(),
+			disk.block.sectors >> (20_u32 - sys::BLOCK_SECTOR_SHIFT),
+			segments,
+			(0_usize != disk.msi.count) ? ", MSI-X" : "",
+			(0_u32 != (features & VIRTIO_F_EVENT_IDX)) ? ", event index" : "",
+			disk.readOnly ? ", read-only" : ""
+		);
+		virtblkCheck(disk);
+		return true;
+	}
+
+
+	// Virtio block PCI driver
+	static pciDriver_t	virtblkDriver	{"virtio-blk", VIRTIO_VENDOR_ID, VIRTBLK_DEVICE_ID, PCI_ANY_CLASS, PCI_ANY_CLASS, virtblkProbe, nullptr};
+
+
+	// Register virtio block driver
+	void virtioBlkSetup() noexcept {
+		pciRegisterDriver(virtblkDriver);
+	}
+
+
+}	// namespace igros::arch
+
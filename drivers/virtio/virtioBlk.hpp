@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////////
+//
+//	Virtio block device driver
+//
+//	File:	virtioBlk.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// Arch-dependent code zone
+namespace igros::arch {
+
+
+	// Virtio block driver
+	//
+	// Every virtqueue serves one block layer hardware queue. Request takes
+	// single ring descriptor pointing to indirect table of header, one entry
+	// per merged bio and status, so scatter-gather never runs ring out of
+	// descriptors. Descriptor N always points to table of request slot N, so
+	// used element directly names finished slot. Requests started by one
+	// dispatch pass are published and kicked once. With MSI-X every queue
+	// has own vector routed to CPU submitting to it, so completions of
+	// different queues neither share line nor read interrupt status, legacy
+	// line is used otherwise. Disks are registered as
+	// "vda", "vdb", ... and read their first sector at probe as smoke test
+	// (attach raw image with "-drive file=disk.img,if=virtio,format=raw")
+
+
+	// Register virtio block driver
+	void	virtioBlkSetup() noexcept;
+
+
+}	// namespace igros::arch
+
@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////////
+///
+///	@brief		IgrOS kernel atomic reference
+///
+///	@file		kAtomic.hpp
+///	@date		19 Oct 2026
+///
+///	@copyright	Copyright (c) 2017 - 2022,
+///			All rights reserved.
+///	@author		Igor Baklykov
+///
+///
+
+
+#pragma once
+
+
+// C++
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/atomic.hpp>
+#include <arch/types.hpp>
+
+
+////////////////////////////////////////////////////////////////
+///
+/// @brief IgrOS Kernel Library namespace
+/// @namespace igros::klib
+///
+namespace igros::klib {
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Memory order of atomic operation
+	/// @enum kMemoryOrder
+	///
+	/// @note x86 keeps loads after loads and stores after stores, so plain
+	/// loads are acquire and plain stores are release. Only sequentially
+	/// consistent store needs full barrier, read-modify-write operations are
+	/// always locked (full barrier) whatever order is asked
+	///
+	enum class kMemoryOrder : igros_dword_t {
+		RELAXED,	///< Atomicity only
+		ACQUIRE,	///< Later accesses stay after load
+		RELEASE,	///< Earlier accesses stay before store
+		ACQ_REL,	///< Both acquire and release
+		SEQ_CST		///< Single total order (full barrier)
+	};
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Atomic access to plain object (std::atomic_ref like)
+	/// @class kAtomicRef
+	/// @tparam T Unsigned integer not wider than machine word
+	///
+	/// @note Object must be naturally aligned and outlive reference. Wider
+	/// values (e.g. 64-bit counters on i386) need kSeqlock
+	///
+	template<typename T>
+	class kAtomicRef final {
+
+		static_assert(
+			std::is_same_v<T, igros_dword_t> || (std::is_same_v<T, igros_quad_t> && (sizeof(igros_quad_t) == sizeof(igros_usize_t))),
+			"Atomic reference type must be dword or machine word sized quad!"
+		);
+
+		T* const	mObject;		///< Referenced object
+
+		// No copy assignment
+		auto	operator=(const kAtomicRef &other) -> kAtomicRef& = delete;
+
+
+	public:
+
+		/// @brief Reference to object
+		explicit kAtomicRef(T &object) noexcept;
+
+		/// @brief Copy c-tor (refers same object)
+		kAtomicRef(const kAtomicRef &other) noexcept = default;
+
+		/// @brief Atomically load value
+		[[nodiscard]]
+		auto	load(const kMemoryOrder order = kMemoryOrder::SEQ_CST) const noexcept -> T;
+		/// @brief Atomically store value
+		void	store(const T value, const kMemoryOrder order = kMemoryOrder::SEQ_CST) const noexcept;
+
+		/// @brief Atomically exchange value
+		auto	exchange(const T value, const kMemoryOrder order = kMemoryOrder::SEQ_CST) const noexcept -> T;
+		/// @brief Atomically compare and exchange value
+		auto	compareExchange(T &expected, const T desired, const kMemoryOrder order = kMemoryOrder::SEQ_CST) const noexcept -> bool;
+
+		/// @brief Atomically add to value
+		auto	fetchAdd(const T value, const kMemoryOrder order = kMemoryOrder::SEQ_CST) const noexcept -> T;
+		/// @brief Atomically subtract from value
+		auto	fetchSub(const T value, const kMemoryOrder order = kMemoryOrder::SEQ_CST) const noexcept -> T;
+
+		/// @brief Atomically set bits
+		void	bitOr(const T value, const kMemoryOrder order = kMemoryOrder::SEQ_CST) const noexcept;
+		/// @brief Atomically clear bits
+		void	bitAnd(const T value, const kMemoryOrder order = kMemoryOrder::SEQ_CST) const noexcept;
+
+
+	};
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Reference to object
+	/// @param[in] object Object to access atomically
+	///
+	template<typename T>
+	inline kAtomicRef<T>::kAtomicRef(T &object) noexcept
+		: mObject {&object} {}
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Atomically load value
+	/// @param[in] order Memory order (every load is acquire on x86)
+	/// @return Loaded value
+	///
+	template<typename T>
+	[[nodiscard]]
+	inline auto kAtomicRef<T>::load([[maybe_unused]] const kMemoryOrder order) const noexcept -> T {
+		return arch::atomic::get().load(mObject);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Atomically store value
+	/// @param[in] value New value
+	/// @param[in] order Memory order (only sequentially consistent store is fenced)
+	///
+	template<typename T>
+	inline void kAtomicRef<T>::store(const T value, const kMemoryOrder order) const noexcept {
+		if (kMemoryOrder::SEQ_CST == order) {
+			arch::atomic::get().store(mObject, value);
+		} else {
+			arch::atomic::get().storeRelease(mObject, value);
+		}
+	}
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Atomically exchange value
+	/// @param[in] value New value
+	/// @param[in] order Memory order (always full barrier)
+	/// @return Old value
+	///
+	template<typename T>
+	inline auto kAtomicRef<T>::exchange(const T value, [[maybe_unused]] const kMemoryOrder order) const noexcept -> T {
+		return arch::atomic::get().exchange(mObject, value);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Atomically compare and exchange value
+	/// @param[in,out] expected Expected value (updated with current one on failure)
+	/// @param[in] desired New value
+	/// @param[in] order Memory order (always full barrier)
+	/// @return true if value was exchanged
+	///
+	template<typename T>
+	inline auto kAtomicRef<T>::compareExchange(T &expected, const T desired, [[maybe_unused]] const kMemoryOrder order) const noexcept -> bool {
+		const auto old {arch::atomic::get().compareExchange(mObject, expected, desired)};
+		if (old == expected) {
+			return true;
+		}
+		expected = old;
+		return false;
+	}
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Atomically add to value
+	/// @param[in] value Addend
+	/// @param[in] order Memory order (always full barrier)
+	/// @return Old value
+	///
+	template<typename T>
+	inline auto kAtomicRef<T>::fetchAdd(const T value, [[maybe_unused]] const kMemoryOrder order) const noexcept -> T {
+		return arch::atomic::get().fetchAdd(mObject, value);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Atomically subtract from value
+	/// @param[in] value Subtrahend
+	/// @param[in] order Memory order (always full barrier)
+	/// @return Old value
+	///
+	template<typename T>
+	inline auto kAtomicRef<T>::fetchSub(const T value, [[maybe_unused]] const kMemoryOrder order) const noexcept -> T {
+		// Unsigned wrap around
+		return arch::atomic::get().fetchAdd(mObject, static_cast<T>(~value + 1_u32));
+	}
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Atomically set bits
+	/// @param[in] value Bits to set
+	/// @param[in] order Memory order (always full barrier)
+	///
+	template<typename T>
+	inline void kAtomicRef<T>::bitOr(const T value, [[maybe_unused]] const kMemoryOrder order) const noexcept {
+		arch::atomic::get().bitOr(mObject, value);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Atomically clear bits
+	/// @param[in] value Bits to keep
+	/// @param[in] order Memory order (always full barrier)
+	///
+	template<typename T>
+	inline void kAtomicRef<T>::bitAnd(const T value, [[maybe_unused]] const kMemoryOrder order) const noexcept {
+		arch::atomic::get().bitAnd(mObject, value);
+	}
+
+
+}	// namespace igros::klib
+
@@ -0,0 +1,724 @@
+////////////////////////////////////////////////////////////////
+///
+///	@brief		IgrOS kernel locks (spinlock, ticket lock, MCS lock)
+///
+///	@file		kLock.hpp
+///	@date		19 Oct 2026
+///
+///	@copyright	Copyright (c) 2017 - 2022,
+///			All rights reserved.
+///	@author		Igor Baklykov
+///
+///
+
+
+#pragma once
+
+
+// C++
+#include <bit>
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/atomic.hpp>
+#include <arch/cpu.hpp>
+#include <arch/irq.hpp>
+#include <arch/types.hpp>
+// IgrOS-Kernel library
+#include <klib/kprint.hpp>
+
+
+////////////////////////////////////////////////////////////////
+///
+/// @brief IgrOS Kernel Library namespace
+/// @namespace igros::klib
+///
+namespace igros::klib {
+
+
+	/// @brief Initial spin backoff (in PAUSE instructions)
+	constexpr auto KLOCK_BACKOFF_MIN	{1_u32};
+	/// @brief Maximal spin backoff (in PAUSE instructions)
+	constexpr auto KLOCK_BACKOFF_MAX	{1024_u32};
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Lock statistics disabled (default, zero overhead)
+	/// @class kLockNoStats
+	///
+	class kLockNoStats final {
+
+	public:
+
+		/// @brief Statistics collection flag
+		constexpr static auto ENABLED {false};
+
+		/// @brief Lock acquired
+		constexpr void	acquired(const igros_quad_t /*start*/, const bool /*contended*/) noexcept {}
+		/// @brief Lock is about to be released
+		constexpr void	released() noexcept {}
+
+
+	};
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Lock contention statistics
+	/// @class kLockStats
+	///
+	/// @note Updated only by lock owner (no atomics needed)
+	///
+	class kLockStats final {
+
+		igros_quad_t	mAcquires	{0_u64};	///< Number of acquisitions
+		igros_quad_t	mContended	{0_u64};	///< Number of contended acquisitions
+		igros_quad_t	mSpinCycles	{0_u64};	///< Total TSC cycles spent spinning
+		igros_quad_t	mMaxHold	{0_u64};	///< Maximal TSC cycles lock was held
+		igros_quad_t	mAcquiredAt	{0_u64};	///< TSC value at last acquisition
+
+
+	public:
+
+		/// @brief Statistics collection flag
+		constexpr static auto ENABLED {true};
+
+		/// @brief Lock acquired
+		void	acquired(const igros_quad_t start, const bool contended) noexcept;
+		/// @brief Lock is about to be released
+		void	released() noexcept;
+
+		/// @brief Get number of acquisitions
+		[[nodiscard]]
+		constexpr auto	acquires() const noexcept -> igros_quad_t;
+		/// @brief Get number of contended acquisitions
+		[[nodiscard]]
+		constexpr auto	contended() const noexcept -> igros_quad_t;
+		/// @brief Get total spin cycles
+		[[nodiscard]]
+		constexpr auto	spinCycles() const noexcept -> igros_quad_t;
+		/// @brief Get maximal hold cycles
+		[[nodiscard]]
+		constexpr auto	maxHold() const noexcept -> igros_quad_t;
+
+		/// @brief Print statistics
+		void	dump(const char* const name) const noexcept;
+
+
+	};
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Lock acquired
+	/// @param[in] start TSC value before spinning started
+	/// @param[in] contended Lock was not free at first attempt
+	///
+	inline void kLockStats::acquired(const igros_quad_t start, const bool contended) noexcept {
+		// Timestamp
+		mAcquiredAt	= arch::cpu::get().timestamp();
+		// Update counters
+		mAcquires++;
+		if (contended) {
+			mContended++;
+			mSpinCycles += mAcquiredAt - start;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Lock is about to be released
+	///
+	inline void kLockStats::released() noexcept {
+		// Track longest hold
+		if (const auto hold {arch::cpu::get().timestamp() - mAcquiredAt}; hold > mMaxHold) {
+			mMaxHold = hold;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Get number of acquisitions
+	/// @return Number of acquisitions
+	///
+	[[nodiscard]]
+	constexpr auto kLockStats::acquires() const noexcept -> igros_quad_t {
+		return mAcquires;
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Get number of contended acquisitions
+	/// @return Number of acquisitions that had to spin
+	///
+	[[nodiscard]]
+	constexpr auto kLockStats::contended() const noexcept -> igros_quad_t {
+		return mContended;
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Get total spin cycles
+	/// @return TSC cycles spent waiting for lock
+	///
+	[[nodiscard]]
+	constexpr auto kLockStats::spinCycles() const noexcept -> igros_quad_t {
+		return mSpinCycles;
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Get maximal hold cycles
+	/// @return Longest TSC cycles lock was held
+	///
+	[[nodiscard]]
+	constexpr auto kLockStats::maxHold() const noexcept -> igros_quad_t {
+		return mMaxHold;
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Print statistics
+	/// @param[in] name Lock name
+	///
+	inline void kLockStats::dump(const char* const name) const noexcept {
+		kprintf(
+			"LOCK %s:\tacquires %llu, contended %llu, spin %llu, max hold %llu",
+			name,
+			mAcquires,
+			mContended,
+			mSpinCycles,
+			mMaxHold
+		);
+	}
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Test-and-test-and-set spinlock with exponential PAUSE backoff
+	/// @class kSpinlock
+	/// @tparam S Lock statistics policy
+	///
+	template<class S = kLockNoStats>
+	class kSpinlock final {
+
+		igros_dword_t			mLocked	{0_u32};	///< Lock word
+		[[no_unique_address]] S		mStats	{};		///< Lock statistics
+
+		/// @brief No copy construction
+		kSpinlock(const kSpinlock &other) = delete;
+		/// @brief No copy assignment
+		kSpinlock& operator=(const kSpinlock &other) = delete;
+
+		/// @brief No move construction
+		kSpinlock(kSpinlock &&other) = delete;
+		/// @brief No move assignment
+		kSpinlock& operator=(kSpinlock &&other) = delete;
+
+
+	public:
+
+		/// @brief Default c-tor
+		constexpr kSpinlock() noexcept = default;
+
+		/// @brief Acquire lock
+		void	lock() noexcept;
+		/// @brief Try to acquire lock
+		[[nodiscard]]
+		bool	tryLock() noexcept;
+		/// @brief Release lock
+		void	unlock() noexcept;
+
+		/// @brief Check if lock is held
+		[[nodiscard]]
+		bool	isLocked() const noexcept;
+
+		/// @brief Get lock statistics
+		[[nodiscard]]
+		constexpr auto	stats() const noexcept -> const S&;
+
+
+	};
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Acquire lock
+	///
+	/// @note Spins on plain loads so the cache line stays shared while lock is held
+	///
+	template<class S>
+	inline void kSpinlock<S>::lock() noexcept {
+		// Spin start timestamp
+		auto start	{0_u64};
+		if constexpr (S::ENABLED) {
+			start = arch::cpu::get().timestamp();
+		}
+		// Fast path
+		auto contended	{false};
+		auto backoff	{KLOCK_BACKOFF_MIN};
+		while (0_u32 != arch::atomic::get().exchange(&mLocked, 1_u32)) {
+			contended = true;
+			// Wait till lock looks free
+			do {
+				for (auto i {0_u32}; i < backoff; i++) {
+					arch::cpu::get().pause();
+				}
+				backoff = (backoff < KLOCK_BACKOFF_MAX) ? (backoff << 1) : KLOCK_BACKOFF_MAX;
+			} while (0_u32 != arch::atomic::get().load(&mLocked));
+		}
+		// Update statistics
+		mStats.acquired(start, contended);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Try to acquire lock
+	/// @return @c true if lock was acquired
+	///
+	template<class S>
+	[[nodiscard]]
+	inline bool kSpinlock<S>::tryLock() noexcept {
+		// Don't bother with locked bus cycle if lock is busy
+		if (
+			(0_u32 != arch::atomic::get().load(&mLocked))	||
+			(0_u32 != arch::atomic::get().exchange(&mLocked, 1_u32))
+		) {
+			return false;
+		}
+		// Update statistics
+		mStats.acquired(0_u64, false);
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Release lock
+	///
+	template<class S>
+	inline void kSpinlock<S>::unlock() noexcept {
+		// Update statistics
+		mStats.released();
+		// Release
+		arch::atomic::get().store(&mLocked, 0_u32);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Check if lock is held
+	/// @return @c true if lock is held by someone
+	///
+	template<class S>
+	[[nodiscard]]
+	inline bool kSpinlock<S>::isLocked() const noexcept {
+		return 0_u32 != arch::atomic::get().load(&mLocked);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Get lock statistics
+	/// @return Statistics policy object
+	///
+	template<class S>
+	[[nodiscard]]
+	constexpr auto kSpinlock<S>::stats() const noexcept -> const S& {
+		return mStats;
+	}
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief FIFO-fair ticket lock
+	/// @class kTicketLock
+	/// @tparam S Lock statistics policy
+	///
+	template<class S = kLockNoStats>
+	class kTicketLock final {
+
+		igros_dword_t			mNext		{0_u32};	///< Next ticket to hand out
+		igros_dword_t			mServing	{0_u32};	///< Ticket being served
+		[[no_unique_address]] S		mStats		{};		///< Lock statistics
+
+		/// @brief No copy construction
+		kTicketLock(const kTicketLock &other) = delete;
+		/// @brief No copy assignment
+		kTicketLock& operator=(const kTicketLock &other) = delete;
+
+		/// @brief No move construction
+		kTicketLock(kTicketLock &&other) = delete;
+		/// @brief No move assignment
+		kTicketLock& operator=(kTicketLock &&other) = delete;
+
+
+	public:
+
+		/// @brief Default c-tor
+		constexpr kTicketLock() noexcept = default;
+
+		/// @brief Acquire lock
+		void	lock() noexcept;
+		/// @brief Try to acquire lock
+		[[nodiscard]]
+		bool	tryLock() noexcept;
+		/// @brief Release lock
+		void	unlock() noexcept;
+
+		/// @brief Check if lock is held
+		[[nodiscard]]
+		bool	isLocked() const noexcept;
+
+		/// @brief Get lock statistics
+		[[nodiscard]]
+		constexpr auto	stats() const noexcept -> const S&;
+
+
+	};
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Acquire lock
+	///
+	/// @note Backoff is proportional to number of waiters ahead of us
+	///
+	template<class S>
+	inline void kTicketLock<S>::lock() noexcept {
+		// Spin start timestamp
+		auto start	{0_u64};
+		if constexpr (S::ENABLED) {
+			start = arch::cpu::get().timestamp();
+		}
+		// Take a ticket
+		const auto ticket	{arch::atomic::get().fetchAdd(&mNext, 1_u32)};
+		auto contended		{false};
+		// Wait for our turn
+		for (auto serving {arch::atomic::get().load(&mServing)}; ticket != serving; serving = arch::atomic::get().load(&mServing)) {
+			contended = true;
+			for (auto i {ticket - serving}; i > 0_u32; i--) {
+				arch::cpu::get().pause();
+			}
+		}
+		// Update statistics
+		mStats.acquired(start, contended);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Try to acquire lock
+	/// @return @c true if lock was acquired
+	///
+	template<class S>
+	[[nodiscard]]
+	inline bool kTicketLock<S>::tryLock() noexcept {
+		// Take a ticket only if it would be served immediately
+		const auto serving {arch::atomic::get().load(&mServing)};
+		if (serving != arch::atomic::get().compareExchange(&mNext, serving, serving + 1_u32)) {
+			return false;
+		}
+		// Update statistics
+		mStats.acquired(0_u64, false);
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Release lock
+	///
+	template<class S>
+	inline void kTicketLock<S>::unlock() noexcept {
+		// Update statistics
+		mStats.released();
+		// Only owner modifies served ticket
+		arch::atomic::get().store(&mServing, arch::atomic::get().load(&mServing) + 1_u32);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Check if lock is held
+	/// @return @c true if lock is held by someone
+	///
+	template<class S>
+	[[nodiscard]]
+	inline bool kTicketLock<S>::isLocked() const noexcept {
+		return arch::atomic::get().load(&mNext) != arch::atomic::get().load(&mServing);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Get lock statistics
+	/// @return Statistics policy object
+	///
+	template<class S>
+	[[nodiscard]]
+	constexpr auto kTicketLock<S>::stats() const noexcept -> const S& {
+		return mStats;
+	}
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief MCS queue lock node (one per waiter, lives on waiter stack)
+	/// @struct kMCSNode
+	///
+	struct kMCSNode {
+		igros_usize_t	next	{0_usize};	///< Next waiter node address
+		igros_dword_t	locked	{0_u32};	///< Waiting flag (spun on locally)
+	};
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief MCS queue lock (each waiter spins on its own cache line)
+	/// @class kMCSLock
+	/// @tparam S Lock statistics policy
+	///
+	template<class S = kLockNoStats>
+	class kMCSLock final {
+
+		igros_usize_t			mTail	{0_usize};	///< Last waiter node address
+		[[no_unique_address]] S		mStats	{};		///< Lock statistics
+
+		/// @brief No copy construction
+		kMCSLock(const kMCSLock &other) = delete;
+		/// @brief No copy assignment
+		kMCSLock& operator=(const kMCSLock &other) = delete;
+
+		/// @brief No move construction
+		kMCSLock(kMCSLock &&other) = delete;
+		/// @brief No move assignment
+		kMCSLock& operator=(kMCSLock &&other) = delete;
+
+
+	public:
+
+		/// @brief Queue node type
+		using node_t = kMCSNode;
+
+		/// @brief Default c-tor
+		constexpr kMCSLock() noexcept = default;
+
+		/// @brief Acquire lock
+		void	lock(node_t &node) noexcept;
+		/// @brief Try to acquire lock
+		[[nodiscard]]
+		bool	tryLock(node_t &node) noexcept;
+		/// @brief Release lock
+		void	unlock(node_t &node) noexcept;
+
+		/// @brief Check if lock is held
+		[[nodiscard]]
+		bool	isLocked() const noexcept;
+
+		/// @brief Get lock statistics
+		[[nodiscard]]
+		constexpr auto	stats() const noexcept -> const S&;
+
+
+	};
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Acquire lock
+	/// @param[in] node Waiter queue node (must stay valid till unlock)
+	///
+	template<class S>
+	inline void kMCSLock<S>::lock(node_t &node) noexcept {
+		// Spin start timestamp
+		auto start	{0_u64};
+		if constexpr (S::ENABLED) {
+			start = arch::cpu::get().timestamp();
+		}
+		// Prepare node
+		node.next	= 0_usize;
+		node.locked	= 1_u32;
+		// Enqueue self
+		const auto prev	{arch::atomic::get().exchange(&mTail, std::bit_cast<igros_usize_t>(&node))};
+		// Lock was free
+		if (0_usize == prev) [[likely]] {
+			mStats.acquired(start, false);
+			return;
+		}
+		// Link to predecessor and wait for hand-off
+		arch::atomic::get().store(&std::bit_cast<node_t*>(prev)->next, std::bit_cast<igros_usize_t>(&node));
+		while (0_u32 != arch::atomic::get().load(&node.locked)) {
+			arch::cpu::get().pause();
+		}
+		// Update statistics
+		mStats.acquired(start, true);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Try to acquire lock
+	/// @param[in] node Waiter queue node (must stay valid till unlock)
+	/// @return @c true if lock was acquired
+	///
+	template<class S>
+	[[nodiscard]]
+	inline bool kMCSLock<S>::tryLock(node_t &node) noexcept {
+		// Prepare node
+		node.next	= 0_usize;
+		node.locked	= 0_u32;
+		// Only succeed on empty queue
+		if (0_usize != arch::atomic::get().compareExchange(&mTail, 0_usize, std::bit_cast<igros_usize_t>(&node))) {
+			return false;
+		}
+		// Update statistics
+		mStats.acquired(0_u64, false);
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Release lock
+	/// @param[in] node Waiter queue node used to acquire lock
+	///
+	template<class S>
+	inline void kMCSLock<S>::unlock(node_t &node) noexcept {
+		// Update statistics
+		mStats.released();
+		// Get successor
+		auto next {arch::atomic::get().load(&node.next)};
+		if (0_usize == next) {
+			// No waiters - try to empty the queue
+			const auto self {std::bit_cast<igros_usize_t>(&node)};
+			if (self == arch::atomic::get().compareExchange(&mTail, self, 0_usize)) [[likely]] {
+				return;
+			}
+			// Successor is enqueueing - wait for it to link
+			while (0_usize == (next = arch::atomic::get().load(&node.next))) {
+				arch::cpu::get().pause();
+			}
+		}
+		// Hand lock off to successor
+		arch::atomic::get().store(&std::bit_cast<node_t*>(next)->locked, 0_u32);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Check if lock is held
+	/// @return @c true if lock is held by someone
+	///
+	template<class S>
+	[[nodiscard]]
+	inline bool kMCSLock<S>::isLocked() const noexcept {
+		return 0_usize != arch::atomic::get().load(&mTail);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Get lock statistics
+	/// @return Statistics policy object
+	///
+	template<class S>
+	[[nodiscard]]
+	constexpr auto kMCSLock<S>::stats() const noexcept -> const S& {
+		return mStats;
+	}
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Empty queue node for locks without one
+	/// @struct kLockNoNode
+	///
+	struct kLockNoNode {
+		/// @brief Queue node type
+		using node_t = kLockNoNode;
+	};
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Scoped lock guard
+	/// @class kLockGuard
+	/// @tparam L Lock type
+	/// @tparam IRQ Save and disable interrupts while lock is held
+	///
+	/// @warning Locks never disable preemption. Guard without IRQ must not
+	/// be held where holder may be preempted (disable it with percpuPreempt
+	/// around guard or use kIRQLockGuard), otherwise thread taking lock on
+	/// same CPU spins forever
+	///
+	template<class L, bool IRQ = false>
+	class kLockGuard final {
+
+		/// @brief Lock needs waiter queue node
+		constexpr static auto HAS_NODE {requires { typename L::node_t; }};
+
+		/// @brief Waiter queue node type
+		using node_t = typename std::conditional_t<HAS_NODE, L, kLockNoNode>::node_t;
+
+		L&					mLock;		///< Guarded lock
+		[[no_unique_address]] node_t		mNode	{};	///< Waiter queue node
+		igros_usize_t				mFlags	{};	///< Saved interrupts state
+
+		/// @brief No copy construction
+		kLockGuard(const kLockGuard &other) = delete;
+		/// @brief No copy assignment
+		kLockGuard& operator=(const kLockGuard &other) = delete;
+
+		/// @brief No move construction
+		kLockGuard(kLockGuard &&other) = delete;
+		/// @brief No move assignment
+		kLockGuard& operator=(kLockGuard &&other) = delete;
+
+
+	public:
+
+		/// @brief Acquire lock
+		explicit kLockGuard(L &lock) noexcept;
+		/// @brief Release lock
+		~kLockGuard() noexcept;
+
+
+	};
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Acquire lock
+	/// @param[in] lock Lock to acquire
+	///
+	template<class L, bool IRQ>
+	inline kLockGuard<L, IRQ>::kLockGuard(L &lock) noexcept
+		: mLock {lock} {
+		// Interrupt handler must not spin on lock held by interrupted code
+		if constexpr (IRQ) {
+			mFlags = arch::irq::get().save();
+		}
+		// Acquire
+		if constexpr (HAS_NODE) {
+			mLock.lock(mNode);
+		} else {
+			mLock.lock();
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Release lock
+	///
+	template<class L, bool IRQ>
+	inline kLockGuard<L, IRQ>::~kLockGuard() noexcept {
+		// Release
+		if constexpr (HAS_NODE) {
+			mLock.unlock(mNode);
+		} else {
+			mLock.unlock();
+		}
+		// Restore interrupts state
+		if constexpr (IRQ) {
+			arch::irq::get().restore(mFlags);
+		}
+	}
+
+
+	/// @brief Scoped lock guard with interrupts saved and disabled
+	template<class L>
+	using kIRQLockGuard = kLockGuard<L, true>;
+
+
+}	// namespace igros::klib
+
@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////////
+//
+//	Kernel read-copy-update
+//
+//	File:	kRCU.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+// IgrOS-Kernel arch
+#include <arch/cpu.hpp>
+#include <arch/irq.hpp>
+#include <arch/smp.hpp>
+// IgrOS-Kernel library
+#include <klib/kLock.hpp>
+#include <klib/kprint.hpp>
+#include <klib/kRCU.hpp>
+
+
+// Kernel library code zone
+namespace igros::klib {
+
+
+	// Per-CPU RCU state
+	struct alignas(64) kRCUCPU_t {
+		igros_usize_t	dynticks	{1_usize};	// Idle transitions counter (even - idle, odd - running)
+		igros_usize_t	snapshot	{0_usize};	// Idle transitions counter at grace period start
+		igros_usize_t	seen		{0_usize};	// Last grace period quiescent state was reported for
+		bool		idle		{false};	// CPU is idle
+		bool		irqIdle		{false};	// Outermost interrupt came from idle
+		igros_usize_t	irqNesting	{0_usize};	// Interrupt handlers nesting depth
+		kRCUHead*	nextHead	{nullptr};	// Callbacks not yet assigned to grace period
+		kRCUHead**	nextTail	{nullptr};	// ---//---
+		kRCUHead*	waitHead	{nullptr};	// Callbacks waiting for grace period
+		kRCUHead**	waitTail	{nullptr};	// ---//---
+		igros_usize_t	waitSeq		{0_usize};	// Grace period waiting callbacks need
+	};
+
+
+	// Per-CPU RCU states
+	static std::array<kRCUCPU_t, arch::smp::MAX_CPUS>	rcuCPUs {};
+
+	// Grace period state lock
+	static kSpinlock<>	rcuLock		{};
+	// Last started grace period
+	static igros_usize_t	rcuStarted	{0_usize};
+	// Last completed grace period
+	static igros_usize_t	rcuCompleted	{0_usize};
+	// Last requested grace period
+	static igros_usize_t	rcuRequested	{0_usize};
+	// CPUs that still have to pass quiescent state
+	static igros_usize_t	rcuPending	{0_usize};
+
+
+	// Complete grace period if all CPUs reported (lock held)
+	static void rcuTryComplete() noexcept {
+		if ((0_usize == rcuPending) && (rcuStarted != rcuCompleted)) {
+			arch::atomic::get().store(&rcuCompleted, rcuStarted);
+		}
+	}
+
+	// Start new grace period if requested (lock held)
+	static void rcuTryStart() noexcept {
+		// Grace period in progress or not needed
+		if ((rcuStarted != rcuCompleted) || (rcuRequested <= rcuCompleted)) {
+			return;
+		}
+		// New grace period
+		arch::atomic::get().store(&rcuStarted, rcuStarted + 1_usize);
+		// Wait only for online CPUs that are not idle right now
+		rcuPending = 0_usize;
+		for (auto i {0_usize}; i < rcuCPUs.size(); i++) {
+			if (!arch::smp::get().isOnline(i)) {
+				continue;
+			}
+			rcuCPUs[i].snapshot = arch::atomic::get().load(&rcuCPUs[i].dynticks);
+			if (0_usize != (rcuCPUs[i].snapshot & 1_usize)) {
+				rcuPending |= 1_usize << i;
+			}
+		}
+		// Everyone may be idle already
+		rcuTryComplete();
+	}
+
+	// Check CPUs which passed through idle since grace period start (lock held)
+	static void rcuCheckIdle() noexcept {
+		for (auto i {0_usize}; i < rcuCPUs.size(); i++) {
+			if (
+				(0_usize != (rcuPending & (1_usize << i)))				&&
+				(rcuCPUs[i].snapshot != arch::atomic::get().load(&rcuCPUs[i].dynticks))
+			) {
+				rcuPending &= ~(1_usize << i);
+			}
+		}
+		rcuTryComplete();
+	}
+
+	// Request grace period (lock held)
+	[[nodiscard]]
+	static auto rcuRequest() noexcept -> igros_usize_t {
+		// Grace period in progress may have started before caller removed data
+		const auto seq	{(rcuStarted != rcuCompleted) ? (rcuStarted + 1_usize) : (rcuCompleted + 1_usize)};
+		if (seq > rcuRequested) {
+			rcuRequested = seq;
+		}
+		rcuTryStart();
+		return seq;
+	}
+
+
+	// Queue callback to be called after grace period
+	void kRCU::call(kRCUHead* const head, const std::add_pointer_t<void (kRCUHead*)> func) noexcept {
+		// Prepare callback
+		head->next	= nullptr;
+		head->func	= func;
+		// Callback lists belong to current CPU
+		const auto flags	{arch::irq::get().save()};
+		auto &rcu		{rcuCPUs[arch::percpuID::read()]};
+		if (nullptr == rcu.nextHead) {
+			rcu.nextTail = &rcu.nextHead;
+		}
+		*rcu.nextTail	= head;
+		rcu.nextTail	= &head->next;
+		arch::irq::get().restore(flags);
+		// Caller may be reader, grace period is requested on next quiescent state
+	}
+
+	// Wait for grace period to elapse
+	void kRCU::synchronize() noexcept {
+		// Reader waiting for itself never finishes (and must not report quiescent state)
+		if (0_u32 != arch::percpuPreempt::read()) [[unlikely]] {
+			kprintf("RCU:		synchronize() inside read-side section! CPU halted!\n");
+			arch::cpu::get().halt();
+		}
+		// Request grace period
+		auto target {0_usize};
+		{
+			const kIRQLockGuard<kSpinlock<>> guard {rcuLock};
+			target = rcuRequest();
+		}
+		// Caller is not a reader, keep reporting until other CPUs do the same
+		while (arch::atomic::get().load(&rcuCompleted) < target) {
+			kRCU::quiescent();
+			arch::cpu::get().pause();
+		}
+	}
+
+
+	// Report quiescent state of current CPU unless preemption is disabled (and run ready callbacks)
+	void kRCU::quiescent() noexcept {
+
+		// Ready callbacks
+		auto ready	{static_cast<kRCUHead*>(nullptr)};
+
+		{
+			const kIRQLockGuard<kSpinlock<>> guard {rcuLock};
+
+			// Current CPU
+			const auto id	{arch::percpuID::read()};
+			auto &rcu	{rcuCPUs[id]};
+
+			// Report grace period in progress (not from inside read-side section)
+			if ((0_u32 == arch::percpuPreempt::read()) && (rcuStarted != rcuCompleted) && (rcu.seen != rcuStarted)) {
+				rcu.seen	= rcuStarted;
+				rcuPending	&= ~(1_usize << id);
+			}
+			rcuCheckIdle();
+			rcuTryStart();
+
+			// Waiting callbacks are ready
+			if ((nullptr != rcu.waitHead) && (rcu.waitSeq <= rcuCompleted)) {
+				ready		= rcu.waitHead;
+				rcu.waitHead	= nullptr;
+			}
+			// Assign new callbacks to grace period
+			if ((nullptr == rcu.waitHead) && (nullptr != rcu.nextHead)) {
+				rcu.waitHead	= rcu.nextHead;
+				rcu.waitTail	= rcu.nextTail;
+				rcu.nextHead	= nullptr;
+				rcu.waitSeq	= rcuRequest();
+			}
+		}
+
+		// Reclaim
+		while (nullptr != ready) {
+			const auto head	{ready};
+			ready		= ready->next;
+			head->func(head);
+		}
+
+	}
+
+
+	// Current CPU enters idle (extended quiescent state)
+	void kRCU::idleEnter() noexcept {
+		auto &rcu	{rcuCPUs[arch::percpuID::read()]};
+		rcu.idle	= true;
+		arch::atomic::get().fetchAdd(&rcu.dynticks, 1_usize);
+	}
+
+	// Current CPU leaves idle
+	void kRCU::idleExit() noexcept {
+		auto &rcu	{rcuCPUs[arch::percpuID::read()]};
+		arch::atomic::get().fetchAdd(&rcu.dynticks, 1_usize);
+		rcu.idle	= false;
+	}
+
+
+	// Interrupt handler entry (may interrupt idle or nest into softirqs of other handler)
+	void kRCU::irqEnter() noexcept {
+		auto &rcu {rcuCPUs[arch::percpuID::read()]};
+		// Only outermost handler changes state, nested one must not make counter even again
+		if (0_usize != rcu.irqNesting++) {
+			return;
+		}
+		// Handler may read RCU data, so idle CPU must look running
+		rcu.irqIdle = rcu.idle;
+		if (rcu.irqIdle) {
+			arch::atomic::get().fetchAdd(&rcu.dynticks, 1_usize);
+		}
+	}
+
+	// Interrupt handler exit
+	void kRCU::irqExit() noexcept {
+		auto &rcu {rcuCPUs[arch::percpuID::read()]};
+		// Back to idle once outermost handler is done
+		if ((0_usize == --rcu.irqNesting) && rcu.irqIdle) {
+			arch::atomic::get().fetchAdd(&rcu.dynticks, 1_usize);
+		}
+	}
+
+
+}	// namespace igros::klib
+
@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////
+//
+//	Kernel read-copy-update
+//
+//	File:	kRCU.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <bit>
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/atomic.hpp>
+#include <arch/percpu.hpp>
+#include <arch/types.hpp>
+
+
+// Kernel library code zone
+namespace igros::klib {
+
+
+	// RCU callback head (embedded in object to be reclaimed)
+	struct kRCUHead {
+		kRCUHead*				next;		// Next callback
+		std::add_pointer_t<void (kRCUHead*)>	func;		// Reclaim function
+	};
+
+
+	// Read-copy-update
+	//
+	// Readers never lock or write shared memory: read-side sections only bump
+	// per-CPU preemption depth. Writers publish new data with assign(), then
+	// reclaim old data after a grace period, i.e. once every CPU passed through
+	// a quiescent state (idle, context switch or explicit quiescent() call)
+	class kRCU final {
+
+		// Copy c-tor
+		kRCU(const kRCU &other) = delete;
+		// Copy assignment
+		auto	operator=(const kRCU &other) -> kRCU& = delete;
+
+		// Move c-tor
+		kRCU(kRCU &&other) = delete;
+		// Move assignment
+		auto	operator=(kRCU &&other) -> kRCU& = delete;
+
+
+	public:
+
+		// Default c-tor
+		kRCU() noexcept = default;
+
+		// Enter read-side critical section
+		static void	readLock() noexcept;
+		// Leave read-side critical section
+		static void	readUnlock() noexcept;
+
+		// Read RCU protected pointer
+		template<typename T>
+		[[nodiscard]]
+		static auto	dereference(T* const &slot) noexcept -> T*;
+		// Publish RCU protected pointer
+		template<typename T>
+		static void	assign(T* &slot, T* const value) noexcept;
+
+		// Queue callback to be called after grace period
+		static void	call(kRCUHead* const head, const std::add_pointer_t<void (kRCUHead*)> func) noexcept;
+		// Wait for grace period to elapse
+		static void	synchronize() noexcept;
+
+		// Report quiescent state of current CPU unless preemption is disabled (and run ready callbacks)
+		static void	quiescent() noexcept;
+
+		// Current CPU enters idle (extended quiescent state)
+		static void	idleEnter() noexcept;
+		// Current CPU leaves idle
+		static void	idleExit() noexcept;
+
+		// Interrupt handler entry (may interrupt idle)
+		static void	irqEnter() noexcept;
+		// Interrupt handler exit
+		static void	irqExit() noexcept;
+
+
+	};
+
+
+	// Enter read-side critical section
+	inline void kRCU::readLock() noexcept {
+		arch::percpuPreempt::add(1_u32);
+	}
+
+	// Leave read-side critical section
+	inline void kRCU::readUnlock() noexcept {
+		arch::percpuPreempt::add(~0_u32);
+	}
+
+
+	// Read RCU protected pointer
+	template<typename T>
+	[[nodiscard]]
+	inline auto kRCU::dereference(T* const &slot) noexcept -> T* {
+		return std::bit_cast<T*>(arch::atomic::get().load(std::bit_cast<const igros_usize_t*>(&slot)));
+	}
+
+	// Publish RCU protected pointer
+	template<typename T>
+	inline void kRCU::assign(T* &slot, T* const value) noexcept {
+		arch::atomic::get().store(std::bit_cast<igros_usize_t*>(&slot), std::bit_cast<igros_usize_t>(value));
+	}
+
+
+	// RCU read-side critical section guard
+	class kRCUReadGuard final {
+
+		// Copy c-tor
+		kRCUReadGuard(const kRCUReadGuard &other) = delete;
+		// Copy assignment
+		auto	operator=(const kRCUReadGuard &other) -> kRCUReadGuard& = delete;
+
+		// Move c-tor
+		kRCUReadGuard(kRCUReadGuard &&other) = delete;
+		// Move assignment
+		auto	operator=(kRCUReadGuard &&other) -> kRCUReadGuard& = delete;
+
+
+	public:
+
+		// Enter read-side critical section
+		kRCUReadGuard() noexcept {
+			kRCU::readLock();
+		}
+
+		// Leave read-side critical section
+		~kRCUReadGuard() noexcept {
+			kRCU::readUnlock();
+		}
+
+
+	};
+
+
+}	// namespace igros::klib
+
@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////////
+///
+///	@brief		IgrOS kernel sequence lock
+///
+///	@file		kSeqlock.hpp
+///	@date		19 Oct 2026
+///
+///	@copyright	Copyright (c) 2017 - 2022,
+///			All rights reserved.
+///	@author		Igor Baklykov
+///
+///
+
+
+#pragma once
+
+
+// C++
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/cpu.hpp>
+#include <arch/types.hpp>
+// IgrOS-Kernel library
+#include <klib/kAtomic.hpp>
+
+
+////////////////////////////////////////////////////////////////
+///
+/// @brief IgrOS Kernel Library namespace
+/// @namespace igros::klib
+///
+namespace igros::klib {
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Sequence lock protected value
+	/// @class kSeqlock
+	/// @tparam T Trivially copyable value
+	///
+	/// Readers never write shared memory nor disable interrupts: they copy
+	/// value and retry if sequence was odd (writer active) or changed
+	/// meanwhile. Writers must be serialized by caller (single interrupt
+	/// handler, lock, etc.) and must not be interrupted by readers of same
+	/// CPU, otherwise reader spins forever
+	///
+	/// @note Sequence lives in same object as value, so atomic accesses to
+	/// it also keep compiler from moving value accesses around them
+	///
+	template<typename T>
+	class kSeqlock final {
+
+		static_assert(
+			std::is_trivially_copyable_v<T>,
+			"Sequence lock value must be trivially copyable!"
+		);
+
+		igros_dword_t	mSequence	{0_u32};	///< Odd while value is updated
+		T		mValue		{};		///< Protected value
+
+		// Copy c-tor
+		kSeqlock(const kSeqlock &other) = delete;
+		// Copy assignment
+		auto	operator=(const kSeqlock &other) -> kSeqlock& = delete;
+
+		// Move c-tor
+		kSeqlock(kSeqlock &&other) = delete;
+		// Move assignment
+		auto	operator=(kSeqlock &&other) -> kSeqlock& = delete;
+
+
+	public:
+
+		/// @brief Default c-tor
+		constexpr kSeqlock() noexcept = default;
+		/// @brief Initial value c-tor
+		constexpr explicit kSeqlock(const T &value) noexcept;
+
+		/// @brief Start read section
+		[[nodiscard]]
+		auto	readBegin() const noexcept -> igros_dword_t;
+		/// @brief Check if read section must be retried
+		[[nodiscard]]
+		auto	readRetry(const igros_dword_t sequence) const noexcept -> bool;
+		/// @brief Consistent copy of value
+		[[nodiscard]]
+		auto	read() const noexcept -> T;
+
+		/// @brief Start in place update (returns value to modify)
+		[[nodiscard]]
+		auto	writeBegin() noexcept -> T&;
+		/// @brief Finish in place update
+		void	writeEnd() noexcept;
+		/// @brief Replace value
+		void	write(const T &value) noexcept;
+
+		/// @brief Value without consistency check (read sections and writers)
+		[[nodiscard]]
+		constexpr auto	value() const noexcept -> const T&;
+
+
+	};
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Initial value c-tor
+	/// @param[in] value Initial value
+	///
+	template<typename T>
+	constexpr kSeqlock<T>::kSeqlock(const T &value) noexcept
+		: mValue {value} {}
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Start read section
+	/// @return Sequence to be passed to readRetry()
+	///
+	template<typename T>
+	[[nodiscard]]
+	inline auto kSeqlock<T>::readBegin() const noexcept -> igros_dword_t {
+		// Const is dropped for load only
+		const kAtomicRef<igros_dword_t> sequence {const_cast<igros_dword_t&>(mSequence)};
+		for (;;) {
+			const auto current {sequence.load(kMemoryOrder::ACQUIRE)};
+			// Odd while writer is in progress
+			if (0_u32 == (current & 1_u32)) [[likely]] {
+				return current;
+			}
+			arch::cpu::get().pause();
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Check if read section must be retried
+	/// @param[in] sequence Value returned by readBegin()
+	/// @return true if value was changed during read section
+	///
+	template<typename T>
+	[[nodiscard]]
+	inline auto kSeqlock<T>::readRetry(const igros_dword_t sequence) const noexcept -> bool {
+		// Const is dropped for load only
+		const kAtomicRef<igros_dword_t> current {const_cast<igros_dword_t&>(mSequence)};
+		return sequence != current.load(kMemoryOrder::ACQUIRE);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Consistent copy of value
+	/// @return Value copy
+	///
+	template<typename T>
+	[[nodiscard]]
+	inline auto kSeqlock<T>::read() const noexcept -> T {
+		for (;;) {
+			const auto sequence	{readBegin()};
+			const auto value	{mValue};
+			// Value not changed while copied
+			if (!readRetry(sequence)) [[likely]] {
+				return value;
+			}
+		}
+	}
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Start in place update
+	/// @return Value to modify (till writeEnd())
+	///
+	template<typename T>
+	[[nodiscard]]
+	inline auto kSeqlock<T>::writeBegin() noexcept -> T& {
+		// Single writer, so plain release store is enough
+		kAtomicRef<igros_dword_t>(mSequence).store(mSequence + 1_u32, kMemoryOrder::RELEASE);
+		return mValue;
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Finish in place update
+	///
+	template<typename T>
+	inline void kSeqlock<T>::writeEnd() noexcept {
+		kAtomicRef<igros_dword_t>(mSequence).store(mSequence + 1_u32, kMemoryOrder::RELEASE);
+	}
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Replace value
+	/// @param[in] value New value
+	///
+	template<typename T>
+	inline void kSeqlock<T>::write(const T &value) noexcept {
+		writeBegin() = value;
+		writeEnd();
+	}
+
+
+	////////////////////////////////////////////////////////////////
+	///
+	/// @brief Value without consistency check
+	/// @return Value reference
+	///
+	template<typename T>
+	[[nodiscard]]
+	constexpr auto kSeqlock<T>::value() const noexcept -> const T& {
+		return mValue;
+	}
+
+
+}	// namespace igros::klib
+
@@ -51,11 +51,11 @@ namespace igros::klib {
 #if	defined(IGROS_ARCH_i386)
 
 
-	// Divide unsigned integer by unsigned integer (igros_quad_t / igros_dword_t overload)
+	// Divide unsigned integer by unsigned integer (igros_quad_t / igros_quad_t overload)
 	// Returns unsigned quotient and unsigned reminder
 	template<>
 	[[nodiscard]]
-	constexpr auto kdivmod(igros_quad_t dividend, igros_dword_t divisor) noexcept -> divmod_t<igros_quad_t> {
+	constexpr auto kdivmod(igros_quad_t dividend, igros_quad_t divisor) noexcept -> divmod_t<igros_quad_t> {
 
 		// Division result
 		auto res	{divmod_t<igros_quad_t> {0_u64, dividend}};
@@ -63,12 +63,13 @@ namespace igros::klib {
 		auto qbit	{1_u64};
 
 		// Division by zero
-		if (std::cmp_equal(0_u32, divisor)) [[unlikely]] {
+		if (std::cmp_equal(0_u64, divisor)) [[unlikely]] {
 			return res;
 		}
 
-		while (std::cmp_less(0_i32, divisor)) {
-			divisor <<= 1_u64;
+		// Align divisor with dividend highest bit
+		while ((divisor < res.reminder) && (0_u64 == (divisor & 0x8000000000000000_u64))) {
+			divisor	<<= 1_u64;
 			qbit	<<= 1_u64;
 		}
 
@@ -85,13 +86,12 @@ namespace igros::klib {
 
 	}
 
-	// Divide unsigned integer by unsigned integer (igros_quad_t / igros_quad_t overload)
+	// Divide unsigned integer by unsigned integer (igros_quad_t / igros_dword_t overload)
 	// Returns unsigned quotient and unsigned reminder
 	template<>
 	[[nodiscard]]
-	constexpr auto kdivmod(igros_quad_t dividend, igros_quad_t divisor) noexcept -> divmod_t<igros_quad_t> {
-		// Lazy trick
-		return kdivmod(dividend, static_cast<igros_dword_t>(divisor));
+	constexpr auto kdivmod(igros_quad_t dividend, igros_dword_t divisor) noexcept -> divmod_t<igros_quad_t> {
+		return kdivmod(dividend, static_cast<igros_quad_t>(divisor));
 	}
 
 
@@ -13,12 +13,18 @@
 
 // IgrOS-Kernel library
 #include <klib/kmemory.hpp>
+// IgrOS-Kernel system
+#include <sys/fpu.hpp>
 
 
 // Kernel library code zone
 namespace igros::klib {
 
 
+	// Copy size worth borrowing vector registers
+	constexpr auto KMEMORY_SIMD_THRESHOLD {1024_usize};
+
+
 	// Set required memory with specified byte
 	[[maybe_unused]]
 	auto kmemset8(igros_byte_t* dst, const igros_usize_t size, const igros_byte_t val) noexcept -> igros_pointer_t {
@@ -177,6 +183,13 @@ namespace igros::klib {
 		if ((nullptr == dst) || (nullptr == src) || (dst == src) || (0_usize == size)) [[unlikely]] {
 			return nullptr;
 		}
+#if	defined (IGROS_ARCH_x86_64)
+		// Big copy goes through vector registers
+		if ((size >= KMEMORY_SIMD_THRESHOLD) && sys::fpuUsable()) {
+			const sys::fpuKernelGuard guard {};
+			return kmemcpySIMD(dst, src, size);
+		}
+#endif	// IGROS_ARCH_x86_64
 		// Do actual memcpy
 		for (auto i {0_usize}; i < size; i++) {
 			static_cast<igros_byte_t*>(dst)[i] = static_cast<igros_byte_t*>(src)[i];
@@ -113,6 +113,14 @@ namespace igros::klib {
 	[[maybe_unused]]
 	auto	kmemcpy(igros_pointer_t dst, const igros_pointer_t src, const igros_usize_t size) noexcept -> igros_pointer_t;
 
+#if	defined (IGROS_ARCH_x86_64)
+
+	// Copy memory with vector registers (kernel FPU section only)
+	[[maybe_unused]]
+	auto	kmemcpySIMD(const igros_pointer_t dst, const igros_pointer_t src, const igros_usize_t size) noexcept -> igros_pointer_t;
+
+#endif	// IGROS_ARCH_x86_64
+
 
 }	// namespace igros::klib
 
@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////
+//
+//	Kernel mem functions (vectorized)
+//
+//	File:	kmemorySIMD.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// IgrOS-Kernel library
+#include <klib/kmemory.hpp>
+
+
+#if	defined (IGROS_ARCH_x86_64)
+
+// C++
+#include <emmintrin.h>
+
+
+// Kernel library code zone
+namespace igros::klib {
+
+
+	// Vector size
+	constexpr auto KMEMORY_SIMD_WIDTH {sizeof(__m128i)};
+
+
+	// Copy memory with vector registers (kernel FPU section only)
+	[[maybe_unused]]
+	auto kmemcpySIMD(const igros_pointer_t dst, const igros_pointer_t src, const igros_usize_t size) noexcept -> igros_pointer_t {
+		auto mDest	{static_cast<__m128i*>(dst)};
+		auto mSrc	{static_cast<const __m128i*>(src)};
+		const auto count {size / KMEMORY_SIMD_WIDTH};
+		// Four vectors per iteration
+		auto i {0_usize};
+		for (; (i + 4_usize) <= count; i += 4_usize) {
+			const auto v0 {_mm_loadu_si128(&mSrc[i + 0_usize])};
+			const auto v1 {_mm_loadu_si128(&mSrc[i + 1_usize])};
+			const auto v2 {_mm_loadu_si128(&mSrc[i + 2_usize])};
+			const auto v3 {_mm_loadu_si128(&mSrc[i + 3_usize])};
+			_mm_storeu_si128(&mDest[i + 0_usize], v0);
+			_mm_storeu_si128(&mDest[i + 1_usize], v1);
+			_mm_storeu_si128(&mDest[i + 2_usize], v2);
+			_mm_storeu_si128(&mDest[i + 3_usize], v3);
+		}
+		// Vector tail
+		for (; i < count; i++) {
+			_mm_storeu_si128(&mDest[i], _mm_loadu_si128(&mSrc[i]));
+		}
+		// Byte tail
+		const auto done {count * KMEMORY_SIMD_WIDTH};
+		for (auto j {done}; j < size; j++) {
+			static_cast<igros_byte_t*>(dst)[j] = static_cast<const igros_byte_t*>(src)[j];
+		}
+		// Return pointer to dst
+		return dst;
+	}
+
+
+}	// namespace igros::klib
+
+#endif	// IGROS_ARCH_x86_64
+
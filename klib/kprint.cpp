@@ -14,10 +14,14 @@
 // C++
 #include <array>
 #include <cstdarg>
+// IgrOS-Kernel arch
+#include <arch/percpu.hpp>
+#include <arch/smp.hpp>
 // IgrOS-Kernel drivers
 #include <drivers/uart/serial.hpp>
 #include <drivers/vga/vmem.hpp>
 // IgrOS-Kernel library
+#include <klib/kLock.hpp>
 #include <klib/kprint.hpp>
 #include <klib/kstring.hpp>
 #include <klib/kmemory.hpp>
@@ -391,10 +395,18 @@ namespace igros::klib {
 	}
 
 
+	// Console output lock
+	static kTicketLock<>	kprintLock {};
+
+
 	// Kernel printf function
 	void kprintf(const char* const format, ...) noexcept {
-		// Text buffer
-		static auto buffer {std::array<char, 1024_usize> {}};
+		// Text buffers (one per CPU)
+		static auto buffers {std::array<std::array<char, 1024_usize>, arch::smp::MAX_CPUS> {}};
+		// Don't interleave output of different CPUs, nor let same CPU IRQ reuse buffer mid-format
+		const kIRQLockGuard<kTicketLock<>> guard {kprintLock};
+		// Current CPU text buffer (no migration with interrupts off)
+		auto &buffer {buffers[arch::percpuID::read()]};
 		// Kernel variadic argument list
 		std::va_list list {};
 		// Initialize variadic arguments list
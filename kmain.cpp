@@ -12,7 +12,7 @@
 
 
 // IgrOS-Kernel arch
-#include <arch/cpu.hpp>
+#include <arch/smp.hpp>
 // IgrOS-Kernel multiboot
 #include <multiboot/multiboot.hpp>
 // IgrOS-Kernel platform
@@ -52,8 +52,8 @@ extern "C" {
 		// Write "Booted successfully" message
 		igros::klib::kprintf("Booted successfully");
 
-		// Halt CPU
-		igros::arch::cpu::get().halt();
+		// Nothing left to do, become idle CPU
+		igros::arch::smp::get().idle();
 
 	}
 
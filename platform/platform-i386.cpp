@@ -21,16 +21,28 @@
 #include <arch/i386/irq.hpp>
 #include <arch/i386/paging.hpp>
 // IgrOS-Kernel drivers
+#include <drivers/acpi/acpi.hpp>
+#include <drivers/clock/hpet.hpp>
 #include <drivers/clock/pit.hpp>
 #include <drivers/clock/rtc.hpp>
+#include <drivers/clock/tsc.hpp>
 #include <drivers/input/keyboard.hpp>
+#include <drivers/pci/pci.hpp>
 #include <drivers/uart/serial.hpp>
 #include <drivers/vga/vmem.hpp>
+#include <drivers/virtio/virtioBlk.hpp>
 // IgrOS-Kernel library
 #include <klib/kprint.hpp>
 #include <klib/kSingleton.hpp>
 // IgrOS-Kernel platform
 #include <platform/platform.hpp>
+// IgrOS-Kernel system
+#include <sys/fpu.hpp>
+#include <sys/irqtrace.hpp>
+#include <sys/sched.hpp>
+#include <sys/softirq.hpp>
+#include <sys/timer.hpp>
+#include <sys/workqueue.hpp>
 
 
 // i386 namespace
@@ -40,6 +52,8 @@ namespace igros::i386 {
 	// Initialize i386
 	static void platformInit() noexcept {
 
+		// Interrupts latency tracing (if built in)
+		sys::irqTraceInit();
 		// Setup Interrupts Descriptor Table
 		i386::idt::init();
 		// Init exceptions
@@ -54,6 +68,16 @@ namespace igros::i386 {
 
 		// Setup paging (And identity map first 4MB where kernel physically is)
 		//i386::paging::init();
+		// Setup pages heap right after kernel image (boot mapping covers it)
+		i386::paging::heap(const_cast<igros_byte_t*>(platform::Platform::kernelEnd()), i386::paging::PAGE_SIZE << 8);
+		// Bootstrap processor context becomes its idle thread
+		sys::sched::init();
+		// Lazy FPU state switching
+		sys::fpuInit();
+		// Deferred interrupt work
+		sys::softirqInit();
+		sys::timerInit();
+		sys::workqueueInit();
 
 		// Setup VGA
 		arch::vmemInit();
@@ -63,8 +87,19 @@ namespace igros::i386 {
 		arch::keyboardSetup();
 		// Setup RTC
 		arch::rtcSetup();
+		// Setup ACPI
+		arch::acpiSetup();
 		// Setup PIT
-		//arch::pitSetup();
+		arch::pitSetup();
+		// Setup HPET
+		arch::hpetSetup();
+		// Calibrate TSC against HPET (or PIT)
+		arch::tscSetup();
+		// Start tick (tickless idle)
+		arch::pitTickSetup();
+		// Setup PCI bus and its drivers
+		arch::pciSetup();
+		arch::virtioBlkSetup();
 
 		// Debug print
 		klib::kprintf(
@@ -14,22 +14,37 @@
 // C++
 #include <source_location>
 // IgrOS-Kernel arch x86_64
+#include <arch/x86_64/apic.hpp>
 #include <arch/x86_64/exceptions.hpp>
 #include <arch/x86_64/gdt.hpp>
 #include <arch/x86_64/idt.hpp>
 #include <arch/x86_64/irq.hpp>
 #include <arch/x86_64/paging.hpp>
+#include <arch/x86_64/percpu.hpp>
+#include <arch/x86_64/smp.hpp>
 // IgrOS-Kernel drivers
+#include <drivers/acpi/acpi.hpp>
+#include <drivers/clock/hpet.hpp>
 #include <drivers/clock/pit.hpp>
 #include <drivers/clock/rtc.hpp>
+#include <drivers/clock/tsc.hpp>
 #include <drivers/input/keyboard.hpp>
+#include <drivers/pci/pci.hpp>
 #include <drivers/uart/serial.hpp>
 #include <drivers/vga/vmem.hpp>
+#include <drivers/virtio/virtioBlk.hpp>
 // IgrOS-Kernel library
 #include <klib/kprint.hpp>
 #include <klib/kSingleton.hpp>
 // IgrOS-Kernel platform
 #include <platform/platform.hpp>
+// IgrOS-Kernel system
+#include <sys/fpu.hpp>
+#include <sys/irqtrace.hpp>
+#include <sys/sched.hpp>
+#include <sys/softirq.hpp>
+#include <sys/timer.hpp>
+#include <sys/workqueue.hpp>
 
 
 // x86_64 namespace
@@ -39,12 +54,16 @@ namespace igros::x86_64 {
 	// Initialize x86_64
 	void platformInit() noexcept {
 
+		// Setup Global Descriptors Table
+		x86_64::gdt::init();
+		// Setup bootstrap processor per-CPU data block (segments reload may clear GS base)
+		x86_64::percpuInit(0_usize, 0_u32);
+		// Interrupts latency tracing (if built in)
+		sys::irqTraceInit();
 		// Setup Interrupts Descriptor Table
 		x86_64::idt::init();
 		// Init exceptions
 		x86_64::except::init();
-		// Setup Global Descriptors Table
-		x86_64::gdt::init();
 
 		// Init interrupts
 		x86_64::irq::init();
@@ -53,6 +72,16 @@ namespace igros::x86_64 {
 
 		// Setup paging (And identity map first 4MB where kernel physically is)
 		//x86_64::paging::init();
+		// Setup pages heap right after kernel image (boot mapping covers it)
+		x86_64::paging::heap(const_cast<igros_byte_t*>(platform::Platform::kernelEnd()), x86_64::paging::PAGE_SIZE << 8);
+		// Bootstrap processor context becomes its idle thread
+		sys::sched::init();
+		// Lazy FPU state switching
+		sys::fpuInit();
+		// Deferred interrupt work
+		sys::softirqInit();
+		sys::timerInit();
+		sys::workqueueInit();
 
 		// Setup VGA
 		arch::vmemInit();
@@ -62,8 +91,22 @@ namespace igros::x86_64 {
 		arch::keyboardSetup();
 		// Setup RTC
 		arch::rtcSetup();
+		// Setup ACPI
+		arch::acpiSetup();
+		// Start application processors
+		x86_64::smp::init();
 		// Setup PIT
-		//arch::pitSetup();
+		arch::pitSetup();
+		// Setup HPET
+		arch::hpetSetup();
+		// Calibrate TSC against HPET (or PIT)
+		arch::tscSetup();
+		// Start tick (tickless idle)
+		arch::pitTickSetup();
+		x86_64::apic::timerSetup();
+		// Setup PCI bus and its drivers
+		arch::pciSetup();
+		arch::virtioBlkSetup();
 
 		// Debug print
 		klib::kprintf(
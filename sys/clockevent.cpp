@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////
+//
+//	Clock event devices and scheduler tick
+//
+//	File:	clockevent.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+// IgrOS-Kernel arch
+#include <arch/irq.hpp>
+#include <arch/percpu.hpp>
+#include <arch/smp.hpp>
+// IgrOS-Kernel library
+#include <klib/kRCU.hpp>
+#include <klib/kmath.hpp>
+#include <klib/kprint.hpp>
+// IgrOS-Kernel system
+#include <sys/clockevent.hpp>
+#include <sys/sched.hpp>
+#include <sys/softirq.hpp>
+#include <sys/timer.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Per-CPU tick state
+	struct alignas(64) tickCPU_t {
+		clockevent_t*		device;			// One-shot device (nullptr - periodic tick)
+		igros_quad_t		next;			// Next expiry (kernel time)
+		bool			idle;			// Tick stopped for idle sleep
+	};
+
+
+	// Per-CPU tick states
+	static std::array<tickCPU_t, arch::smp::MAX_CPUS>	tickCPUs	{};
+	// Best per-CPU device (adopted by other CPUs from idle loop)
+	static clockevent_t*					tickShared	{nullptr};
+
+
+	// First tick boundary after given time
+	[[nodiscard]]
+	static auto tickAlign(const igros_quad_t now) noexcept -> igros_quad_t {
+		return (klib::kdivmod(now, TICK_NSEC).quotient + 1_u64) * TICK_NSEC;
+	}
+
+	// Program device for next expiry (interrupts disabled)
+	static void tickProgram(const tickCPU_t &tick, const igros_quad_t now) noexcept {
+		auto deadline {tick.next};
+		// Due ones are run by softirq, which reprograms afterwards
+		if (const auto hrtimer {hrtimerNextEvent()}; (hrtimer > now) && (hrtimer < deadline)) {
+			deadline = hrtimer;
+		}
+		const auto delta {(deadline > now) ? (deadline - now) : 0_u64};
+		// Long delays are done in device-sized steps
+		tick.device->program((delta < tick.device->maxDelta) ? delta : tick.device->maxDelta);
+	}
+
+	// Switch current CPU to device if it is better (interrupts disabled)
+	static auto tickAdopt(tickCPU_t &tick, clockevent_t &device) noexcept -> bool {
+		if ((nullptr != tick.device) && (tick.device->rating >= device.rating)) {
+			return false;
+		}
+		if (nullptr != tick.device) {
+			tick.device->stop();
+		}
+		if (nullptr != device.setup) {
+			device.setup();
+		}
+		tick.device	= &device;
+		tick.idle	= false;
+		// Tick from now on
+		const auto now {ktimeGetNs()};
+		tick.next	= tickAlign(now);
+		tickProgram(tick, now);
+		return true;
+	}
+
+	// Tick work
+	static void tickRun() noexcept {
+		// Scheduler time slice accounting
+		sched::tick();
+		// Rest is done on interrupt exit
+		softirqRaise(softirq_t::TIMER);
+	}
+
+
+	// Register clock event device (current CPU, per-CPU ones spread to all)
+	void clockeventRegister(clockevent_t &device) noexcept {
+		const auto id		{arch::percpuID::read()};
+		const auto flags	{arch::irq::get().save()};
+		const auto adopted	{tickAdopt(tickCPUs[id], device)};
+		arch::irq::get().restore(flags);
+		if (adopted) {
+			klib::kprintf("TICK:\t\t%s selected (%d Hz, tickless idle)\n", device.name, TICK_HZ);
+		}
+		if (!device.percpu) {
+			return;
+		}
+		// Other CPUs pick it up from kick interrupt or idle loop
+		if (const auto shared {klib::kRCU::dereference(tickShared)}; (nullptr == shared) || (shared->rating < device.rating)) {
+			klib::kRCU::assign(tickShared, &device);
+		}
+		for (auto cpu {0_usize}; cpu < arch::smp::MAX_CPUS; cpu++) {
+			if ((cpu != id) && arch::smp::get().isOnline(cpu)) {
+				arch::smp::get().kick(cpu);
+			}
+		}
+	}
+
+	// Current CPU clock event device (nullptr if ticks are periodic)
+	[[nodiscard]]
+	auto clockeventCurrent() noexcept -> const clockevent_t* {
+		return tickCPUs[arch::percpuID::read()].device;
+	}
+
+
+	// Clock event expired or periodic tick (interrupt context)
+	void tickHandler() noexcept {
+		auto &tick {tickCPUs[arch::percpuID::read()]};
+		// Periodic interrupt
+		if (nullptr == tick.device) {
+			tickRun();
+			return;
+		}
+		const auto now {ktimeGetNs()};
+		// High resolution timers run from softirq
+		if (hrtimerNextEvent() <= now) {
+			softirqRaise(softirq_t::TIMER);
+		}
+		// Device can't wait that long - rest of delay
+		if (now < tick.next) {
+			tickProgram(tick, now);
+			return;
+		}
+		tickRun();
+		// Idle loop restarts tick on wake up
+		if (tick.idle) {
+			return;
+		}
+		// Missed ticks are not replayed
+		tick.next += TICK_NSEC;
+		if (tick.next <= now) [[unlikely]] {
+			tick.next = now + TICK_NSEC;
+		}
+		tickProgram(tick, now);
+	}
+
+	// Pick up per-CPU device registered by other CPU (interrupts disabled)
+	void tickKick() noexcept {
+		if (const auto shared {klib::kRCU::dereference(tickShared)}; nullptr != shared) {
+			tickAdopt(tickCPUs[arch::percpuID::read()], *shared);
+		}
+	}
+
+	// Stop tick before idle sleep (interrupts disabled)
+	void tickIdleEnter() noexcept {
+		tickKick();
+		auto &tick {tickCPUs[arch::percpuID::read()]};
+		if (nullptr == tick.device) {
+			return;
+		}
+		// Nothing to do till next timer (or far wake up)
+		const auto now		{ktimeGetNs()};
+		const auto timer	{timerNextEvent()};
+		tick.idle		= true;
+		tick.next		= (timer < (now + TICK_IDLE_NSEC)) ? timer : (now + TICK_IDLE_NSEC);
+		tickProgram(tick, now);
+	}
+
+	// Restart tick after idle sleep (interrupts disabled)
+	void tickIdleExit() noexcept {
+		auto &tick {tickCPUs[arch::percpuID::read()]};
+		if ((nullptr == tick.device) || !tick.idle) {
+			return;
+		}
+		const auto now {ktimeGetNs()};
+		tick.idle	= false;
+		tick.next	= tickAlign(now);
+		tickProgram(tick, now);
+	}
+
+	// Reprogram device after earliest deadline changed (interrupts disabled)
+	void tickUpdate() noexcept {
+		const auto &tick {tickCPUs[arch::percpuID::read()]};
+		if (nullptr == tick.device) {
+			return;
+		}
+		tickProgram(tick, ktimeGetNs());
+	}
+
+
+}	// namespace igros::sys
+
@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////
+//
+//	Clock event devices and scheduler tick
+//
+//	File:	clockevent.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+// IgrOS-Kernel system
+#include <sys/clocksource.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Dynamic tick
+	//
+	// Clock event device is a one-shot timer of one CPU. Tick is not a fixed
+	// rate interrupt - each expiry programs next one a tick period later, and
+	// idle CPU programs its next timer expiry instead, so it sleeps in hlt
+	// instead of waking TICK_HZ times per second. High resolution timers due
+	// before next tick program device for their own deadline. Devices that
+	// can't sleep that long just fire early and get programmed for the rest.
+	// Only boot CPU has periodic interrupt (PIT) to fall back on. Application
+	// processors get per-CPU local APIC timer (TSC-deadline, or calibrated
+	// one-shot mode if there is none) and adopt it from kick interrupt, so
+	// busy ones too. Till then they don't take work from other CPUs
+
+
+	// Tick rate (Hz)
+	constexpr auto TICK_HZ			{100_u32};
+	// Tick period (ns)
+	constexpr auto TICK_NSEC		{NSEC_PER_SEC / TICK_HZ};
+	// Longest idle sleep without tick (ns)
+	constexpr auto TICK_IDLE_NSEC		{NSEC_PER_SEC};
+
+
+	// Clock event per-CPU init (runs on CPU adopting device)
+	using clockeventSetup_t		= std::add_pointer_t<void ()>;
+	// Clock event fire once after given nanoseconds (current CPU)
+	using clockeventProgram_t	= std::add_pointer_t<void (const igros_quad_t ns)>;
+	// Clock event cancel (current CPU)
+	using clockeventStop_t		= std::add_pointer_t<void ()>;
+
+
+	// Clock event device
+	struct clockevent_t {
+		const char*		name;			// Device name
+		clockeventSetup_t	setup;			// Per-CPU init (may be nullptr)
+		clockeventProgram_t	program;		// Fire once after ns
+		clockeventStop_t	stop;			// Cancel
+		igros_quad_t		maxDelta;		// Longest delay (ns)
+		igros_dword_t		rating;			// Higher is better
+		bool			percpu;			// Every CPU has own instance
+	};
+
+
+	// Register clock event device (current CPU, per-CPU ones spread to all)
+	void	clockeventRegister(clockevent_t &device) noexcept;
+	// Current CPU clock event device (nullptr if ticks are periodic)
+	[[nodiscard]]
+	auto	clockeventCurrent() noexcept -> const clockevent_t*;
+
+	// Clock event expired or periodic tick (interrupt context)
+	void	tickHandler() noexcept;
+	// Pick up per-CPU device registered by other CPU (interrupts disabled)
+	void	tickKick() noexcept;
+	// Stop tick before idle sleep (interrupts disabled)
+	void	tickIdleEnter() noexcept;
+	// Restart tick after idle sleep (interrupts disabled)
+	void	tickIdleExit() noexcept;
+	// Reprogram device after earliest deadline changed (interrupts disabled)
+	void	tickUpdate() noexcept;
+
+
+}	// namespace igros::sys
+
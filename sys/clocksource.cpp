@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////
+//
+//	Clock sources and kernel time
+//
+//	File:	clocksource.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// IgrOS-Kernel library
+#include <klib/kLock.hpp>
+#include <klib/kmath.hpp>
+#include <klib/kprint.hpp>
+#include <klib/kSeqlock.hpp>
+// IgrOS-Kernel system
+#include <sys/clocksource.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Kernel time base (changes only on source switch)
+	struct clockBase_t {
+		const clocksource_t*	source;			// Current source
+		igros_quad_t		cycles;			// Counter value at switch
+		igros_quad_t		ns;			// Kernel time at switch
+		igros_quad_t		real;			// Wall time at boot
+	};
+
+
+	// Time base (readers are lock-free)
+	static klib::kSeqlock<clockBase_t>	clockBase	{};
+	// Writers lock
+	static klib::kSpinlock<>	clockLock	{};
+
+
+	// Calculate counter to ns multiplier and shift (mult must fit dword)
+	static void clocksourceCalc(clocksource_t &source) noexcept {
+		for (auto shift {32_u32}; shift > 0_u32; shift--) {
+			// ns = cycles * 10^9 / Hz (10^9 << 32 still fits quad)
+			const auto mult {klib::kdivmod(NSEC_PER_SEC << shift, source.frequency).quotient};
+			if (mult <= 0xFFFFFFFF_u64) {
+				source.mult	= static_cast<igros_dword_t>(mult);
+				source.shift	= shift;
+				return;
+			}
+		}
+		source.mult	= 0xFFFFFFFF_u32;
+		source.shift	= 0_u32;
+	}
+
+	// Counter delta to ns (64 x 32 bit product, no 128-bit math)
+	[[nodiscard]]
+	static auto clocksourceScale(const igros_quad_t cycles, const igros_dword_t mult, const igros_dword_t shift) noexcept -> igros_quad_t {
+		const auto low	{(cycles & 0xFFFFFFFF_u64) * mult};
+		const auto high	{(cycles >> 32) * mult};
+		return (high << (32_u32 - shift)) + (low >> shift);
+	}
+
+
+	// Kernel time from base
+	[[nodiscard]]
+	static auto clockBaseNs(const clockBase_t &base) noexcept -> igros_quad_t {
+		if (nullptr == base.source) [[unlikely]] {
+			return base.ns;
+		}
+		return base.ns + clocksourceScale(base.source->read() - base.cycles, base.source->mult, base.source->shift);
+	}
+
+
+	// Register clock source (switches to it if rated better)
+	void clocksourceRegister(clocksource_t &source) noexcept {
+		clocksourceCalc(source);
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {clockLock};
+			const auto &current {clockBase.value()};
+			if ((nullptr != current.source) && (current.source->rating >= source.rating)) {
+				return;
+			}
+			// Keep time running from where old source left it
+			const auto now {clockBaseNs(current)};
+			auto &base {clockBase.writeBegin()};
+			base.source	= &source;
+			base.cycles	= source.read();
+			base.ns		= now;
+			clockBase.writeEnd();
+		}
+		klib::kprintf(
+			"CLOCK:\t\t%s selected (%llu Hz, mult %d, shift %d)\n",
+			source.name,
+			source.frequency,
+			source.mult,
+			source.shift
+		);
+	}
+
+	// Current clock source (nullptr if none yet)
+	[[nodiscard]]
+	auto clocksourceCurrent() noexcept -> const clocksource_t* {
+		return clockBase.read().source;
+	}
+
+
+	// Nanoseconds since boot (monotonic)
+	[[nodiscard]]
+	auto ktimeGetNs() noexcept -> igros_quad_t {
+		return clockBaseNs(clockBase.read());
+	}
+
+	// Nanoseconds since 01.01.1970 (wall time)
+	[[nodiscard]]
+	auto ktimeGetRealNs() noexcept -> igros_quad_t {
+		const auto base {clockBase.read()};
+		return base.real + clockBaseNs(base);
+	}
+
+	// Anchor wall time (seconds since 01.01.1970)
+	void ktimeSetReal(const igros_quad_t seconds) noexcept {
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {clockLock};
+		const auto now {clockBaseNs(clockBase.value())};
+		clockBase.writeBegin().real = seconds * NSEC_PER_SEC - now;
+		clockBase.writeEnd();
+	}
+
+
+}	// namespace igros::sys
+
@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////
+//
+//	Clock sources and kernel time
+//
+//	File:	clocksource.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Kernel time
+	//
+	// Clock source is a free-running counter with known frequency. Best rated
+	// registered source drives kernel time, which is base + scaled counter
+	// delta, so reading it is one counter read and no locks. Switching
+	// sources keeps time monotonic
+
+
+	// Nanoseconds per second
+	constexpr auto NSEC_PER_SEC		{1000000000_u64};
+	// Nanoseconds per millisecond
+	constexpr auto NSEC_PER_MSEC		{1000000_u32};
+
+
+	// Clock source counter read
+	using clocksourceRead_t	= std::add_pointer_t<igros_quad_t ()>;
+
+
+	// Clock source
+	struct clocksource_t {
+		const char*		name;			// Source name
+		clocksourceRead_t	read;			// Read counter
+		igros_quad_t		frequency;		// Counter frequency (Hz)
+		igros_dword_t		rating;			// Higher is better
+		igros_dword_t		mult;			// Counter to ns multiplier (set on register)
+		igros_dword_t		shift;			// Counter to ns shift (set on register)
+	};
+
+
+	// Register clock source (switches to it if rated better)
+	void	clocksourceRegister(clocksource_t &source) noexcept;
+	// Current clock source (nullptr if none yet)
+	[[nodiscard]]
+	auto	clocksourceCurrent() noexcept -> const clocksource_t*;
+
+	// Nanoseconds since boot (monotonic)
+	[[nodiscard]]
+	auto	ktimeGetNs() noexcept -> igros_quad_t;
+	// Nanoseconds since 01.01.1970 (wall time)
+	[[nodiscard]]
+	auto	ktimeGetRealNs() noexcept -> igros_quad_t;
+	// Anchor wall time (seconds since 01.01.1970)
+	void	ktimeSetReal(const igros_quad_t seconds) noexcept;
+
+
+}	// namespace igros::sys
+
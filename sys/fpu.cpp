@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////
+//
+//	Lazy FPU context switching
+//
+//	File:	fpu.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+// IgrOS-Kernel arch
+#include <arch/cpu.hpp>
+#include <arch/fpu.hpp>
+#include <arch/irq.hpp>
+#include <arch/paging.hpp>
+#include <arch/percpu.hpp>
+#include <arch/smp.hpp>
+// IgrOS-Kernel library
+#include <klib/kprint.hpp>
+// IgrOS-Kernel system
+#include <sys/fpu.hpp>
+#include <sys/sched.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Thread whose state is loaded into CPU FPU registers
+	static std::array<thread_t*, arch::smp::MAX_CPUS>	fpuOwners	{};
+	// FPU was used since last switch
+	static std::array<bool, arch::smp::MAX_CPUS>		fpuActive	{};
+	// FPU present and initialized
+	static std::array<bool, arch::smp::MAX_CPUS>		fpuReady	{};
+	// Kernel FPU section in progress
+	static std::array<bool, arch::smp::MAX_CPUS>		fpuKernel	{};
+
+
+	// Init FPU of current CPU
+	void fpuInit() noexcept {
+		fpuReady[arch::percpuID::read()] = arch::fpu::get().init();
+	}
+
+
+	// Switch FPU ownership (interrupts disabled)
+	void fpuSwitch(thread_t* const prev, thread_t* const next) noexcept {
+		const auto id {arch::percpuID::read()};
+		// Save only state that was touched
+		if (fpuActive[id] && (fpuOwners[id] == prev)) {
+			arch::fpu::get().save(prev->fpu);
+		}
+		// Registers still hold next thread state
+		if ((fpuOwners[id] == next) && (next->fpuCPU == id)) {
+			if (!fpuActive[id]) {
+				arch::fpu::get().enable();
+			}
+			fpuActive[id] = true;
+		} else if (fpuActive[id]) {
+			fpuActive[id] = false;
+			arch::fpu::get().disable();
+		}
+	}
+
+
+	// First FPU use by current thread
+	void fpuTrap() noexcept {
+		const auto id		{arch::percpuID::read()};
+		const auto thread	{sched::current()};
+		const auto owned	{(nullptr == thread) || ((fpuOwners[id] == thread) && (thread->fpuCPU == id))};
+		// First use ever (copy may use kernel FPU section, so before enable)
+		if (!owned && (nullptr == thread->fpu)) {
+			thread->fpu = arch::paging::get().allocate();
+			if (nullptr == thread->fpu) [[unlikely]] {
+				klib::kprintf("FPU:\t\tOut of memory for \"%s\" state\n", thread->name.data());
+				arch::cpu::get().halt();
+			}
+			arch::fpu::get().prepare(thread->fpu);
+		}
+		arch::fpu::get().enable();
+		fpuActive[id] = true;
+		// Registers are up to date
+		if (owned) [[unlikely]] {
+			return;
+		}
+		arch::fpu::get().restore(thread->fpu);
+		fpuOwners[id]	= thread;
+		thread->fpuCPU	= id;
+	}
+
+
+	// Release thread FPU state area
+	void fpuRelease(thread_t* const thread) noexcept {
+		if (nullptr != thread->fpu) {
+			arch::paging::get().deallocate(thread->fpu);
+			thread->fpu = nullptr;
+		}
+		thread->fpuCPU = ~0_usize;
+	}
+
+
+	// Check kernel may use FPU right now (not nested, FPU present)
+	[[nodiscard]]
+	auto fpuUsable() noexcept -> bool {
+		const auto id {arch::percpuID::read()};
+		return fpuReady[id] && !fpuKernel[id];
+	}
+
+	// Enter kernel FPU section (preemption disabled until end)
+	void fpuBegin() noexcept {
+		arch::percpuPreempt::add(1_u32);
+		const auto flags	{arch::irq::get().save()};
+		const auto id		{arch::percpuID::read()};
+		// Registers hold live state of interrupted thread
+		const auto owner	{fpuOwners[id]};
+		if (fpuActive[id] && (nullptr != owner) && (owner == sched::current())) {
+			arch::fpu::get().save(owner->fpu);
+		}
+		fpuKernel[id] = true;
+		arch::fpu::get().enable();
+		arch::fpu::get().reset();
+		arch::irq::get().restore(flags);
+	}
+
+	// Leave kernel FPU section
+	void fpuEnd() noexcept {
+		const auto flags	{arch::irq::get().save()};
+		const auto id		{arch::percpuID::read()};
+		// Registers are clobbered, owner reloads on next use
+		fpuOwners[id]	= nullptr;
+		fpuActive[id]	= false;
+		fpuKernel[id]	= false;
+		arch::fpu::get().disable();
+		arch::irq::get().restore(flags);
+		arch::percpuPreempt::add(~0_u32);
+	}
+
+
+}	// namespace igros::sys
+
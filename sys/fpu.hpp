@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////
+//
+//	Lazy FPU context switching
+//
+//	File:	fpu.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+// IgrOS-Kernel system
+#include <sys/thread.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Lazy FPU context switching
+	//
+	// FPU state of a thread is saved on switch out only if it was used during
+	// this run, and restored only on first use after switch in (#NM trap with
+	// CR0.TS set). Thread coming back to CPU which still holds its registers
+	// skips the restore and the trap altogether.
+
+	// Init FPU of current CPU
+	void	fpuInit() noexcept;
+
+	// Switch FPU ownership (interrupts disabled)
+	void	fpuSwitch(thread_t* const prev, thread_t* const next) noexcept;
+	// First FPU use by current thread
+	void	fpuTrap() noexcept;
+	// Release thread FPU state area
+	void	fpuRelease(thread_t* const thread) noexcept;
+
+	// Check kernel may use FPU right now (not nested, FPU present)
+	[[nodiscard]]
+	auto	fpuUsable() noexcept -> bool;
+	// Enter kernel FPU section (preemption disabled until end)
+	void	fpuBegin() noexcept;
+	// Leave kernel FPU section
+	void	fpuEnd() noexcept;
+
+
+	// Kernel FPU section guard
+	//
+	// Code compiled with SIMD enabled must run only inside this guard and
+	// must not sleep. Check fpuUsable() first and fall back to general
+	// register code if it says no (e.g. interrupt came in the middle of
+	// another section).
+	class fpuKernelGuard final {
+
+		// Copy c-tor
+		fpuKernelGuard(const fpuKernelGuard &other) = delete;
+		// Copy assignment
+		auto	operator=(const fpuKernelGuard &other) -> fpuKernelGuard& = delete;
+
+		// Move c-tor
+		fpuKernelGuard(fpuKernelGuard &&other) = delete;
+		// Move assignment
+		auto	operator=(fpuKernelGuard &&other) -> fpuKernelGuard& = delete;
+
+
+	public:
+
+		// Enter kernel FPU section
+		fpuKernelGuard() noexcept {
+			fpuBegin();
+		}
+
+		// Leave kernel FPU section
+		~fpuKernelGuard() noexcept {
+			fpuEnd();
+		}
+
+
+	};
+
+
+}	// namespace igros::sys
+
@@ -0,0 +1,293 @@
+////////////////////////////////////////////////////////////////
+//
+//	Interrupts latency tracing
+//
+//	File:	irqtrace.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <algorithm>
+#include <array>
+#include <bit>
+// IgrOS-Kernel arch
+#include <arch/cpu.hpp>
+#include <arch/irq.hpp>
+#include <arch/percpu.hpp>
+#include <arch/smp.hpp>
+// IgrOS-Kernel library
+#include <klib/kLock.hpp>
+#include <klib/kmath.hpp>
+#include <klib/kprint.hpp>
+// IgrOS-Kernel system
+#include <sys/irqtrace.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+#if	defined (IGROS_TRACE_IRQ)
+
+	// Number of traced vectors
+	constexpr auto IRQ_TRACE_VECTORS	{256_usize};
+	// Duration histogram buckets (two per power of two)
+	constexpr auto IRQ_TRACE_BUCKETS	{64_usize};
+	// Longest interrupts-off windows kept
+	constexpr auto IRQ_TRACE_WINDOWS	{8_usize};
+	// Window opened by interrupt entry (not by code)
+	constexpr auto IRQ_TRACE_NO_VECTOR	{~0_usize};
+	// Interrupt enable flag
+	constexpr auto IRQ_TRACE_FLAGS_IF	{0x00000200_usize};
+
+
+	// Handler duration statistics
+	struct irqTraceStats_t {
+		igros_usize_t						count;		// Calls
+		igros_quad_t						total;		// Cycles in total
+		igros_quad_t						min;		// Shortest call
+		igros_quad_t						max;		// Longest call
+		std::array<igros_dword_t, IRQ_TRACE_BUCKETS>		buckets;	// Duration histogram
+	};
+
+	// Interrupts-off window
+	struct irqTraceWindow_t {
+		igros_quad_t		cycles;			// Window length (start time while open)
+		igros_pointer_t		where;			// Code which disabled interrupts
+		igros_usize_t		vector;			// Or interrupt which came
+	};
+
+	// Per-CPU open window
+	struct alignas(64) irqTraceCPU_t {
+		irqTraceWindow_t	window;			// Current window
+		bool			open;			// Interrupts are off
+	};
+
+
+	// Tracing started
+	static bool									irqTraceEnabled	{false};
+	// Statistics lock (taken with interrupts off only)
+	static klib::kSpinlock<>							irqTraceLock	{};
+	// Per-vector handler statistics
+	static std::array<irqTraceStats_t, IRQ_TRACE_VECTORS>				irqTraceStats	{};
+	// Longest windows (shortest first)
+	static std::array<irqTraceWindow_t, IRQ_TRACE_WINDOWS>				irqTraceWindows	{};
+	// Per-CPU open windows
+	static std::array<irqTraceCPU_t, arch::smp::MAX_CPUS>				irqTraceCPUs	{};
+
+
+	// Get current CPU trace state (nullptr if not traced)
+	[[nodiscard]]
+	static auto irqTraceCPU() noexcept -> irqTraceCPU_t* {
+		if (!irqTraceEnabled) [[likely]] {
+			return nullptr;
+		}
+		// Per-CPU block may be not set up yet on this CPU
+		const auto id {arch::percpuID::read()};
+		return (id < irqTraceCPUs.size()) ? &irqTraceCPUs[id] : nullptr;
+	}
+
+	// Duration histogram bucket
+	[[nodiscard]]
+	static auto irqTraceBucket(const igros_quad_t cycles) noexcept -> igros_usize_t {
+		// Beyond 32 bits goes to last bucket
+		if (cycles > 0xFFFFFFFF_u64) [[unlikely]] {
+			return IRQ_TRACE_BUCKETS - 1_usize;
+		}
+		const auto value {static_cast<igros_dword_t>(cycles)};
+		if (value < 2_u32) {
+			return value;
+		}
+		// Power of two and next bit
+		const auto msb {static_cast<igros_dword_t>(31 - std::countl_zero(value))};
+		return (msb << 1) | ((value >> (msb - 1_u32)) & 1_u32);
+	}
+
+	// Duration histogram bucket upper bound
+	[[nodiscard]]
+	static auto irqTraceBucketBound(const igros_usize_t bucket) noexcept -> igros_quad_t {
+		if (bucket < 2_usize) {
+			return bucket;
+		}
+		const auto msb	{static_cast<igros_dword_t>(bucket >> 1)};
+		const auto half	{1_u64 << (msb - 1_u32)};
+		return (1_u64 << msb) + ((bucket & 1_usize) * half) + half - 1_u64;
+	}
+
+	// Open interrupts-off window
+	static void irqTraceOpen(const igros_pointer_t where, const igros_usize_t vector) noexcept {
+		if (const auto cpu {irqTraceCPU()}; (nullptr != cpu) && !cpu->open) {
+			cpu->window	= {arch::cpu::get().timestamp(), where, vector};
+			cpu->open	= true;
+		}
+	}
+
+	// Close interrupts-off window
+	static void irqTraceClose() noexcept {
+		const auto cpu {irqTraceCPU()};
+		if ((nullptr == cpu) || !cpu->open) {
+			return;
+		}
+		cpu->open	= false;
+		auto window	{cpu->window};
+		window.cycles	= arch::cpu::get().timestamp() - window.cycles;
+		// Keep longest ones sorted
+		const klib::kLockGuard<klib::kSpinlock<>> guard {irqTraceLock};
+		if (window.cycles <= irqTraceWindows[0].cycles) [[likely]] {
+			return;
+		}
+		auto i {0_usize};
+		for (; ((i + 1_usize) < IRQ_TRACE_WINDOWS) && (irqTraceWindows[i + 1_usize].cycles < window.cycles); i++) {
+			irqTraceWindows[i] = irqTraceWindows[i + 1_usize];
+		}
+		irqTraceWindows[i] = window;
+	}
+
+
+	// Start tracing (per-CPU data must be set up)
+	void irqTraceInit() noexcept {
+		irqTraceEnabled = true;
+	}
+
+
+	// Interrupt entry (returns handler start time)
+	[[nodiscard]]
+	auto irqTraceEnter(const igros_usize_t vector, const igros_usize_t flags) noexcept -> igros_quad_t {
+		// CPU disabled interrupts on entry
+		if (0_usize != (flags & IRQ_TRACE_FLAGS_IF)) {
+			irqTraceOpen(nullptr, vector);
+		}
+		return arch::cpu::get().timestamp();
+	}
+
+	// Interrupt handler done
+	void irqTraceExit(const igros_usize_t vector, const igros_quad_t start) noexcept {
+		const auto cycles {arch::cpu::get().timestamp() - start};
+		if (!irqTraceEnabled || (vector >= IRQ_TRACE_VECTORS)) [[unlikely]] {
+			return;
+		}
+		const klib::kLockGuard<klib::kSpinlock<>> guard {irqTraceLock};
+		auto &stats {irqTraceStats[vector]};
+		if ((0_usize == stats.count) || (cycles < stats.min)) {
+			stats.min = cycles;
+		}
+		if (cycles > stats.max) {
+			stats.max = cycles;
+		}
+		stats.count++;
+		stats.total += cycles;
+		stats.buckets[irqTraceBucket(cycles)]++;
+	}
+
+	// Return from interrupt
+	void irqTraceReturn(const igros_usize_t flags) noexcept {
+		// Return enables interrupts again
+		if (0_usize != (flags & IRQ_TRACE_FLAGS_IF)) {
+			irqTraceClose();
+		}
+	}
+
+
+	// Interrupts were disabled
+	[[gnu::noinline]]
+	void irqTraceOff() noexcept {
+		irqTraceOpen(__builtin_return_address(0), IRQ_TRACE_NO_VECTOR);
+	}
+
+	// Interrupts are going to be enabled
+	void irqTraceOn() noexcept {
+		irqTraceClose();
+	}
+
+	// Interrupts state was saved and interrupts disabled
+	[[gnu::noinline]]
+	void irqTraceSave(const igros_usize_t flags) noexcept {
+		if (0_usize != (flags & IRQ_TRACE_FLAGS_IF)) {
+			irqTraceOpen(__builtin_return_address(0), IRQ_TRACE_NO_VECTOR);
+		}
+	}
+
+	// Interrupts state is going to be restored
+	void irqTraceRestore(const igros_usize_t flags) noexcept {
+		if (0_usize != (flags & IRQ_TRACE_FLAGS_IF)) {
+			irqTraceClose();
+		}
+	}
+
+
+	// Dump collected statistics
+	void irqTraceDump() noexcept {
+
+		klib::kprintf("IRQ TRACE:\tvector: count, min/avg/p99/max cycles\n");
+		for (auto vector {0_usize}; vector < IRQ_TRACE_VECTORS; vector++) {
+
+			// Copy (printing disables interrupts too)
+			const auto flags {arch::irq::get().save()};
+			irqTraceLock.lock();
+			const auto stats {irqTraceStats[vector]};
+			irqTraceLock.unlock();
+			arch::irq::get().restore(flags);
+			if (0_usize == stats.count) {
+				continue;
+			}
+
+			// 99th percentile from histogram
+			const auto rank	{stats.count - (stats.count / 100_usize)};
+			auto seen	{0_usize};
+			auto bucket	{0_usize};
+			for (; bucket < (IRQ_TRACE_BUCKETS - 1_usize); bucket++) {
+				seen += stats.buckets[bucket];
+				if (seen >= rank) {
+					break;
+				}
+			}
+
+			klib::kprintf(
+				"IRQ TRACE:\t#%z: %z, %llu/%llu/%llu/%llu\n",
+				vector,
+				stats.count,
+				stats.min,
+				klib::kdivmod(stats.total, static_cast<igros_dword_t>(stats.count)).quotient,
+				std::min(irqTraceBucketBound(bucket), stats.max),
+				stats.max
+			);
+
+		}
+
+		// Longest windows first
+		const auto flags {arch::irq::get().save()};
+		irqTraceLock.lock();
+		const auto windows {irqTraceWindows};
+		irqTraceLock.unlock();
+		arch::irq::get().restore(flags);
+		klib::kprintf("IRQ TRACE:\tlongest interrupts-off windows\n");
+		for (auto i {IRQ_TRACE_WINDOWS}; i-- > 0_usize;) {
+			if (0_u64 == windows[i].cycles) {
+				break;
+			}
+			if (IRQ_TRACE_NO_VECTOR == windows[i].vector) {
+				klib::kprintf("IRQ TRACE:\t%llu cycles at %p\n", windows[i].cycles, windows[i].where);
+			} else {
+				klib::kprintf("IRQ TRACE:\t%llu cycles in interrupt #%z\n", windows[i].cycles, windows[i].vector);
+			}
+		}
+
+	}
+
+#else
+
+	// Dump collected statistics
+	void irqTraceDump() noexcept {
+		klib::kprintf("IRQ TRACE:\tdisabled (build with IGROS_TRACE_IRQ)\n");
+	}
+
+#endif	// IGROS_TRACE_IRQ
+
+
+}	// namespace igros::sys
+
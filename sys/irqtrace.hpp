@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////
+//
+//	Interrupts latency tracing
+//
+//	File:	irqtrace.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Interrupts latency tracing (IGROS_TRACE_IRQ build option)
+	//
+	// Handler duration is measured around every interrupt service routine
+	// call, interrupts-off windows - from disable (or interrupt entry) till
+	// enable (or return to code with interrupts enabled). Everything is in
+	// time-stamp counter cycles. Without the option hooks are empty inlines
+
+
+#if	defined (IGROS_TRACE_IRQ)
+
+	// Start tracing (per-CPU data must be set up)
+	void	irqTraceInit() noexcept;
+
+	// Interrupt entry (returns handler start time)
+	[[nodiscard]]
+	auto	irqTraceEnter(const igros_usize_t vector, const igros_usize_t flags) noexcept -> igros_quad_t;
+	// Interrupt handler done
+	void	irqTraceExit(const igros_usize_t vector, const igros_quad_t start) noexcept;
+	// Return from interrupt
+	void	irqTraceReturn(const igros_usize_t flags) noexcept;
+
+	// Interrupts were disabled
+	void	irqTraceOff() noexcept;
+	// Interrupts are going to be enabled
+	void	irqTraceOn() noexcept;
+	// Interrupts state was saved and interrupts disabled
+	void	irqTraceSave(const igros_usize_t flags) noexcept;
+	// Interrupts state is going to be restored
+	void	irqTraceRestore(const igros_usize_t flags) noexcept;
+
+#else
+
+	// Start tracing (per-CPU data must be set up)
+	inline void irqTraceInit() noexcept {}
+
+	// Interrupt entry (returns handler start time)
+	[[nodiscard]]
+	inline auto irqTraceEnter([[maybe_unused]] const igros_usize_t vector, [[maybe_unused]] const igros_usize_t flags) noexcept -> igros_quad_t {
+		return 0_u64;
+	}
+	// Interrupt handler done
+	inline void irqTraceExit([[maybe_unused]] const igros_usize_t vector, [[maybe_unused]] const igros_quad_t start) noexcept {}
+	// Return from interrupt
+	inline void irqTraceReturn([[maybe_unused]] const igros_usize_t flags) noexcept {}
+
+	// Interrupts were disabled
+	inline void irqTraceOff() noexcept {}
+	// Interrupts are going to be enabled
+	inline void irqTraceOn() noexcept {}
+	// Interrupts state was saved and interrupts disabled
+	inline void irqTraceSave([[maybe_unused]] const igros_usize_t flags) noexcept {}
+	// Interrupts state is going to be restored
+	inline void irqTraceRestore([[maybe_unused]] const igros_usize_t flags) noexcept {}
+
+#endif	// IGROS_TRACE_IRQ
+
+	// Dump collected statistics
+	void	irqTraceDump() noexcept;
+
+
+}	// namespace igros::sys
+
@@ -0,0 +1,475 @@
+////////////////////////////////////////////////////////////////
+//
+//	Kernel threads scheduler
+//
+//	File:	sched.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+#include <bit>
+// IgrOS-Kernel arch
+#include <arch/atomic.hpp>
+#include <arch/context.hpp>
+#include <arch/cpu.hpp>
+#include <arch/irq.hpp>
+#include <arch/percpu.hpp>
+#include <arch/smp.hpp>
+// IgrOS-Kernel library
+#include <klib/kLock.hpp>
+#include <klib/kRCU.hpp>
+#include <klib/kprint.hpp>
+// IgrOS-Kernel system
+#include <sys/clockevent.hpp>
+#include <sys/fpu.hpp>
+#include <sys/sched.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Run queue size (any thread is queued at most once)
+	constexpr auto SCHED_QUEUE_SIZE		{THREAD_MAX};
+	// Run queue index mask
+	constexpr auto SCHED_QUEUE_MASK		{SCHED_QUEUE_SIZE - 1_usize};
+
+	// Queue holds byte-sized control block indices
+	static_assert(std::has_single_bit(SCHED_QUEUE_SIZE) && (SCHED_QUEUE_SIZE <= 256_usize), "Bad run queue size!");
+
+
+	// Chase-Lev work-stealing deque
+	//
+	// Only owner CPU pushes at bottom. Everyone takes from top with CAS: thieves
+	// as usual and owner as well, which keeps round-robin order of each priority
+	struct schedDeque_t {
+		igros_usize_t					top;		// Next slot to take
+		igros_usize_t					bottom;		// Next slot to push
+		std::array<igros_byte_t, SCHED_QUEUE_SIZE>	slots;		// Thread control block indices
+	};
+
+	// Per-CPU scheduler state
+	struct alignas(64) schedCPU_t {
+		std::array<schedDeque_t, THREAD_PRIORITIES>	queues;		// Run queues (one per priority)
+		thread_t*					idle;		// CPU idle thread
+		thread_t*					prev;		// Thread switched out last (handled by next one)
+		igros_dword_t					seed;		// Victim choice random state
+		schedStats_t					stats;		// Load balancing statistics
+	};
+
+
+	// Per-CPU scheduler states
+	static std::array<schedCPU_t, arch::smp::MAX_CPUS>	schedCPUs	{};
+	// Idle CPUs mask
+	static igros_usize_t					schedIdleMask	{0_usize};
+
+
+	// Number of queued threads
+	[[nodiscard]]
+	static auto schedLength(const schedDeque_t &queue) noexcept -> igros_usize_t {
+		// Top first: bottom never goes below any top seen before
+		const auto top	{arch::atomic::get().load(&queue.top)};
+		return arch::atomic::get().load(&queue.bottom) - top;
+	}
+
+	// Put thread to run queue (owner only, interrupts disabled)
+	static void schedPush(schedDeque_t &queue, const thread_t* const thread) noexcept {
+		const auto bottom				{queue.bottom};
+		queue.slots[bottom & SCHED_QUEUE_MASK]		= static_cast<igros_byte_t>(thread->index);
+		// Publish slot
+		arch::atomic::get().store(&queue.bottom, bottom + 1_usize);
+	}
+
+	// Take thread from run queue top for given CPU (nullptr if empty or top one is bound to other CPU)
+	[[nodiscard]]
+	static auto schedTake(schedDeque_t &queue, const igros_usize_t id) noexcept -> thread_t* {
+		while (true) {
+			const auto top		{arch::atomic::get().load(&queue.top)};
+			const auto bottom	{arch::atomic::get().load(&queue.bottom)};
+			// Empty
+			if (top >= bottom) {
+				return nullptr;
+			}
+			// Slot can't be reused before top moves (queue never overflows)
+			const auto index	{queue.slots[top & SCHED_QUEUE_MASK]};
+			// Bound thread waits for its own CPU
+			if (const auto bound {threadAt(index)->bound}; (THREAD_CPU_ANY != bound) && (id != bound)) {
+				return nullptr;
+			}
+			if (top == arch::atomic::get().compareExchange(&queue.top, top, top + 1_usize)) {
+				return threadAt(index);
+			}
+			// Lost race to other CPU
+			arch::cpu::get().pause();
+		}
+	}
+
+	// Highest non-empty run queue (THREAD_PRIORITIES if all empty)
+	[[nodiscard]]
+	static auto schedTop(const schedCPU_t &cpu) noexcept -> igros_dword_t {
+		for (auto prio {THREAD_PRIORITIES}; prio-- > 0_u32;) {
+			if (0_usize != schedLength(cpu.queues[prio])) {
+				return prio;
+			}
+		}
+		return THREAD_PRIORITIES;
+	}
+
+
+	// Wake up some other idle CPU to pick new work
+	static void schedKick(const igros_usize_t id) noexcept {
+		const auto idle {arch::atomic::get().load(&schedIdleMask) & ~(1_usize << id)};
+		if (0_usize == idle) {
+			return;
+		}
+		// Kicked CPU marks itself idle again if it finds nothing
+		const auto target {static_cast<igros_usize_t>(std::countr_zero(idle))};
+		arch::atomic::get().bitAnd(&schedIdleMask, ~(1_usize << target));
+		arch::smp::get().kick(target);
+	}
+
+	// Put thread to current CPU run queue (interrupts disabled)
+	static void schedReady(schedCPU_t &cpu, const igros_usize_t id, thread_t* const thread) noexcept {
+		thread->state = threadState_t::READY;
+		schedPush(cpu.queues[thread->priority], thread);
+		schedKick(id);
+	}
+
+	// Steal half of highest priority run queue of random CPU (interrupts disabled)
+	[[nodiscard]]
+	static auto schedSteal(schedCPU_t &self, const igros_usize_t id) noexcept -> thread_t* {
+
+		// Nobody to steal from
+		if (arch::smp::get().count() < 2_usize) {
+			return nullptr;
+		}
+
+		// Random victim to start from (xorshift)
+		self.seed	^= self.seed << 13;
+		self.seed	^= self.seed >> 17;
+		self.seed	^= self.seed << 5;
+		const auto start {static_cast<igros_usize_t>(self.seed) % arch::smp::MAX_CPUS};
+
+		for (auto i {0_usize}; i < arch::smp::MAX_CPUS; i++) {
+
+			// Busy online CPU
+			const auto victimID {(start + i) % arch::smp::MAX_CPUS};
+			if ((id == victimID) || !arch::smp::get().isOnline(victimID)) {
+				continue;
+			}
+			auto &victim	{schedCPUs[victimID]};
+			const auto prio	{schedTop(victim)};
+			if (THREAD_PRIORITIES == prio) {
+				continue;
+			}
+
+			// Take half of it (rounded up), run first, queue the rest locally
+			auto &queue	{victim.queues[prio]};
+			auto first	{static_cast<thread_t*>(nullptr)};
+			for (auto count {(schedLength(queue) + 1_usize) >> 1}; count > 0_usize; count--) {
+				const auto thread {schedTake(queue, id)};
+				if (nullptr == thread) {
+					break;
+				}
+				self.stats.stolen++;
+				if (nullptr == first) {
+					first = thread;
+				} else {
+					schedPush(self.queues[thread->priority], thread);
+				}
+			}
+			if (nullptr != first) {
+				self.stats.steals++;
+				return first;
+			}
+
+		}
+
+		return nullptr;
+
+	}
+
+
+	// Switch to next thread (interrupts disabled)
+	void sched::switchNext() noexcept {
+
+		// Current CPU and thread
+		const auto id		{arch::percpuID::read()};
+		auto &cpu		{schedCPUs[id]};
+		const auto prev		{sched::current()};
+		const auto runnable	{(threadState_t::RUNNING == prev->state) && (prev != cpu.idle)};
+
+		// Running thread still has the highest priority
+		const auto top {schedTop(cpu)};
+		if (runnable && ((THREAD_PRIORITIES == top) || (prev->priority > top))) {
+			prev->slice = THREAD_TIME_SLICE;
+			return;
+		}
+
+		// Local work first, then other CPUs work (application processor without tick can't preempt it)
+		auto next {(THREAD_PRIORITIES != top) ? schedTake(cpu.queues[top], id) : nullptr};
+		if ((nullptr == next) && ((0_usize == id) || (nullptr != clockeventCurrent()))) {
+			next = schedSteal(cpu, id);
+		}
+		// Nothing to run - keep running or go idle
+		if (nullptr == next) {
+			if (runnable) {
+				prev->slice = THREAD_TIME_SLICE;
+				return;
+			}
+			next = cpu.idle;
+		}
+
+		// Track idle CPUs for wake ups
+		if (next == cpu.idle) {
+			arch::atomic::get().bitOr(&schedIdleMask, 1_usize << id);
+		} else {
+			arch::atomic::get().bitAnd(&schedIdleMask, ~(1_usize << id));
+		}
+		if (next == prev) {
+			return;
+		}
+
+		// Run it with fresh time slice
+		next->state	= threadState_t::RUNNING;
+		next->slice	= THREAD_TIME_SLICE;
+		next->onCPU	= 1_u32;
+		if (next->cpu != id) {
+			cpu.stats.migrations++;
+			next->cpu = id;
+		}
+		cpu.stats.switches++;
+
+		// Switch
+		cpu.prev = prev;
+		arch::percpuCurrent::write(next);
+		fpuSwitch(prev, next);
+		arch::context::get().switchTo(&prev->sp, next->sp);
+
+		// Back again (possibly on another CPU)
+		sched::tail();
+
+	}
+
+
+	// Init scheduler on current CPU (current context becomes idle thread)
+	void sched::init() noexcept {
+		const auto id	{arch::percpuID::read()};
+		auto &cpu	{schedCPUs[id]};
+		std::array<char, THREAD_NAME_SIZE> name {};
+		klib::ksnprintf(name.data(), name.size(), "idle/%z", id);
+		cpu.idle	= threadAdopt(name.data());
+		cpu.idle->onCPU	= 1_u32;
+		cpu.seed	= static_cast<igros_dword_t>(id) * 0x9E3779B9_u32 + 1_u32;
+		arch::percpuCurrent::write(cpu.idle);
+	}
+
+
+	// Get current thread
+	[[nodiscard]]
+	auto sched::current() noexcept -> thread_t* {
+		return static_cast<thread_t*>(arch::percpuCurrent::read());
+	}
+
+	// Put thread to run queue
+	void sched::enqueue(thread_t* const thread) noexcept {
+		const auto flags	{arch::irq::get().save()};
+		const auto id		{arch::percpuID::read()};
+		schedReady(schedCPUs[id], id, thread);
+		arch::irq::get().restore(flags);
+	}
+
+
+	// Timer tick (from timer interrupt)
+	void sched::tick() noexcept {
+		// Scheduler is not running on this CPU yet
+		const auto thread {sched::current()};
+		if (nullptr == thread) [[unlikely]] {
+			return;
+		}
+		const auto top {schedTop(schedCPUs[arch::percpuID::read()])};
+		// Idle CPU takes any ready thread
+		if (THREAD_PRIORITY_IDLE == thread->priority) {
+			if (THREAD_PRIORITIES != top) {
+				arch::percpuNeedResched::write(1_u32);
+			}
+			return;
+		}
+		// Time slice is over or higher priority thread is ready
+		if (0_u32 != thread->slice) {
+			thread->slice--;
+		}
+		if ((0_u32 == thread->slice) || ((THREAD_PRIORITIES != top) && (top > thread->priority))) {
+			arch::percpuNeedResched::write(1_u32);
+		}
+	}
+
+	// Reschedule if requested and allowed (interrupt exit)
+	void sched::preempt() noexcept {
+		// Idle thread reschedules from idle loop
+		if (
+			(0_u32 != arch::percpuNeedResched::read())	&&
+			(0_u32 == arch::percpuPreempt::read())		&&
+			(THREAD_PRIORITY_IDLE != sched::current()->priority)
+		) {
+			sched::schedule();
+		}
+	}
+
+
+	// Pick next thread and switch to it
+	void sched::schedule() noexcept {
+
+		// Context switch is quiescent state
+		klib::kRCU::quiescent();
+
+		// Scheduler is not running on this CPU yet
+		if (nullptr == sched::current()) [[unlikely]] {
+			return;
+		}
+
+		const auto flags {arch::irq::get().save()};
+		arch::percpuNeedResched::write(0_u32);
+		sched::switchNext();
+		arch::irq::get().restore(flags);
+
+	}
+
+	// Give up CPU
+	void sched::yield() noexcept {
+		sched::schedule();
+	}
+
+
+	// Block current thread till wake up
+	void sched::block() noexcept {
+		const auto flags	{arch::irq::get().save()};
+		const auto thread	{sched::current()};
+		thread->lock.lock();
+		// Wake up already arrived
+		if (0_u32 != thread->wakePending) {
+			thread->wakePending = 0_u32;
+			thread->lock.unlock();
+			arch::irq::get().restore(flags);
+			return;
+		}
+		thread->state = threadState_t::BLOCKED;
+		thread->lock.unlock();
+		sched::switchNext();
+		arch::irq::get().restore(flags);
+	}
+
+	// Wake up blocked thread
+	void sched::wake(thread_t* const thread) noexcept {
+		const auto flags	{arch::irq::get().save()};
+		const auto id		{arch::percpuID::read()};
+		thread->lock.lock();
+		// Blocked and switched out - put to this CPU run queue
+		if ((threadState_t::BLOCKED == thread->state) && (0_u32 == thread->onCPU)) {
+			schedReady(schedCPUs[id], id, thread);
+			// Preempt lower priority thread
+			if (const auto current {sched::current()}; (nullptr != current) && (thread->priority > current->priority)) {
+				arch::percpuNeedResched::write(1_u32);
+			}
+		// Not blocked or still switching out - don't lose wake up
+		} else if (threadState_t::DEAD != thread->state) {
+			thread->wakePending = 1_u32;
+		}
+		thread->lock.unlock();
+		arch::irq::get().restore(flags);
+	}
+
+	// Finish current thread
+	[[noreturn]]
+	void sched::exit() noexcept {
+		arch::irq::get().disable();
+		sched::current()->state = threadState_t::DEAD;
+		sched::switchNext();
+		// Dead thread never comes back
+		for (;;) {
+			arch::irq::get().disable();
+		}
+	}
+
+
+	// Finish context switch (first thing new context does)
+	void sched::tail() noexcept {
+
+		// Thread switched out
+		const auto id	{arch::percpuID::read()};
+		auto &cpu	{schedCPUs[id]};
+		const auto prev	{cpu.prev};
+		cpu.prev	= nullptr;
+		if (nullptr == prev) [[unlikely]] {
+			return;
+		}
+
+		// Its context is saved now
+		prev->lock.lock();
+		prev->onCPU = 0_u32;
+		switch (prev->state) {
+			// Preempted
+			case threadState_t::RUNNING:
+				if (prev != cpu.idle) {
+					schedReady(cpu, id, prev);
+				}
+				break;
+			// Woken up while switching out
+			case threadState_t::BLOCKED:
+				if (0_u32 != prev->wakePending) {
+					prev->wakePending = 0_u32;
+					schedReady(cpu, id, prev);
+				}
+				break;
+			default:
+				break;
+		}
+		prev->lock.unlock();
+
+		// Stack is not in use anymore
+		if (threadState_t::DEAD == prev->state) {
+			threadFree(prev);
+		}
+
+	}
+
+
+	// Get CPU load balancing statistics
+	[[nodiscard]]
+	auto sched::stats(const igros_usize_t cpu) noexcept -> schedStats_t {
+		auto stats {schedCPUs[cpu].stats};
+		stats.length = 0_usize;
+		for (const auto &queue : schedCPUs[cpu].queues) {
+			stats.length += schedLength(queue);
+		}
+		return stats;
+	}
+
+	// Dump load balancing statistics of online CPUs
+	void sched::dump() noexcept {
+		for (auto i {0_usize}; i < arch::smp::MAX_CPUS; i++) {
+			if (!arch::smp::get().isOnline(i)) {
+				continue;
+			}
+			const auto stats {sched::stats(i)};
+			klib::kprintf(
+				"SCHED CPU #%z:\tswitches %z, steals %z, stolen %z, migrations %z, queued %z\n",
+				i,
+				stats.switches,
+				stats.steals,
+				stats.stolen,
+				stats.migrations,
+				stats.length
+			);
+		}
+	}
+
+
+}	// namespace igros::sys
+
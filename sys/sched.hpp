@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////
+//
+//	Kernel threads scheduler
+//
+//	File:	sched.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+// IgrOS-Kernel system
+#include <sys/thread.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Per-CPU load balancing statistics
+	struct schedStats_t {
+		igros_usize_t	switches;		// Context switches
+		igros_usize_t	steals;			// Successful steal attempts
+		igros_usize_t	stolen;			// Threads taken from other CPUs
+		igros_usize_t	migrations;		// Threads run on other CPU than last time
+		igros_usize_t	length;			// Threads in run queues right now
+	};
+
+
+	// Preemptive priority round-robin scheduler
+	//
+	// Each CPU owns run queues (one per priority) only it pushes to, so local
+	// scheduling never takes a lock. CPU left without work steals half of the
+	// highest priority queue of a randomly chosen CPU (stopping at thread
+	// bound to victim, like per-CPU softirq one). Threads are put back
+	// to run queue only after they are switched out, so nobody can resume a
+	// thread whose context is not saved yet
+	class sched final {
+
+		// Switch to next thread (interrupts disabled)
+		static void	switchNext() noexcept;
+
+		// Copy c-tor
+		sched(const sched &other) = delete;
+		// Copy assignment
+		auto	operator=(const sched &other) -> sched& = delete;
+
+		// Move c-tor
+		sched(sched &&other) = delete;
+		// Move assignment
+		auto	operator=(sched &&other) -> sched& = delete;
+
+
+	public:
+
+		// Default c-tor
+		sched() noexcept = default;
+
+		// Init scheduler on current CPU (current context becomes idle thread)
+		static void	init() noexcept;
+
+		// Get current thread
+		[[nodiscard]]
+		static auto	current() noexcept -> thread_t*;
+
+		// Put thread to run queue
+		static void	enqueue(thread_t* const thread) noexcept;
+
+		// Timer tick (from timer interrupt)
+		static void	tick() noexcept;
+		// Reschedule if requested and allowed (interrupt exit)
+		static void	preempt() noexcept;
+
+		// Pick next thread and switch to it
+		static void	schedule() noexcept;
+		// Give up CPU
+		static void	yield() noexcept;
+
+		// Block current thread till wake up
+		static void	block() noexcept;
+		// Wake up blocked thread
+		static void	wake(thread_t* const thread) noexcept;
+		// Finish current thread
+		[[noreturn]]
+		static void	exit() noexcept;
+
+		// Finish context switch (first thing new context does)
+		static void	tail() noexcept;
+
+		// Get CPU load balancing statistics
+		[[nodiscard]]
+		static auto	stats(const igros_usize_t cpu) noexcept -> schedStats_t;
+		// Dump load balancing statistics of online CPUs
+		static void	dump() noexcept;
+
+
+	};
+
+
+}	// namespace igros::sys
+
@@ -0,0 +1,254 @@
+////////////////////////////////////////////////////////////////
+//
+//	Deferred interrupt work (softirqs and tasklets)
+//
+//	File:	softirq.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+#include <bit>
+// IgrOS-Kernel arch
+#include <arch/atomic.hpp>
+#include <arch/irq.hpp>
+#include <arch/percpu.hpp>
+#include <arch/smp.hpp>
+// IgrOS-Kernel library
+#include <klib/kprint.hpp>
+// IgrOS-Kernel system
+#include <sys/sched.hpp>
+#include <sys/softirq.hpp>
+#include <sys/thread.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Max softirq passes per run (rest goes to softirq thread)
+	constexpr auto SOFTIRQ_RESTART_MAX	{10_u32};
+
+	// Tasklet is in some CPU list
+	constexpr auto TASKLET_SCHEDULED	{0x00000001_u32};
+	// Tasklet function is running
+	constexpr auto TASKLET_RUNNING		{0x00000002_u32};
+
+
+	// Per-CPU softirq state
+	struct alignas(64) softirqCPU_t {
+		igros_dword_t		pending;		// Raised softirqs mask
+		igros_dword_t		active;			// Softirqs are running
+		igros_dword_t		handoff;		// Stop passes, let softirq thread retry
+		tasklet_t*		head;			// Scheduled tasklets
+		tasklet_t**		tail;			// Scheduled tasklets list end
+		thread_t*		thread;			// Softirq thread (runs leftovers)
+	};
+
+
+	// Softirq handlers
+	static std::array<softirqHandler_t, static_cast<igros_usize_t>(softirq_t::MAX)>	softirqHandlers	{};
+	// Per-CPU softirq states
+	static std::array<softirqCPU_t, arch::smp::MAX_CPUS>					softirqCPUs	{};
+
+
+	// Set tasklet state bit (returns old state)
+	[[nodiscard]]
+	static auto taskletSet(tasklet_t &tasklet, const igros_dword_t bit) noexcept -> igros_dword_t {
+		auto state {arch::atomic::get().load(&tasklet.state)};
+		while (0_u32 == (state & bit)) {
+			const auto old {arch::atomic::get().compareExchange(&tasklet.state, state, state | bit)};
+			if (old == state) {
+				break;
+			}
+			state = old;
+		}
+		return state;
+	}
+
+	// Put tasklet to current CPU list (interrupts disabled)
+	static void taskletAppend(softirqCPU_t &cpu, tasklet_t &tasklet) noexcept {
+		if (nullptr == cpu.tail) [[unlikely]] {
+			cpu.tail = &cpu.head;
+		}
+		tasklet.next	= nullptr;
+		*cpu.tail	= &tasklet;
+		cpu.tail	= &tasklet.next;
+		cpu.pending	|= 1_u32 << static_cast<igros_dword_t>(softirq_t::TASKLET);
+	}
+
+	// Tasklets softirq
+	static void taskletAction() noexcept {
+		auto &cpu {softirqCPUs[arch::percpuID::read()]};
+		// Take whole list
+		arch::irq::get().disable();
+		auto tasklet	{cpu.head};
+		cpu.head	= nullptr;
+		cpu.tail	= &cpu.head;
+		arch::irq::get().enable();
+		while (nullptr != tasklet) {
+			const auto next {tasklet->next};
+			// Running on other CPU - softirq thread tries again later instead of spinning passes
+			if (0_u32 != (taskletSet(*tasklet, TASKLET_RUNNING) & TASKLET_RUNNING)) {
+				arch::irq::get().disable();
+				taskletAppend(cpu, *tasklet);
+				cpu.handoff = 1_u32;
+				arch::irq::get().enable();
+			} else {
+				// May be scheduled again from now on
+				arch::atomic::get().bitAnd(&tasklet->state, ~TASKLET_SCHEDULED);
+				tasklet->func(tasklet->arg);
+				arch::atomic::get().bitAnd(&tasklet->state, ~TASKLET_RUNNING);
+			}
+			tasklet = next;
+		}
+	}
+
+
+	// Wake up softirq thread of current CPU if not in interrupt (interrupts disabled)
+	static void softirqWake(const softirqCPU_t &cpu) noexcept {
+		// Interrupt exit and running softirqs pick it up themselves
+		if ((0_usize != arch::percpuIRQNesting::read()) || (0_u32 != cpu.active) || (nullptr == cpu.thread)) {
+			return;
+		}
+		sched::wake(cpu.thread);
+	}
+
+	// Softirq thread body (bound to its CPU)
+	static void softirqThread([[maybe_unused]] const igros_pointer_t arg) noexcept {
+		const auto &cpu {softirqCPUs[arch::percpuID::read()]};
+		while (true) {
+			softirqRun();
+			// Sleep till more is handed over (wake up is never lost)
+			arch::irq::get().disable();
+			const auto pending {cpu.pending};
+			arch::irq::get().enable();
+			if (0_u32 == pending) {
+				sched::block();
+			} else {
+				// Leftovers - let other threads run first
+				sched::yield();
+			}
+		}
+	}
+
+
+	// Install softirq handler
+	void softirqInstall(const softirq_t number, const softirqHandler_t handler) noexcept {
+		softirqHandlers[static_cast<igros_usize_t>(number)] = handler;
+	}
+
+	// Mark softirq pending on current CPU
+	void softirqRaise(const softirq_t number) noexcept {
+		const auto flags {arch::irq::get().save()};
+		auto &cpu	{softirqCPUs[arch::percpuID::read()]};
+		cpu.pending	|= 1_u32 << static_cast<igros_dword_t>(number);
+		softirqWake(cpu);
+		arch::irq::get().restore(flags);
+	}
+
+	// Check pending softirqs of current CPU (interrupts disabled)
+	[[nodiscard]]
+	auto softirqPending() noexcept -> bool {
+		return 0_u32 != softirqCPUs[arch::percpuID::read()].pending;
+	}
+
+	// Run pending softirqs of current CPU (outermost interrupt exit, idle loop or softirq thread)
+	void softirqRun() noexcept {
+
+		const auto flags	{arch::irq::get().save()};
+		auto &cpu		{softirqCPUs[arch::percpuID::read()]};
+
+		// Nothing to do or interrupted softirq itself
+		if ((0_u32 == cpu.pending) || (0_u32 != cpu.active)) [[likely]] {
+			arch::irq::get().restore(flags);
+			return;
+		}
+
+		// Stay on this CPU
+		cpu.active	= 1_u32;
+		cpu.handoff	= 0_u32;
+		arch::percpuPreempt::add(1_u32);
+
+		for (auto pass {0_u32}; (pass < SOFTIRQ_RESTART_MAX) && (0_u32 != cpu.pending) && (0_u32 == cpu.handoff); pass++) {
+			auto pending	{cpu.pending};
+			cpu.pending	= 0_u32;
+			// New interrupts may come and raise more
+			arch::irq::get().enable();
+			while (0_u32 != pending) {
+				const auto number	{std::countr_zero(pending)};
+				pending			&= pending - 1_u32;
+				if (const auto handler {softirqHandlers[static_cast<igros_usize_t>(number)]}; nullptr != handler) [[likely]] {
+					handler();
+				}
+			}
+			arch::irq::get().disable();
+		}
+
+		cpu.active = 0_u32;
+		arch::percpuPreempt::add(~0_u32);
+		// Too much work or busy tasklet - rest is done in thread context
+		if ((0_u32 != cpu.pending) && (nullptr != cpu.thread)) {
+			sched::wake(cpu.thread);
+		}
+		arch::irq::get().restore(flags);
+
+	}
+
+
+	// Interrupt handler entry
+	void softirqIRQEnter() noexcept {
+		arch::percpuIRQNesting::add(1_usize);
+	}
+
+	// Interrupt handler done (runs pending softirqs if interrupted code allows interrupts)
+	void softirqIRQExit(const bool run) noexcept {
+		arch::percpuIRQNesting::add(~0_usize);
+		if (run) {
+			softirqRun();
+		}
+	}
+
+
+	// Start softirq thread of current CPU
+	void softirqThreadInit() noexcept {
+		const auto id {arch::percpuID::read()};
+		std::array<char, THREAD_NAME_SIZE> name {};
+		klib::ksnprintf(name.data(), name.size(), "ksoftirqd/%z", id);
+		const auto thread {threadCreate(name.data(), softirqThread, nullptr, THREAD_PRIORITY_NORMAL, true)};
+		if (nullptr == thread) [[unlikely]] {
+			klib::kprintf("SOFTIRQ:\tNo thread on CPU %z, leftovers wait for interrupts\n", id);
+			return;
+		}
+		const auto flags {arch::irq::get().save()};
+		softirqCPUs[id].thread = thread;
+		arch::irq::get().restore(flags);
+	}
+
+	// Init softirqs and tasklets (and softirq thread of bootstrap processor)
+	void softirqInit() noexcept {
+		softirqInstall(softirq_t::TASKLET, taskletAction);
+		softirqThreadInit();
+	}
+
+
+	// Schedule tasklet on current CPU (no-op if scheduled already)
+	void taskletSchedule(tasklet_t &tasklet) noexcept {
+		if (0_u32 != (taskletSet(tasklet, TASKLET_SCHEDULED) & TASKLET_SCHEDULED)) {
+			return;
+		}
+		const auto flags	{arch::irq::get().save()};
+		auto &cpu		{softirqCPUs[arch::percpuID::read()]};
+		taskletAppend(cpu, tasklet);
+		softirqWake(cpu);
+		arch::irq::get().restore(flags);
+	}
+
+
+}	// namespace igros::sys
+
@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////
+//
+//	Deferred interrupt work (softirqs and tasklets)
+//
+//	File:	softirq.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Deferred interrupt work
+	//
+	// Interrupt handler (top half) only acknowledges hardware and raises
+	// softirq. Raised softirqs run on the same CPU at outermost interrupt exit
+	// with interrupts enabled and preemption disabled, so they must not sleep.
+	// Ones raised from thread context wake per-CPU softirq thread, idle loop
+	// runs pending ones before it sleeps, and work left after a few passes
+	// (or tasklet busy on other CPU) is handed over to softirq thread too, so
+	// nothing waits for next interrupt. Work that sleeps or takes long goes
+	// to workqueue instead
+
+
+	// Softirq number (lower runs first)
+	enum class softirq_t : igros_dword_t {
+		TIMER,					// Timer bottom half
+		TASKLET,				// Tasklets
+		MAX					// Number of softirqs
+	};
+
+	// Softirq handler
+	using softirqHandler_t	= std::add_pointer_t<void ()>;
+
+	// Tasklet function
+	using taskletFunc_t	= std::add_pointer_t<void (igros_pointer_t)>;
+
+
+	// Tasklet (never runs on two CPUs at once)
+	struct tasklet_t {
+		tasklet_t*		next;			// Next scheduled tasklet
+		taskletFunc_t		func;			// Tasklet function
+		igros_pointer_t		arg;			// Function argument
+		igros_dword_t		state;			// Scheduled/running state bits
+	};
+
+
+	// Install softirq handler
+	void	softirqInstall(const softirq_t number, const softirqHandler_t handler) noexcept;
+	// Mark softirq pending on current CPU
+	void	softirqRaise(const softirq_t number) noexcept;
+	// Check pending softirqs of current CPU (interrupts disabled)
+	[[nodiscard]]
+	auto	softirqPending() noexcept -> bool;
+	// Run pending softirqs of current CPU (outermost interrupt exit, idle loop or softirq thread)
+	void	softirqRun() noexcept;
+
+	// Interrupt handler entry
+	void	softirqIRQEnter() noexcept;
+	// Interrupt handler done (runs pending softirqs if interrupted code allows interrupts)
+	void	softirqIRQExit(const bool run) noexcept;
+
+	// Start softirq thread of current CPU
+	void	softirqThreadInit() noexcept;
+	// Init softirqs and tasklets (and softirq thread of bootstrap processor)
+	void	softirqInit() noexcept;
+
+	// Schedule tasklet on current CPU (no-op if scheduled already)
+	void	taskletSchedule(tasklet_t &tasklet) noexcept;
+
+
+}	// namespace igros::sys
+
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////
+//
+//	Kernel threads
+//
+//	File:	thread.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+#include <bit>
+// IgrOS-Kernel arch
+#include <arch/context.hpp>
+#include <arch/irq.hpp>
+#include <arch/paging.hpp>
+#include <arch/percpu.hpp>
+// IgrOS-Kernel library
+#include <klib/kLock.hpp>
+#include <klib/kprint.hpp>
+// IgrOS-Kernel system
+#include <sys/fpu.hpp>
+#include <sys/sched.hpp>
+#include <sys/thread.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Thread control blocks pool
+	static std::array<thread_t, THREAD_MAX>	threadPool {};
+	// Thread control blocks pool lock
+	static klib::kSpinlock<>		threadLock {};
+	// Next thread ID
+	static igros_usize_t			threadNextID {0_usize};
+
+	static_assert(THREAD_MAX <= arch::paging::STACK_SLOTS, "Not every thread has stack slot!");
+
+
+	// Take free control block from pool
+	[[nodiscard]]
+	static auto threadAlloc(const char* const name) noexcept -> thread_t* {
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {threadLock};
+		for (auto &thread : threadPool) {
+			if (threadState_t::FREE == thread.state) {
+				thread.sp		= 0_usize;
+				thread.id		= threadNextID++;
+				thread.index		= static_cast<igros_usize_t>(&thread - threadPool.data());
+				thread.state		= threadState_t::BLOCKED;
+				thread.priority		= THREAD_PRIORITY_IDLE;
+				thread.slice		= 0_u32;
+				thread.wakePending	= 0_u32;
+				thread.onCPU		= 0_u32;
+				thread.cpu		= arch::percpuID::read();
+				thread.bound		= THREAD_CPU_ANY;
+				thread.stack		= nullptr;
+				thread.fpu		= nullptr;
+				thread.fpuCPU		= ~0_usize;
+				thread.entry		= nullptr;
+				thread.arg		= nullptr;
+				klib::ksnprintf(thread.name.data(), thread.name.size(), "%s", name);
+				return &thread;
+			}
+		}
+		return nullptr;
+	}
+
+
+	// New thread starts here
+	static void threadStart(const igros_pointer_t arg) noexcept {
+		// Finish switch started by previous thread
+		sched::tail();
+		arch::irq::get().enable();
+		// Run thread body
+		const auto thread {static_cast<thread_t*>(arg)};
+		thread->entry(thread->arg);
+		// Thread returned
+		threadExit();
+	}
+
+
+	// Create kernel thread (ready to run, bound one never leaves current CPU and is woken only from it)
+	[[nodiscard]]
+	auto threadCreate(const char* const name, const threadEntry_t entry, const igros_pointer_t arg, const igros_dword_t priority, const bool bound) noexcept -> thread_t* {
+
+		// Check entry and priority
+		if ((nullptr == entry) || (THREAD_PRIORITY_IDLE == priority) || (priority >= THREAD_PRIORITIES)) [[unlikely]] {
+			return nullptr;
+		}
+
+		// Allocate control block
+		auto thread {threadAlloc(name)};
+		if (nullptr == thread) [[unlikely]] {
+			klib::kprintf("THREAD:\tOut of control blocks for \"%s\"\n", name);
+			return nullptr;
+		}
+
+		// Stack of control block slot (guard page below catches overflow)
+		thread->stack = arch::paging::get().stack(thread->index);
+		if (nullptr == thread->stack) [[unlikely]] {
+			klib::kprintf("THREAD:\tOut of memory for \"%s\" stack\n", name);
+			threadFree(thread);
+			return nullptr;
+		}
+
+		// Setup thread
+		thread->priority	= priority;
+		thread->slice		= THREAD_TIME_SLICE;
+		thread->entry		= entry;
+		thread->arg		= arg;
+		// Queued on current CPU right below, so stealers see binding already
+		thread->bound		= bound ? arch::percpuID::read() : THREAD_CPU_ANY;
+		// Initial context returns to thread start
+		const auto stackTop	{std::bit_cast<igros_usize_t>(thread->stack) + arch::paging::STACK_SIZE};
+		thread->sp		= arch::context::get().init(stackTop, threadStart, thread);
+
+		// Ready to go
+		thread->state		= threadState_t::READY;
+		sched::enqueue(thread);
+		return thread;
+
+	}
+
+	// Adopt current execution context as CPU idle thread
+	[[nodiscard]]
+	auto threadAdopt(const char* const name) noexcept -> thread_t* {
+		auto thread {threadAlloc(name)};
+		if (nullptr != thread) [[likely]] {
+			thread->state		= threadState_t::RUNNING;
+			thread->priority	= THREAD_PRIORITY_IDLE;
+		}
+		return thread;
+	}
+
+	// Release thread control block (stack stays mapped for next thread of slot)
+	void threadFree(thread_t* const thread) noexcept {
+		fpuRelease(thread);
+		thread->stack = nullptr;
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {threadLock};
+		thread->state = threadState_t::FREE;
+	}
+
+
+	// Get thread by control block index
+	[[nodiscard]]
+	auto threadAt(const igros_usize_t index) noexcept -> thread_t* {
+		return &threadPool[index];
+	}
+
+
+	// Exit current thread
+	[[noreturn]]
+	void threadExit() noexcept {
+		sched::exit();
+	}
+
+
+}	// namespace igros::sys
+
@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////////
+//
+//	Kernel threads
+//
+//	File:	thread.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <array>
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+// IgrOS-Kernel library
+#include <klib/kLock.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Max number of threads
+	constexpr auto THREAD_MAX		{64_usize};
+	// Thread name size
+	constexpr auto THREAD_NAME_SIZE		{32_usize};
+	// Number of priority levels
+	constexpr auto THREAD_PRIORITIES	{8_u32};
+
+	// Idle priority (per-CPU idle threads only)
+	constexpr auto THREAD_PRIORITY_IDLE	{0_u32};
+	// Low priority
+	constexpr auto THREAD_PRIORITY_LOW	{1_u32};
+	// Normal priority
+	constexpr auto THREAD_PRIORITY_NORMAL	{4_u32};
+	// High priority
+	constexpr auto THREAD_PRIORITY_HIGH	{THREAD_PRIORITIES - 1_u32};
+
+	// Time slice (in timer ticks)
+	constexpr auto THREAD_TIME_SLICE	{5_u32};
+
+	// Thread may run on any CPU
+	constexpr auto THREAD_CPU_ANY		{~0_usize};
+
+
+	// Thread state
+	enum class threadState_t : igros_dword_t {
+		FREE,					// Unused control block
+		READY,					// Waiting in run queue
+		RUNNING,				// Running on CPU
+		BLOCKED,				// Waiting for wake up
+		DEAD					// Exited, waiting for reclaim
+	};
+
+	// Thread entry function
+	using threadEntry_t	= std::add_pointer_t<void (igros_pointer_t)>;
+
+
+	// Thread control block
+	struct thread_t {
+		igros_usize_t				sp;		// Saved stack pointer
+		igros_usize_t				id;		// Thread ID
+		igros_usize_t				index;		// Control block index in pool
+		klib::kSpinlock<>			lock;		// Block/wake up state lock
+		threadState_t				state;		// Thread state
+		igros_dword_t				priority;	// Thread priority
+		igros_dword_t				slice;		// Time slice left
+		igros_dword_t				wakePending;	// Wake up arrived before block
+		igros_dword_t				onCPU;		// Context not saved yet
+		igros_usize_t				cpu;		// Last CPU thread ran on
+		igros_usize_t				bound;		// Only CPU thread runs on (THREAD_CPU_ANY - any)
+		igros_pointer_t				stack;		// Stack bottom (nullptr for boot stack)
+		igros_pointer_t				fpu;		// FPU state area (allocated on first use)
+		igros_usize_t				fpuCPU;		// CPU holding FPU state in registers
+		threadEntry_t				entry;		// Entry function
+		igros_pointer_t				arg;		// Entry argument
+		std::array<char, THREAD_NAME_SIZE>	name;		// Thread name
+	};
+
+
+	// Create kernel thread (ready to run, bound one never leaves current CPU and is woken only from it)
+	[[nodiscard]]
+	auto	threadCreate(const char* const name, const threadEntry_t entry, const igros_pointer_t arg, const igros_dword_t priority = THREAD_PRIORITY_NORMAL, const bool bound = false) noexcept -> thread_t*;
+	// Adopt current execution context as CPU idle thread
+	[[nodiscard]]
+	auto	threadAdopt(const char* const name) noexcept -> thread_t*;
+	// Release thread control block (stack stays mapped for next thread of slot)
+	void	threadFree(thread_t* const thread) noexcept;
+	// Get thread by control block index
+	[[nodiscard]]
+	auto	threadAt(const igros_usize_t index) noexcept -> thread_t*;
+
+	// Exit current thread
+	[[noreturn]]
+	void	threadExit() noexcept;
+
+
+}	// namespace igros::sys
+
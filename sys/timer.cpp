@@ -0,0 +1,377 @@
+////////////////////////////////////////////////////////////////
+//
+//	Software timers
+//
+//	File:	timer.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+// IgrOS-Kernel arch
+#include <arch/irq.hpp>
+#include <arch/percpu.hpp>
+#include <arch/smp.hpp>
+// IgrOS-Kernel library
+#include <klib/kLock.hpp>
+#include <klib/kmath.hpp>
+// IgrOS-Kernel system
+#include <sys/clockevent.hpp>
+#include <sys/softirq.hpp>
+#include <sys/timer.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Wheel root (next ticks) slots
+	constexpr auto TIMER_ROOT_BITS		{8_u32};
+	constexpr auto TIMER_ROOT_SIZE		{1_usize << TIMER_ROOT_BITS};
+	constexpr auto TIMER_ROOT_MASK		{TIMER_ROOT_SIZE - 1_usize};
+	// Wheel upper level slots
+	constexpr auto TIMER_LEVEL_BITS		{6_u32};
+	constexpr auto TIMER_LEVEL_SIZE		{1_usize << TIMER_LEVEL_BITS};
+	constexpr auto TIMER_LEVEL_MASK		{TIMER_LEVEL_SIZE - 1_usize};
+	// Wheel upper levels
+	constexpr auto TIMER_LEVELS		{4_usize};
+	// Longest delay (ticks, whole wheel)
+	constexpr auto TIMER_DELAY_MAX		{(1_u64 << (TIMER_ROOT_BITS + TIMER_LEVELS * TIMER_LEVEL_BITS)) - 1_u64};
+
+	// High resolution timers per CPU
+	constexpr auto HRTIMER_MAX		{128_usize};
+
+
+	// Per-CPU timers
+	struct alignas(64) timerBase_t {
+		klib::kSpinlock<>						lock;		// Timers lock
+		igros_quad_t							clock;		// Next tick to process
+		igros_usize_t							count;		// Pending wheel timers
+		std::array<timer_t*, TIMER_ROOT_SIZE>				root;		// Next ticks slots
+		std::array<std::array<timer_t*, TIMER_LEVEL_SIZE>, TIMER_LEVELS>	levels;		// Farther ticks slots
+		igros_usize_t							size;		// Pending high resolution timers
+		std::array<hrtimer_t*, HRTIMER_MAX>				heap;		// High resolution timers min-heap
+	};
+
+
+	// Per-CPU timers
+	static std::array<timerBase_t, arch::smp::MAX_CPUS>	timerBases	{};
+
+
+	// Put timer to wheel slot (base locked)
+	static void timerEnqueue(timerBase_t &base, timer_t &timer) noexcept {
+		const auto delta	{timer.expires - base.clock};
+		// Already expired ones go to current slot
+		auto slot		{&base.root[static_cast<igros_usize_t>(base.clock) & TIMER_ROOT_MASK]};
+		if (static_cast<igros_squad_t>(delta) < 0_i64) {
+			// Keep current slot
+		} else if (delta < TIMER_ROOT_SIZE) {
+			slot = &base.root[static_cast<igros_usize_t>(timer.expires) & TIMER_ROOT_MASK];
+		} else {
+			// Level covers 64 times longer span than one below
+			for (auto level {0_usize}; level < TIMER_LEVELS; level++) {
+				const auto shift {TIMER_ROOT_BITS + static_cast<igros_dword_t>(level) * TIMER_LEVEL_BITS};
+				if ((delta < (1_u64 << (shift + TIMER_LEVEL_BITS))) || ((TIMER_LEVELS - 1_usize) == level)) {
+					slot = &base.levels[level][static_cast<igros_usize_t>(timer.expires >> shift) & TIMER_LEVEL_MASK];
+					break;
+				}
+			}
+		}
+		// Link at slot head
+		timer.next = *slot;
+		if (nullptr != timer.next) {
+			timer.next->pprev = &timer.next;
+		}
+		timer.pprev	= slot;
+		*slot		= &timer;
+	}
+
+	// Take timer off its list (base locked)
+	static void timerUnlink(timerBase_t &base, timer_t &timer) noexcept {
+		*timer.pprev = timer.next;
+		if (nullptr != timer.next) {
+			timer.next->pprev = timer.pprev;
+		}
+		timer.next	= nullptr;
+		timer.pprev	= nullptr;
+		base.count--;
+	}
+
+	// Move timers of current upper level slot down (returns slot index, base locked)
+	static auto timerCascade(timerBase_t &base, const igros_usize_t level) noexcept -> igros_usize_t {
+		const auto shift	{TIMER_ROOT_BITS + static_cast<igros_dword_t>(level) * TIMER_LEVEL_BITS};
+		const auto index	{static_cast<igros_usize_t>(base.clock >> shift) & TIMER_LEVEL_MASK};
+		auto list		{base.levels[level][index]};
+		base.levels[level][index] = nullptr;
+		while (nullptr != list) {
+			const auto next {list->next};
+			timerEnqueue(base, *list);
+			list = next;
+		}
+		return index;
+	}
+
+
+	// Tick of kernel time
+	[[nodiscard]]
+	static auto timerTick(const igros_quad_t ns) noexcept -> igros_quad_t {
+		return klib::kdivmod(ns, TICK_NSEC).quotient;
+	}
+
+
+	// Heap entry moved (base locked)
+	static void hrtimerPlace(timerBase_t &base, const igros_usize_t pos, hrtimer_t* const timer) noexcept {
+		base.heap[pos]	= timer;
+		timer->index	= pos + 1_usize;
+	}
+
+	// Restore heap order from position (base locked)
+	static void hrtimerSift(timerBase_t &base, igros_usize_t pos) noexcept {
+		const auto timer {base.heap[pos]};
+		// Up while parent expires later
+		while (0_usize != pos) {
+			const auto parent {(pos - 1_usize) >> 1};
+			if (base.heap[parent]->expires <= timer->expires) {
+				break;
+			}
+			hrtimerPlace(base, pos, base.heap[parent]);
+			pos = parent;
+		}
+		// Down while child expires earlier
+		for (;;) {
+			auto child {(pos << 1) + 1_usize};
+			if (child >= base.size) {
+				break;
+			}
+			if (((child + 1_usize) < base.size) && (base.heap[child + 1_usize]->expires < base.heap[child]->expires)) {
+				child++;
+			}
+			if (base.heap[child]->expires >= timer->expires) {
+				break;
+			}
+			hrtimerPlace(base, pos, base.heap[child]);
+			pos = child;
+		}
+		hrtimerPlace(base, pos, timer);
+	}
+
+	// Take timer off heap (base locked)
+	static void hrtimerRemove(timerBase_t &base, hrtimer_t &timer) noexcept {
+		const auto pos	{timer.index - 1_usize};
+		timer.index	= 0_usize;
+		// Last one fills the hole
+		if (const auto last {--base.size}; pos != last) {
+			hrtimerPlace(base, pos, base.heap[last]);
+			hrtimerSift(base, pos);
+		}
+	}
+
+
+	// Run expired high resolution timers of current CPU
+	static void hrtimerRun(timerBase_t &base) noexcept {
+		auto flags	{arch::irq::get().save()};
+		auto expired	{false};
+		base.lock.lock();
+		for (auto now {ktimeGetNs()}; (0_usize != base.size) && (base.heap[0_usize]->expires <= now); now = ktimeGetNs()) {
+			const auto timer	{base.heap[0_usize]};
+			const auto func		{timer->func};
+			const auto arg		{timer->arg};
+			hrtimerRemove(base, *timer);
+			expired = true;
+			// Callback may restart timer
+			base.lock.unlock();
+			arch::irq::get().restore(flags);
+			func(arg);
+			flags = arch::irq::get().save();
+			base.lock.lock();
+		}
+		base.lock.unlock();
+		// Device waits for next deadline
+		if (expired) {
+			tickUpdate();
+		}
+		arch::irq::get().restore(flags);
+	}
+
+	// Run expired wheel timers of current CPU
+	static void timerRun(timerBase_t &base) noexcept {
+		const auto jiffies	{timerTick(ktimeGetNs())};
+		auto flags		{arch::irq::get().save()};
+		base.lock.lock();
+		// Empty wheel just catches up
+		if (0_usize == base.count) {
+			base.clock = jiffies + 1_u64;
+		}
+		while (base.clock <= jiffies) {
+			// Root turned around - next upper slots come down
+			const auto index {static_cast<igros_usize_t>(base.clock) & TIMER_ROOT_MASK};
+			if (0_usize == index) {
+				for (auto level {0_usize}; level < TIMER_LEVELS; level++) {
+					// Upper level did not turn around
+					if (0_usize != timerCascade(base, level)) {
+						break;
+					}
+				}
+			}
+			// Whole slot at once (cancel still works on detached list)
+			timer_t* expired {base.root[index]};
+			base.root[index] = nullptr;
+			if (nullptr != expired) {
+				expired->pprev = &expired;
+			}
+			base.clock++;
+			while (nullptr != expired) {
+				const auto timer	{expired};
+				const auto func		{timer->func};
+				const auto arg		{timer->arg};
+				timerUnlink(base, *timer);
+				// Callback may restart timer
+				base.lock.unlock();
+				arch::irq::get().restore(flags);
+				func(arg);
+				flags = arch::irq::get().save();
+				base.lock.lock();
+			}
+		}
+		base.lock.unlock();
+		arch::irq::get().restore(flags);
+	}
+
+	// Timer softirq
+	static void timerSoftirq() noexcept {
+		auto &base {timerBases[arch::percpuID::read()]};
+		hrtimerRun(base);
+		timerRun(base);
+	}
+
+
+	// Current tick number
+	[[nodiscard]]
+	auto timerJiffies() noexcept -> igros_quad_t {
+		return timerTick(ktimeGetNs());
+	}
+
+	// (Re)start timer on current CPU, fires not earlier than after given ns
+	void timerStart(timer_t &timer, const igros_quad_t ns) noexcept {
+		static_cast<void>(timerCancel(timer));
+		const auto now		{ktimeGetNs()};
+		const auto jiffies	{timerTick(now)};
+		// First tick boundary after deadline
+		const auto delay	{(ns < (TIMER_DELAY_MAX * TICK_NSEC)) ? ns : (TIMER_DELAY_MAX * TICK_NSEC)};
+		const auto expires	{timerTick(now + delay + TICK_NSEC - 1_u64)};
+		const auto id		{arch::percpuID::read()};
+		auto &base		{timerBases[id]};
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {base.lock};
+		// Idle wheel has not followed time
+		if (0_usize == base.count) {
+			base.clock = jiffies;
+		}
+		timer.expires	= (expires > jiffies) ? expires : jiffies;
+		timer.cpu	= id;
+		timerEnqueue(base, timer);
+		base.count++;
+	}
+
+	// Cancel timer (false if it was not pending, running callback is not waited)
+	auto timerCancel(timer_t &timer) noexcept -> bool {
+		auto &base {timerBases[timer.cpu]};
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {base.lock};
+		if (nullptr == timer.pprev) {
+			return false;
+		}
+		timerUnlink(base, timer);
+		return true;
+	}
+
+	// Check if timer is pending
+	[[nodiscard]]
+	auto timerPending(const timer_t &timer) noexcept -> bool {
+		return nullptr != timer.pprev;
+	}
+
+
+	// (Re)start high resolution timer on current CPU (false if heap is full)
+	[[nodiscard]]
+	auto hrtimerStart(hrtimer_t &timer, const igros_quad_t ns) noexcept -> bool {
+		static_cast<void>(hrtimerCancel(timer));
+		const auto id		{arch::percpuID::read()};
+		auto &base		{timerBases[id]};
+		const auto flags	{arch::irq::get().save()};
+		base.lock.lock();
+		if (base.size >= HRTIMER_MAX) [[unlikely]] {
+			base.lock.unlock();
+			arch::irq::get().restore(flags);
+			return false;
+		}
+		timer.expires	= ktimeGetNs() + ns;
+		timer.cpu	= id;
+		hrtimerPlace(base, base.size++, &timer);
+		hrtimerSift(base, timer.index - 1_usize);
+		const auto first {1_usize == timer.index};
+		base.lock.unlock();
+		// New earliest deadline
+		if (first) {
+			tickUpdate();
+		}
+		arch::irq::get().restore(flags);
+		return true;
+	}
+
+	// Cancel high resolution timer (false if it was not pending)
+	auto hrtimerCancel(hrtimer_t &timer) noexcept -> bool {
+		auto &base {timerBases[timer.cpu]};
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {base.lock};
+		if (0_usize == timer.index) {
+			return false;
+		}
+		// Device may fire early once - harmless
+		hrtimerRemove(base, timer);
+		return true;
+	}
+
+
+	// Earliest wheel expiry of current CPU (kernel time, ~0 if none)
+	[[nodiscard]]
+	auto timerNextEvent() noexcept -> igros_quad_t {
+		auto &base {timerBases[arch::percpuID::read()]};
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {base.lock};
+		if (0_usize == base.count) {
+			return ~0_u64;
+		}
+		// Nearest non-empty slot before root turns around
+		for (auto offset {0_usize}; offset < TIMER_ROOT_SIZE; offset++) {
+			const auto jiffy	{base.clock + offset};
+			const auto index	{static_cast<igros_usize_t>(jiffy) & TIMER_ROOT_MASK};
+			if (nullptr != base.root[index]) {
+				return jiffy * TICK_NSEC;
+			}
+			if (TIMER_ROOT_MASK == index) {
+				break;
+			}
+		}
+		// Upper levels are looked at when they cascade
+		return ((base.clock | TIMER_ROOT_MASK) + 1_u64) * TICK_NSEC;
+	}
+
+	// Earliest high resolution expiry of current CPU (kernel time, ~0 if none)
+	[[nodiscard]]
+	auto hrtimerNextEvent() noexcept -> igros_quad_t {
+		auto &base {timerBases[arch::percpuID::read()]};
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {base.lock};
+		return (0_usize != base.size) ? base.heap[0_usize]->expires : ~0_u64;
+	}
+
+
+	// Init software timers (takes timer softirq)
+	void timerInit() noexcept {
+		softirqInstall(softirq_t::TIMER, timerSoftirq);
+	}
+
+
+}	// namespace igros::sys
+
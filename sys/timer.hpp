@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////
+//
+//	Software timers
+//
+//	File:	timer.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Software timers
+	//
+	// Timers live in per-CPU hierarchical wheel with tick (jiffy) resolution:
+	// 256 slots for next ticks and four 64-slot levels for farther ones,
+	// cascaded down as wheel turns. Start and cancel are O(1) list operations
+	// no matter how many timers are pending. Expired slot is taken off at
+	// once and its timers run from timer softirq. High resolution timers sit
+	// in per-CPU min-heap ordered by nanosecond deadline and program clock
+	// event device directly. Start and cancel of one timer must not race
+	// each other, callbacks must not sleep
+
+
+	// Timer callback (timer softirq)
+	using timerFunc_t	= std::add_pointer_t<void (igros_pointer_t)>;
+
+
+	// Wheel timer (zero initialized except callback)
+	struct timer_t {
+		timer_t*		next;			// Next timer in slot
+		timer_t**		pprev;			// Link pointing here (nullptr - not pending)
+		igros_quad_t		expires;		// Expiry tick
+		timerFunc_t		func;			// Callback
+		igros_pointer_t		arg;			// Callback argument
+		igros_usize_t		cpu;			// Owner wheel
+	};
+
+	// High resolution timer (zero initialized except callback)
+	struct hrtimer_t {
+		igros_quad_t		expires;		// Expiry time (kernel time)
+		timerFunc_t		func;			// Callback
+		igros_pointer_t		arg;			// Callback argument
+		igros_usize_t		cpu;			// Owner heap
+		igros_usize_t		index;			// Heap position + 1 (0 - not pending)
+	};
+
+
+	// Current tick number
+	[[nodiscard]]
+	auto	timerJiffies() noexcept -> igros_quad_t;
+
+	// (Re)start timer on current CPU, fires not earlier than after given ns
+	void	timerStart(timer_t &timer, const igros_quad_t ns) noexcept;
+	// Cancel timer (false if it was not pending, running callback is not waited)
+	auto	timerCancel(timer_t &timer) noexcept -> bool;
+	// Check if timer is pending
+	[[nodiscard]]
+	auto	timerPending(const timer_t &timer) noexcept -> bool;
+
+	// (Re)start high resolution timer on current CPU (false if heap is full)
+	[[nodiscard]]
+	auto	hrtimerStart(hrtimer_t &timer, const igros_quad_t ns) noexcept -> bool;
+	// Cancel high resolution timer (false if it was not pending)
+	auto	hrtimerCancel(hrtimer_t &timer) noexcept -> bool;
+
+	// Earliest wheel expiry of current CPU (kernel time, ~0 if none)
+	[[nodiscard]]
+	auto	timerNextEvent() noexcept -> igros_quad_t;
+	// Earliest high resolution expiry of current CPU (kernel time, ~0 if none)
+	[[nodiscard]]
+	auto	hrtimerNextEvent() noexcept -> igros_quad_t;
+
+	// Init software timers (takes timer softirq)
+	void	timerInit() noexcept;
+
+
+}	// namespace igros::sys
+
@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////
+//
+//	Workqueues (deferred work in thread context)
+//
+//	File:	workqueue.cpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+// C++
+#include <array>
+// IgrOS-Kernel arch
+#include <arch/atomic.hpp>
+// IgrOS-Kernel library
+#include <klib/kLock.hpp>
+#include <klib/kprint.hpp>
+// IgrOS-Kernel system
+#include <sys/sched.hpp>
+#include <sys/workqueue.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Workqueue (FIFO served by single worker thread)
+	struct workqueue_t {
+		klib::kSpinlock<>	lock;			// Queue lock
+		work_t*			head;			// First queued work
+		work_t**		tail;			// Queued work list end
+		thread_t*		worker;			// Worker thread
+	};
+
+
+	// Workqueues pool
+	static std::array<workqueue_t, WORKQUEUE_MAX>	workqueuePool	{};
+	// Workqueues pool lock
+	static klib::kSpinlock<>			workqueueLock	{};
+	// Used workqueues count
+	static igros_usize_t				workqueueCount	{0_usize};
+	// System workqueue
+	static workqueue_t*				workqueueDefault {nullptr};
+
+
+	// Take next work (nullptr if empty)
+	[[nodiscard]]
+	static auto workqueueTake(workqueue_t* const queue) noexcept -> work_t* {
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {queue->lock};
+		const auto work {queue->head};
+		if (nullptr != work) {
+			queue->head = work->next;
+			if (nullptr == queue->head) {
+				queue->tail = &queue->head;
+			}
+		}
+		return work;
+	}
+
+	// Worker thread body
+	static void workqueueWorker(const igros_pointer_t arg) noexcept {
+		const auto queue {static_cast<workqueue_t*>(arg)};
+		while (true) {
+			const auto work {workqueueTake(queue)};
+			// Sleep till work comes (wake up is never lost)
+			if (nullptr == work) {
+				sched::block();
+				continue;
+			}
+			// May be queued again from now on
+			arch::atomic::get().store(&work->pending, 0_u32);
+			work->func(work->arg);
+		}
+	}
+
+
+	// Create workqueue with its worker thread
+	[[nodiscard]]
+	auto workqueueCreate(const char* const name, const igros_dword_t priority) noexcept -> workqueue_t* {
+
+		// Take free workqueue
+		workqueue_t* queue {nullptr};
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {workqueueLock};
+			if (workqueueCount < WORKQUEUE_MAX) [[likely]] {
+				queue = &workqueuePool[workqueueCount++];
+			}
+		}
+		if (nullptr == queue) [[unlikely]] {
+			klib::kprintf("WORKQUEUE:\tOut of workqueues for \"%s\"\n", name);
+			return nullptr;
+		}
+
+		// Worker is published before it may take the lock
+		const klib::kIRQLockGuard<klib::kSpinlock<>> guard {queue->lock};
+		queue->head	= nullptr;
+		queue->tail	= &queue->head;
+		queue->worker	= threadCreate(name, workqueueWorker, queue, priority);
+		return (nullptr != queue->worker) ? queue : nullptr;
+
+	}
+
+	// Get system workqueue
+	[[nodiscard]]
+	auto workqueueSystem() noexcept -> workqueue_t* {
+		return workqueueDefault;
+	}
+
+	// Init system workqueue
+	void workqueueInit() noexcept {
+		workqueueDefault = workqueueCreate("kworker");
+	}
+
+
+	// Queue work (safe from interrupt handlers, no-op if queued already)
+	auto workQueue(workqueue_t* const queue, work_t &work) noexcept -> bool {
+		if ((nullptr == queue) || (0_u32 != arch::atomic::get().compareExchange(&work.pending, 0_u32, 1_u32))) {
+			return false;
+		}
+		thread_t* worker {nullptr};
+		{
+			const klib::kIRQLockGuard<klib::kSpinlock<>> guard {queue->lock};
+			work.next	= nullptr;
+			*queue->tail	= &work;
+			queue->tail	= &work.next;
+			worker		= queue->worker;
+		}
+		sched::wake(worker);
+		return true;
+	}
+
+
+}	// namespace igros::sys
+
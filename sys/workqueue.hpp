@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////
+//
+//	Workqueues (deferred work in thread context)
+//
+//	File:	workqueue.hpp
+//	Date:	19 Oct 2026
+//
+//	Copyright (c) 2017 - 2022, Igor Baklykov
+//	All rights reserved.
+//
+//
+
+
+#pragma once
+
+
+// C++
+#include <type_traits>
+// IgrOS-Kernel arch
+#include <arch/types.hpp>
+// IgrOS-Kernel system
+#include <sys/thread.hpp>
+
+
+// System code zone
+namespace igros::sys {
+
+
+	// Max number of workqueues
+	constexpr auto WORKQUEUE_MAX	{8_usize};
+
+
+	// Work function
+	using workFunc_t	= std::add_pointer_t<void (igros_pointer_t)>;
+
+
+	// Work item (may be queued again once it started)
+	struct work_t {
+		work_t*			next;			// Next queued work
+		workFunc_t		func;			// Work function
+		igros_pointer_t		arg;			// Function argument
+		igros_dword_t		pending;		// Queued, not started yet
+	};
+
+
+	// Workqueue (FIFO served by single worker thread)
+	struct workqueue_t;
+
+
+	// Create workqueue with its worker thread
+	[[nodiscard]]
+	auto	workqueueCreate(const char* const name, const igros_dword_t priority = THREAD_PRIORITY_NORMAL) noexcept -> workqueue_t*;
+	// Get system workqueue
+	[[nodiscard]]
+	auto	workqueueSystem() noexcept -> workqueue_t*;
+	// Init system workqueue
+	void	workqueueInit() noexcept;
+
+	// Queue work (safe from interrupt handlers, no-op if queued already)
+	auto	workQueue(workqueue_t* const queue, work_t &work) noexcept -> bool;
+
+
+}	// namespace igros::sys
+